@@ -0,0 +1,386 @@
+/*******************************************************************************************
+*
+*   maze_agents - Maze agents (NPCs) simulation: chasers and wanderers
+*
+*   Agents move from cell center to cell center (4 directions), choosing next cell when
+*   reaching current one: chasers step into the neighbour cell closer to flow field target,
+*   wanderers pick a random walkable neighbour (not going back, except on dead ends)
+*
+*   Agents are stored as structure of arrays (one array per attribute), so updates stream
+*   through contiguous memory, and updated in parallel by a jobs pool, every job updating
+*   a fixed range of agents against the same maze grid and flow field (read-only)
+*
+*   CONFIGURATION:
+*       #define MAZE_AGENTS_IMPLEMENTATION
+*           Generates the implementation of the module in the including file,
+*           only one translation unit should define it
+*
+*   DEPENDENCIES:
+*       maze_grid       - Maze cells data, agents collide with walls
+*       maze_flow       - Flow field navigation, chasers target
+*       maze_gen        - Random generator, agents spawning
+*       maze_system     - Jobs pool, timing
+*
+*   NOTE: Module is window-free and does not depend on raylib
+*
+*   Copyright (c) 2024-2025 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#ifndef MAZE_AGENTS_H
+#define MAZE_AGENTS_H
+
+#include "maze_grid.h"
+#include "maze_flow.h"
+#include "maze_gen.h"
+#include "maze_system.h"
+
+#define MAZE_AGENTS_JOB_SIZE    2048    // Agents updated per job
+
+// Maze agent types
+typedef enum {
+    MAZE_AGENT_CHASER = 0,      // Follows flow field to target
+    MAZE_AGENT_WANDERER,        // Walks randomly
+    MAZE_AGENT_TYPE_COUNT
+} MazeAgentType;
+
+// Maze agents update statistics, last update
+typedef struct MazeAgentsStats {
+    int at_target;              // Chasers standing on flow field target cell
+    int jobs;                   // Number of jobs run
+    double time;                // Update time in seconds
+} MazeAgentsStats;
+
+// Maze agents, structure of arrays
+// NOTE: Positions in cell units, agent standing on cell (x, y) when position is (x, y)
+typedef struct MazeAgents {
+    int count;                  // Number of agents
+    int capacity;               // Number of agents allocated
+
+    float *x;                   // Agents position
+    float *y;
+    int *next_x;                // Agents cell moving into (current cell if not moving)
+    int *next_y;
+    unsigned char *type;        // Agents type (MazeAgentType)
+    unsigned char *direction;   // Agents last move direction (0..3: N, E, S, W, 4: none)
+    unsigned int *seed;         // Agents random state (xorshift32)
+
+    float speed;                // Agents speed, cells per tick
+    MazeAgentsStats stats;
+} MazeAgents;
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+MazeAgents LoadMazeAgents(int capacity, float speed);               // Load agents storage
+void UnloadMazeAgents(MazeAgents *agents);                          // Unload agents storage
+bool AddMazeAgent(MazeAgents *agents, int x, int y, int type, unsigned int seed); // Add agent standing on cell, returns false if full
+int SpawnMazeAgents(MazeAgents *agents, MazeGrid grid, int count, int type, MazeRandom *rng); // Add agents on random walkable cells, returns agents added
+void ClearMazeAgents(MazeAgents *agents);                           // Remove all agents
+
+// Update all agents for a number of ticks, jobs run by pool (NULL: caller thread)
+void UpdateMazeAgents(MazeAgents *agents, MazeGrid grid, const MazeFlowField *flow, MazeJobPool *pool, int ticks);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif // MAZE_AGENTS_H
+
+/***********************************************************************************
+*
+*   MAZE_AGENTS IMPLEMENTATION
+*
+************************************************************************************/
+
+#if defined(MAZE_AGENTS_IMPLEMENTATION) && !defined(MAZE_AGENTS_IMPLEMENTATION_DONE)
+#define MAZE_AGENTS_IMPLEMENTATION_DONE
+
+#include <stdlib.h>     // Required for: malloc(), free()
+
+#define MAZE_AGENTS_MAX_JOBS    64      // Maximum jobs per update, agents split evenly between jobs
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+
+// Agents update job data, shared by all jobs (every job only writes its own results)
+typedef struct MazeAgentsJob {
+    MazeAgents *agents;
+    MazeGrid grid;
+    const MazeFlowField *flow;
+    int ticks;
+    int jobs;                   // Number of jobs
+    int at_target[MAZE_AGENTS_MAX_JOBS]; // Chasers on target, per job
+} MazeAgentsJob;
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Declaration
+//----------------------------------------------------------------------------------
+static void UpdateMazeAgentsJob(void *data, int index);             // Update agents range for job ticks
+static int GetMazeAgentNextDirection(MazeAgents *agents, int i, MazeGrid grid, const MazeFlowField *flow); // Get agent next move direction (4: none)
+static unsigned int GetMazeAgentRandom(unsigned int *seed);         // Get next agent random value (xorshift32)
+
+// Move directions: north, east, south, west
+static const int maze_agent_dx[4] = { 0, 1, 0, -1 };
+static const int maze_agent_dy[4] = { -1, 0, 1, 0 };
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+
+// Load agents storage
+MazeAgents LoadMazeAgents(int capacity, float speed)
+{
+    MazeAgents agents = { 0 };
+
+    if (capacity <= 0) return agents;
+
+    agents.x = (float *)malloc(capacity*sizeof(float));
+    agents.y = (float *)malloc(capacity*sizeof(float));
+    agents.next_x = (int *)malloc(capacity*sizeof(int));
+    agents.next_y = (int *)malloc(capacity*sizeof(int));
+    agents.type = (unsigned char *)malloc(capacity);
+    agents.direction = (unsigned char *)malloc(capacity);
+    agents.seed = (unsigned int *)malloc(capacity*sizeof(unsigned int));
+
+    if ((agents.x == NULL) || (agents.y == NULL) || (agents.next_x == NULL) || (agents.next_y == NULL) ||
+        (agents.type == NULL) || (agents.direction == NULL) || (agents.seed == NULL))
+    {
+        UnloadMazeAgents(&agents);
+        return agents;
+    }
+
+    agents.capacity = capacity;
+    agents.speed = speed;
+
+    return agents;
+}
+
+// Unload agents storage
+void UnloadMazeAgents(MazeAgents *agents)
+{
+    free(agents->x);
+    free(agents->y);
+    free(agents->next_x);
+    free(agents->next_y);
+    free(agents->type);
+    free(agents->direction);
+    free(agents->seed);
+
+    *agents = (MazeAgents){ 0 };
+}
+
+// Add agent standing on cell, returns false if full
+bool AddMazeAgent(MazeAgents *agents, int x, int y, int type, unsigned int seed)
+{
+    if (agents->count >= agents->capacity) return false;
+
+    int i = agents->count++;
+    agents->x[i] = (float)x;
+    agents->y[i] = (float)y;
+    agents->next_x[i] = x;
+    agents->next_y[i] = y;
+    agents->type[i] = (unsigned char)type;
+    agents->direction[i] = 4;
+    agents->seed[i] = (seed != 0)? seed : 0x9e3779b9;  // NOTE: xorshift state can not be 0
+
+    return true;
+}
+
+// Add agents on random walkable cells, returns agents added
+// NOTE: Walkable cell search limited per agent, mazes without walkable cells add no agents
+int SpawnMazeAgents(MazeAgents *agents, MazeGrid grid, int count, int type, MazeRandom *rng)
+{
+    int added = 0;
+
+    for (int i = 0; (i < count) && (agents->count < agents->capacity); i++)
+    {
+        for (int tries = 0; tries < 64; tries++)
+        {
+            int x = GetMazeRandomValue(rng, 0, grid.width - 1);
+            int y = GetMazeRandomValue(rng, 0, grid.height - 1);
+
+            if (IsMazeCellWalkable(grid, x, y))
+            {
+                AddMazeAgent(agents, x, y, type, (unsigned int)GetMazeRandomValue(rng, 1, 0x7fffffff));
+                added++;
+                break;
+            }
+        }
+    }
+
+    return added;
+}
+
+// Remove all agents
+void ClearMazeAgents(MazeAgents *agents)
+{
+    agents->count = 0;
+}
+
+// Update all agents for a number of ticks, jobs run by pool (NULL: caller thread)
+// NOTE: Every job updates its own agents range, jobs only write agents data in their range
+void UpdateMazeAgents(MazeAgents *agents, MazeGrid grid, const MazeFlowField *flow, MazeJobPool *pool, int ticks)
+{
+    double start_time = GetMazeTime();
+
+    MazeAgentsJob job = { 0 };
+    job.agents = agents;
+    job.grid = grid;
+    job.flow = flow;
+    job.ticks = ticks;
+    job.jobs = (agents->count + MAZE_AGENTS_JOB_SIZE - 1)/MAZE_AGENTS_JOB_SIZE;
+    if (job.jobs > MAZE_AGENTS_MAX_JOBS) job.jobs = MAZE_AGENTS_MAX_JOBS;
+
+    if (ticks > 0) RunMazeJobs(pool, UpdateMazeAgentsJob, &job, job.jobs);
+
+    agents->stats.at_target = 0;
+    for (int j = 0; j < job.jobs; j++) agents->stats.at_target += job.at_target[j];
+
+    agents->stats.jobs = job.jobs;
+    agents->stats.time = GetMazeTime() - start_time;
+}
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Definition
+//----------------------------------------------------------------------------------
+
+// Update agents range for job ticks
+// NOTE: Agents are independent, every agent is updated for all ticks at once
+static void UpdateMazeAgentsJob(void *data, int index)
+{
+    MazeAgentsJob *job = (MazeAgentsJob *)data;
+    MazeAgents *agents = job->agents;
+    int first = (int)((long long)agents->count*index/job->jobs);
+    int last = (int)((long long)agents->count*(index + 1)/job->jobs);
+    int target = job->flow->target;
+    int at_target = 0;
+
+    for (int i = first; i < last; i++)
+    {
+        float x = agents->x[i];
+        float y = agents->y[i];
+        int next_x = agents->next_x[i];
+        int next_y = agents->next_y[i];
+
+        // Moving into a cell blocked by editor: back to previous cell
+        if (!IsMazeCellWalkable(job->grid, next_x, next_y) && (agents->direction[i] < 4))
+        {
+            next_x -= maze_agent_dx[agents->direction[i]];
+            next_y -= maze_agent_dy[agents->direction[i]];
+            agents->direction[i] = (agents->direction[i] + 2)%4;
+        }
+
+        for (int t = 0; t < job->ticks; t++)
+        {
+            float remaining = agents->speed;
+
+            // Move towards next cell, new direction chosen on arrival (same tick)
+            while (remaining > 0.0f)
+            {
+                float dx = next_x - x;
+                float dy = next_y - y;
+                float distance = ((dx < 0.0f)? -dx : dx) + ((dy < 0.0f)? -dy : dy);
+
+                if (distance > remaining)
+                {
+                    x += (dx > 0.0f)? remaining : (dx < 0.0f)? -remaining : 0.0f;
+                    y += (dy > 0.0f)? remaining : (dy < 0.0f)? -remaining : 0.0f;
+                    break;
+                }
+
+                x = (float)next_x;
+                y = (float)next_y;
+                remaining -= distance;
+
+                agents->next_x[i] = next_x;
+                agents->next_y[i] = next_y;
+                int direction = GetMazeAgentNextDirection(agents, i, job->grid, job->flow);
+                agents->direction[i] = (unsigned char)direction;
+
+                if (direction == 4) break;
+
+                next_x += maze_agent_dx[direction];
+                next_y += maze_agent_dy[direction];
+            }
+        }
+
+        agents->x[i] = x;
+        agents->y[i] = y;
+        agents->next_x[i] = next_x;
+        agents->next_y[i] = next_y;
+
+        if ((agents->type[i] == MAZE_AGENT_CHASER) && (target >= 0) && ((next_y*job->grid.width + next_x) == target) &&
+            (x == (float)next_x) && (y == (float)next_y)) at_target++;
+    }
+
+    job->at_target[index] = at_target;
+}
+
+// Get agent next move direction (4: none), agent standing on its next cell
+// NOTE: Chasers not connected to flow field target walk as wanderers
+static int GetMazeAgentNextDirection(MazeAgents *agents, int i, MazeGrid grid, const MazeFlowField *flow)
+{
+    int x = agents->next_x[i];
+    int y = agents->next_y[i];
+
+    if ((agents->type[i] == MAZE_AGENT_CHASER) && (flow->field != NULL) && (flow->width == grid.width) && (flow->height == grid.height))
+    {
+        int cell = y*flow->width + x;
+        int best = flow->field[cell];
+
+        if (best < MAZE_FLOW_UNREACHABLE)
+        {
+            int direction = 4;
+
+            for (int d = 0; d < 4; d++)
+            {
+                int nx = x + maze_agent_dx[d];
+                int ny = y + maze_agent_dy[d];
+
+                if ((nx < 0) || (nx >= flow->width) || (ny < 0) || (ny >= flow->height)) continue;
+
+                int value = flow->field[ny*flow->width + nx];
+
+                if (value < best)
+                {
+                    best = value;
+                    direction = d;
+                }
+            }
+
+            return direction;
+        }
+    }
+
+    // Wandering: random walkable neighbour, going back only if no other choice
+    int back = (agents->direction[i] < 4)? (agents->direction[i] + 2)%4 : 4;
+    int choices[4] = { 0 };
+    int count = 0;
+
+    for (int d = 0; d < 4; d++)
+    {
+        if ((d != back) && IsMazeCellWalkable(grid, x + maze_agent_dx[d], y + maze_agent_dy[d])) choices[count++] = d;
+    }
+
+    if (count > 0) return choices[GetMazeAgentRandom(&agents->seed[i])%count];
+    if ((back < 4) && IsMazeCellWalkable(grid, x + maze_agent_dx[back], y + maze_agent_dy[back])) return back;
+
+    return 4;
+}
+
+// Get next agent random value (xorshift32)
+static unsigned int GetMazeAgentRandom(unsigned int *seed)
+{
+    unsigned int value = *seed;
+    value ^= value << 13;
+    value ^= value >> 17;
+    value ^= value << 5;
+    *seed = value;
+
+    return value;
+}
+
+#endif // MAZE_AGENTS_IMPLEMENTATION
@@ -0,0 +1,538 @@
+/*******************************************************************************************
+*
+*   maze_algo - Maze generation algorithms, selectable at runtime
+*
+*   All algorithms share the same generator function signature (same than GenMazeGrid()),
+*   so they can be selected by index and new algorithms only need a new generators table
+*   entry. Grid algorithm parameters (points spacing and chance) are ignored by others
+*
+*   Available algorithms:
+*       grid            - Grid points and random lines (GenMazeGrid()), open mazes with loops
+*       backtracker     - Recursive backtracker using an explicit stack, long winding corridors
+*       wilson          - Wilson's loop-erased random walks, uniform spanning tree (unbiased)
+*       eller           - Eller's row by row generation using O(width) memory, rows can be
+*                         streamed (GenMazeEllerRow()) so arbitrarily tall mazes never need
+*                         the full maze in memory
+*
+*   Perfect mazes (backtracker, wilson, eller) have no loops: maze cells are placed at odd
+*   coordinates with walls between them, with even sizes the last row/column stays wall.
+*   Last maze cell is at (GetMazePerfectLast(width), GetMazePerfectLast(height))
+*
+*   CONFIGURATION:
+*       #define MAZE_ALGO_IMPLEMENTATION
+*           Generates the implementation of the module in the including file,
+*           only one translation unit should define it
+*
+*   DEPENDENCIES:
+*       maze_grid       - Maze cells data, generation output
+*       maze_gen        - Random generator, generation statistics and grid algorithm
+*       maze_system     - Timing (GetMazeTime())
+*
+*   NOTE: Module is window-free and does not depend on raylib
+*
+*   Copyright (c) 2024-2025 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#ifndef MAZE_ALGO_H
+#define MAZE_ALGO_H
+
+#include "maze_grid.h"
+#include "maze_gen.h"
+
+// Generation algorithms version, must be increased when any algorithm output changes
+// for the same seed and parameters (i.e. invalidates cached mazes)
+#define MAZE_ALGO_VERSION   1
+
+// Maze generation algorithms
+typedef enum {
+    MAZE_ALGORITHM_GRID = 0,        // Grid points and random lines
+    MAZE_ALGORITHM_BACKTRACKER,     // Recursive backtracker (explicit stack)
+    MAZE_ALGORITHM_WILSON,          // Wilson's loop-erased random walks
+    MAZE_ALGORITHM_ELLER,           // Eller's row by row
+    MAZE_ALGORITHM_COUNT
+} MazeAlgorithm;
+
+// Maze generator function, same parameters than GenMazeGrid()
+// NOTE: stats->points reports maze points (grid) or maze cells (perfect mazes)
+typedef MazeGrid (*MazeGenFunc)(int width, int height, int spacing_rows, int spacing_cols, float point_chance, MazeRandom *rng, MazeGenStats *stats);
+
+// Maze generator, algorithms table entry
+typedef struct MazeGenerator {
+    const char *name;           // Algorithm name
+    MazeGenFunc generate;       // Generator function
+    bool perfect;               // Generated mazes have no loops, cells at odd coordinates
+} MazeGenerator;
+
+// Eller's algorithm streaming state, maze generated one grid row at a time
+typedef struct MazeEller {
+    int width;                  // Maze width in grid cells
+    int height;                 // Maze height in grid cells
+    int cells_x;                // Maze cells per row
+    int cells_y;                // Maze cells rows
+    int row;                    // Next grid row to generate
+
+    int *sets;                  // Current maze cells row sets (-1 = no set)
+    int *parent;                // Sets union-find, current row
+    int *counts;                // Cells per set, current row
+    unsigned char *right;       // Current maze cells row, cell joined to right cell
+    unsigned char *down;        // Current maze cells row, cell joined to cell below
+
+    MazeRandom rng;             // Random generator state
+    size_t memory;              // Memory allocated by state
+} MazeEller;
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+const MazeGenerator *GetMazeGenerator(int algorithm);                // Get algorithm generator, NULL if not valid
+MazeGrid GenMazeGridAlgorithm(int algorithm, int width, int height, int spacing_rows, int spacing_cols, float point_chance, MazeRandom *rng, MazeGenStats *stats); // Generate maze using algorithm
+int GetMazePerfectLast(int size);                                   // Get last maze cell coordinate of perfect maze size
+
+MazeGrid GenMazeGridBacktracker(int width, int height, int spacing_rows, int spacing_cols, float point_chance, MazeRandom *rng, MazeGenStats *stats); // Generate maze using recursive backtracker
+MazeGrid GenMazeGridWilson(int width, int height, int spacing_rows, int spacing_cols, float point_chance, MazeRandom *rng, MazeGenStats *stats);      // Generate maze using Wilson's algorithm
+MazeGrid GenMazeGridEller(int width, int height, int spacing_rows, int spacing_cols, float point_chance, MazeRandom *rng, MazeGenStats *stats);       // Generate maze using Eller's algorithm
+
+MazeEller LoadMazeEller(int width, int height, MazeRandom *rng);    // Load Eller's streaming state, random generator state copied
+void UnloadMazeEller(MazeEller *eller);                             // Unload Eller's streaming state
+bool GenMazeEllerRow(MazeEller *eller, unsigned char *cells);       // Generate next grid row (width cells), false if maze completed
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif // MAZE_ALGO_H
+
+/***********************************************************************************
+*
+*   MAZE_ALGO IMPLEMENTATION
+*
+************************************************************************************/
+
+#if defined(MAZE_ALGO_IMPLEMENTATION) && !defined(MAZE_ALGO_IMPLEMENTATION_DONE)
+#define MAZE_ALGO_IMPLEMENTATION_DONE
+
+#include <stdlib.h>     // Required for: malloc(), calloc(), free()
+#include <string.h>     // Required for: memset()
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Declaration
+//----------------------------------------------------------------------------------
+static int FindMazeEllerSet(int *parent, int set);                  // Find set root, compressing path
+static void BeginMazeEllerRow(MazeEller *eller);                    // Join current maze cells row sets (right and down)
+
+//----------------------------------------------------------------------------------
+// Global Variables Definition
+//----------------------------------------------------------------------------------
+static const MazeGenerator maze_generators[MAZE_ALGORITHM_COUNT] = {
+    { "grid", GenMazeGrid, false },
+    { "backtracker", GenMazeGridBacktracker, true },
+    { "wilson", GenMazeGridWilson, true },
+    { "eller", GenMazeGridEller, true },
+};
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+
+// Get algorithm generator, NULL if not valid
+const MazeGenerator *GetMazeGenerator(int algorithm)
+{
+    if ((algorithm < 0) || (algorithm >= MAZE_ALGORITHM_COUNT)) return NULL;
+
+    return &maze_generators[algorithm];
+}
+
+// Generate maze using algorithm
+MazeGrid GenMazeGridAlgorithm(int algorithm, int width, int height, int spacing_rows, int spacing_cols, float point_chance, MazeRandom *rng, MazeGenStats *stats)
+{
+    const MazeGenerator *generator = GetMazeGenerator(algorithm);
+
+    if (generator == NULL) return (MazeGrid){ 0 };
+
+    return generator->generate(width, height, spacing_rows, spacing_cols, point_chance, rng, stats);
+}
+
+// Get last maze cell coordinate of perfect maze size
+int GetMazePerfectLast(int size)
+{
+    return ((size - 1)/2)*2 - 1;
+}
+
+// Generate maze using recursive backtracker
+// NOTE: Depth-first search with an explicit stack of cells (no recursion, any maze size),
+// visited cells are the carved ones, so no additional visited data is required
+MazeGrid GenMazeGridBacktracker(int width, int height, int spacing_rows, int spacing_cols, float point_chance, MazeRandom *rng, MazeGenStats *stats)
+{
+    (void)spacing_rows; (void)spacing_cols; (void)point_chance;
+
+    MazeGrid grid = { 0 };
+    int cells_x = (width - 1)/2;
+    int cells_y = (height - 1)/2;
+
+    if ((cells_x <= 0) || (cells_y <= 0) || (rng == NULL)) return grid;
+
+    double start_time = GetMazeTime();
+
+    grid = LoadMazeGrid(width, height);
+    unsigned int *stack = (unsigned int *)malloc((size_t)cells_x*cells_y*sizeof(unsigned int));
+    size_t peak_memory = (size_t)width*height;
+    int stack_count = 0;
+    int stack_max = 0;
+
+    if ((grid.cells == NULL) || (stack == NULL))
+    {
+        UnloadMazeGrid(grid);
+        free(stack);
+        return (MazeGrid){ 0 };
+    }
+
+    memset(grid.cells, MAZE_CELL_WALL, (size_t)width*height);
+
+    const int offsets[4][2] = { { 1, 0 }, { -1, 0 }, { 0, 1 }, { 0, -1 } };
+
+    // Stack stores maze cells indices (cell coordinates, not grid coordinates)
+    stack[stack_count++] = 0;
+    grid.cells[(size_t)width + 1] = MAZE_CELL_FLOOR;
+
+    while (stack_count > 0)
+    {
+        int cell_x = (int)(stack[stack_count - 1]%cells_x);
+        int cell_y = (int)(stack[stack_count - 1]/cells_x);
+
+        // Pick a random not visited neighbour, backtrack if none
+        int candidates[4] = { 0 };
+        int candidate_count = 0;
+
+        for (int i = 0; i < 4; i++)
+        {
+            int nx = cell_x + offsets[i][0];
+            int ny = cell_y + offsets[i][1];
+
+            if ((nx >= 0) && (nx < cells_x) && (ny >= 0) && (ny < cells_y) &&
+                (grid.cells[(size_t)(2*ny + 1)*width + 2*nx + 1] == MAZE_CELL_WALL)) candidates[candidate_count++] = i;
+        }
+
+        if (candidate_count == 0)
+        {
+            stack_count--;
+            continue;
+        }
+
+        int dir = candidates[GetMazeRandomValue(rng, 0, candidate_count - 1)];
+        int nx = cell_x + offsets[dir][0];
+        int ny = cell_y + offsets[dir][1];
+
+        // Carve wall between cells and neighbour cell
+        grid.cells[(size_t)(2*cell_y + 1 + offsets[dir][1])*width + 2*cell_x + 1 + offsets[dir][0]] = MAZE_CELL_FLOOR;
+        grid.cells[(size_t)(2*ny + 1)*width + 2*nx + 1] = MAZE_CELL_FLOOR;
+
+        stack[stack_count++] = (unsigned int)(ny*cells_x + nx);
+        if (stack_count > stack_max) stack_max = stack_count;
+    }
+
+    free(stack);
+
+    if (stats != NULL)
+    {
+        stats->points = cells_x*cells_y;
+        stats->time = GetMazeTime() - start_time;
+        stats->peak_memory = peak_memory + (size_t)cells_x*cells_y*sizeof(unsigned int);
+    }
+
+    return grid;
+}
+
+// Generate maze using Wilson's algorithm
+// NOTE: Random walks from every cell out of the maze until the maze is reached, walk direction
+// stored per cell so loops are erased when a cell is walked again, walk path is then carved
+MazeGrid GenMazeGridWilson(int width, int height, int spacing_rows, int spacing_cols, float point_chance, MazeRandom *rng, MazeGenStats *stats)
+{
+    (void)spacing_rows; (void)spacing_cols; (void)point_chance;
+
+    MazeGrid grid = { 0 };
+    int cells_x = (width - 1)/2;
+    int cells_y = (height - 1)/2;
+
+    if ((cells_x <= 0) || (cells_y <= 0) || (rng == NULL)) return grid;
+
+    double start_time = GetMazeTime();
+
+    grid = LoadMazeGrid(width, height);
+    unsigned char *walk = (unsigned char *)malloc((size_t)cells_x*cells_y);
+
+    if ((grid.cells == NULL) || (walk == NULL))
+    {
+        UnloadMazeGrid(grid);
+        free(walk);
+        return (MazeGrid){ 0 };
+    }
+
+    memset(grid.cells, MAZE_CELL_WALL, (size_t)width*height);
+
+    const int offsets[4][2] = { { 1, 0 }, { -1, 0 }, { 0, 1 }, { 0, -1 } };
+
+    // Maze starts with one random cell, cells in maze are the carved ones
+    int first = GetMazeRandomValue(rng, 0, cells_x*cells_y - 1);
+    grid.cells[(size_t)(2*(first/cells_x) + 1)*width + 2*(first%cells_x) + 1] = MAZE_CELL_FLOOR;
+
+    for (int start = 0; start < cells_x*cells_y; start++)
+    {
+        int cell_x = start%cells_x;
+        int cell_y = start/cells_x;
+
+        if (grid.cells[(size_t)(2*cell_y + 1)*width + 2*cell_x + 1] == MAZE_CELL_FLOOR) continue;
+
+        // Random walk until maze reached, last direction taken from every cell is kept
+        while (grid.cells[(size_t)(2*cell_y + 1)*width + 2*cell_x + 1] == MAZE_CELL_WALL)
+        {
+            int dir = GetMazeRandomValue(rng, 0, 3);
+            int nx = cell_x + offsets[dir][0];
+            int ny = cell_y + offsets[dir][1];
+
+            if ((nx < 0) || (nx >= cells_x) || (ny < 0) || (ny >= cells_y)) continue;
+
+            walk[cell_y*cells_x + cell_x] = (unsigned char)dir;
+            cell_x = nx;
+            cell_y = ny;
+        }
+
+        // Loop-erased walk carved following kept directions from start
+        cell_x = start%cells_x;
+        cell_y = start/cells_x;
+
+        while (grid.cells[(size_t)(2*cell_y + 1)*width + 2*cell_x + 1] == MAZE_CELL_WALL)
+        {
+            int dir = walk[cell_y*cells_x + cell_x];
+
+            grid.cells[(size_t)(2*cell_y + 1)*width + 2*cell_x + 1] = MAZE_CELL_FLOOR;
+            grid.cells[(size_t)(2*cell_y + 1 + offsets[dir][1])*width + 2*cell_x + 1 + offsets[dir][0]] = MAZE_CELL_FLOOR;
+
+            cell_x += offsets[dir][0];
+            cell_y += offsets[dir][1];
+        }
+    }
+
+    free(walk);
+
+    if (stats != NULL)
+    {
+        stats->points = cells_x*cells_y;
+        stats->time = GetMazeTime() - start_time;
+        stats->peak_memory = (size_t)width*height + (size_t)cells_x*cells_y;
+    }
+
+    return grid;
+}
+
+// Generate maze using Eller's algorithm
+// NOTE: Rows generated by streaming state written into maze grid, only the grid is
+// proportional to maze size, GenMazeEllerRow() can be used directly to avoid it
+MazeGrid GenMazeGridEller(int width, int height, int spacing_rows, int spacing_cols, float point_chance, MazeRandom *rng, MazeGenStats *stats)
+{
+    (void)spacing_rows; (void)spacing_cols; (void)point_chance;
+
+    MazeGrid grid = { 0 };
+
+    if ((((width - 1)/2) <= 0) || (((height - 1)/2) <= 0) || (rng == NULL)) return grid;
+
+    double start_time = GetMazeTime();
+
+    MazeEller eller = LoadMazeEller(width, height, rng);
+    grid = LoadMazeGrid(width, height);
+
+    if ((eller.sets == NULL) || (grid.cells == NULL))
+    {
+        UnloadMazeEller(&eller);
+        UnloadMazeGrid(grid);
+        return (MazeGrid){ 0 };
+    }
+
+    for (int y = 0; GenMazeEllerRow(&eller, &grid.cells[(size_t)y*width]); y++) { }
+
+    // Caller random generator continues after generated values
+    *rng = eller.rng;
+
+    if (stats != NULL)
+    {
+        stats->points = eller.cells_x*eller.cells_y;
+        stats->time = GetMazeTime() - start_time;
+        stats->peak_memory = (size_t)width*height + eller.memory;
+    }
+
+    UnloadMazeEller(&eller);
+
+    return grid;
+}
+
+// Load Eller's streaming state, random generator state copied
+MazeEller LoadMazeEller(int width, int height, MazeRandom *rng)
+{
+    MazeEller eller = { 0 };
+
+    if ((((width - 1)/2) <= 0) || (((height - 1)/2) <= 0) || (rng == NULL)) return eller;
+
+    eller.width = width;
+    eller.height = height;
+    eller.cells_x = (width - 1)/2;
+    eller.cells_y = (height - 1)/2;
+    eller.rng = *rng;
+
+    eller.sets = (int *)malloc(eller.cells_x*sizeof(int));
+    eller.parent = (int *)malloc(eller.cells_x*sizeof(int));
+    eller.counts = (int *)malloc(eller.cells_x*sizeof(int));
+    eller.right = (unsigned char *)malloc(eller.cells_x);
+    eller.down = (unsigned char *)malloc(eller.cells_x);
+    eller.memory = (size_t)eller.cells_x*(3*sizeof(int) + 2);
+
+    if ((eller.sets == NULL) || (eller.parent == NULL) || (eller.counts == NULL) || (eller.right == NULL) || (eller.down == NULL))
+    {
+        UnloadMazeEller(&eller);
+        return eller;
+    }
+
+    // First row cells are not joined to any cell yet
+    for (int i = 0; i < eller.cells_x; i++) eller.sets[i] = -1;
+
+    return eller;
+}
+
+// Unload Eller's streaming state
+void UnloadMazeEller(MazeEller *eller)
+{
+    free(eller->sets);
+    free(eller->parent);
+    free(eller->counts);
+    free(eller->right);
+    free(eller->down);
+
+    *eller = (MazeEller){ 0 };
+}
+
+// Generate next grid row (width cells), false if maze completed
+// NOTE: Maze cells rows are joined when their grid row is generated, grid row below
+// them (walls between rows) uses joins already computed
+bool GenMazeEllerRow(MazeEller *eller, unsigned char *cells)
+{
+    if ((eller->sets == NULL) || (eller->row >= eller->height)) return false;
+
+    int row = eller->row;
+    memset(cells, MAZE_CELL_WALL, eller->width);
+
+    if ((row > 0) && (row <= 2*eller->cells_y))
+    {
+        if ((row%2) == 1)
+        {
+            // Maze cells row, cells joined to right cell open the wall between them
+            BeginMazeEllerRow(eller);
+
+            for (int i = 0; i < eller->cells_x; i++)
+            {
+                cells[2*i + 1] = MAZE_CELL_FLOOR;
+                if (eller->right[i]) cells[2*i + 2] = MAZE_CELL_FLOOR;
+            }
+        }
+        else
+        {
+            // Walls row between maze cells rows, cells joined down open the wall below them
+            for (int i = 0; i < eller->cells_x; i++)
+            {
+                if (eller->down[i]) cells[2*i + 1] = MAZE_CELL_FLOOR;
+            }
+        }
+    }
+
+    eller->row++;
+
+    return true;
+}
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Definition
+//----------------------------------------------------------------------------------
+
+// Find set root, compressing path
+static int FindMazeEllerSet(int *parent, int set)
+{
+    while (parent[set] != set)
+    {
+        parent[set] = parent[parent[set]];
+        set = parent[set];
+    }
+
+    return set;
+}
+
+// Join current maze cells row sets (right and down)
+// NOTE: Sets are renumbered every row (0 to cells_x - 1), so sets data is O(width)
+static void BeginMazeEllerRow(MazeEller *eller)
+{
+    int cells_x = eller->cells_x;
+    bool last = (eller->row == (2*eller->cells_y - 1));
+
+    // STEP 1: Cells joined from row above keep their set (renumbered), others get a new set
+    // NOTE: parent used as renumbering map first, then reset as union-find
+    for (int i = 0; i < cells_x; i++) eller->parent[i] = -1;
+
+    int set_count = 0;
+
+    for (int i = 0; i < cells_x; i++)
+    {
+        if (eller->sets[i] >= 0)
+        {
+            if (eller->parent[eller->sets[i]] < 0) eller->parent[eller->sets[i]] = set_count++;
+            eller->sets[i] = eller->parent[eller->sets[i]];
+        }
+    }
+
+    for (int i = 0; i < cells_x; i++)
+    {
+        if (eller->sets[i] < 0) eller->sets[i] = set_count++;
+    }
+
+    for (int i = 0; i < cells_x; i++) eller->parent[i] = i;
+
+    // STEP 2: Adjacent cells of different sets randomly joined (always joined on last row)
+    for (int i = 0; i < (cells_x - 1); i++)
+    {
+        int a = FindMazeEllerSet(eller->parent, eller->sets[i]);
+        int b = FindMazeEllerSet(eller->parent, eller->sets[i + 1]);
+
+        eller->right[i] = (a != b) && (last || (GetMazeRandomValue(&eller->rng, 0, 1) == 0));
+        if (eller->right[i]) eller->parent[a] = b;
+    }
+
+    eller->right[cells_x - 1] = 0;
+
+    for (int i = 0; i < cells_x; i++) eller->sets[i] = FindMazeEllerSet(eller->parent, eller->sets[i]);
+
+    // STEP 3: Every set joined down at least once, last set cell forced if none joined
+    // NOTE: counts used as remaining cells per set, parent reused as set joined down flag
+    for (int i = 0; i < cells_x; i++)
+    {
+        eller->counts[i] = 0;
+        eller->parent[i] = 0;
+    }
+
+    for (int i = 0; i < cells_x; i++) eller->counts[eller->sets[i]]++;
+
+    for (int i = 0; i < cells_x; i++)
+    {
+        int set = eller->sets[i];
+        eller->counts[set]--;
+
+        if (last) eller->down[i] = 0;
+        else eller->down[i] = (GetMazeRandomValue(&eller->rng, 0, 1) == 0) || ((eller->counts[set] == 0) && !eller->parent[set]);
+
+        if (eller->down[i]) eller->parent[set] = 1;
+    }
+
+    // STEP 4: Only cells joined down keep their set for next row
+    for (int i = 0; i < cells_x; i++)
+    {
+        if (!eller->down[i]) eller->sets[i] = -1;
+    }
+}
+
+#endif // MAZE_ALGO_IMPLEMENTATION
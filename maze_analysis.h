@@ -0,0 +1,309 @@
+/*******************************************************************************************
+*
+*   maze_analysis - Maze metrics and seed constraints
+*
+*   Maze metrics computed in one pass over cells: every walkable cell is joined with its
+*   walkable right and bottom neighbours (union-find, path halving), counting edges and
+*   cells degree on the way. Connected components, dead ends (degree 1), junctions (degree 3+),
+*   loops (independent cycles: edges - cells + components) and branching factor come from
+*   those counts; start and end connectivity is checked by union-find roots, start to end
+*   path length is only searched (breadth-first) when both are connected
+*
+*   Analyzer buffers are allocated once and reused, so millions of mazes can be analyzed
+*   without allocations (one analyzer per thread)
+*
+*   CONFIGURATION:
+*       #define MAZE_ANALYSIS_IMPLEMENTATION
+*           Generates the implementation of the module in the including file,
+*           only one translation unit should define it
+*
+*   DEPENDENCIES:
+*       maze_grid       - Maze cells data, walls are not walkable
+*       maze_system     - Timing (GetMazeTime())
+*
+*   NOTE: Module is window-free and does not depend on raylib
+*
+*   Copyright (c) 2024-2025 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#ifndef MAZE_ANALYSIS_H
+#define MAZE_ANALYSIS_H
+
+#include "maze_grid.h"
+#include "maze_system.h"
+
+// Maze metrics
+typedef struct MazeAnalysis {
+    int walkable;           // Walkable cells
+    int components;         // Connected walkable areas
+    int dead_ends;          // Walkable cells with one walkable neighbour
+    int junctions;          // Walkable cells with three or more walkable neighbours
+    int loops;              // Independent cycles (0 for perfect mazes)
+    float branching;        // Average exits per cell, excluding way in (cells with two or more exits)
+    bool solvable;          // End reachable from start
+    int path_length;        // Shortest path cells from start to end, both included (0 if not solvable)
+    double time;            // Analysis time in seconds
+} MazeAnalysis;
+
+// Maze analysis working buffers, reused between mazes up to analyzer size
+typedef struct MazeAnalyzer {
+    int capacity;           // Cells capacity
+    int *parent;            // Union-find parent cell, per cell
+    int *distance;          // Breadth-first distance from start, per cell
+    int *queue;             // Breadth-first cells queue
+} MazeAnalyzer;
+
+// Maze constraints, checked against maze metrics
+// NOTE: Negative limits are not checked
+typedef struct MazeConstraints {
+    bool solvable;          // End must be reachable from start
+    int min_path;           // Minimum path length
+    int max_path;           // Maximum path length
+    int min_dead_ends;      // Minimum dead ends
+    int max_dead_ends;      // Maximum dead ends
+    int min_loops;          // Minimum loops
+    int max_loops;          // Maximum loops
+    int max_components;     // Maximum connected areas
+} MazeConstraints;
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+MazeAnalyzer LoadMazeAnalyzer(int width, int height);               // Load analyzer buffers for mazes up to width*height cells
+void UnloadMazeAnalyzer(MazeAnalyzer *analyzer);                    // Unload analyzer buffers
+MazeAnalysis AnalyzeMaze(MazeAnalyzer *analyzer, MazeGrid grid, int start_x, int start_y, int end_x, int end_y); // Compute maze metrics
+MazeConstraints GetMazeConstraintsDefault(void);                    // Get constraints not checking anything
+bool CheckMazeConstraints(MazeAnalysis analysis, MazeConstraints constraints); // Check maze metrics meet all constraints
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif // MAZE_ANALYSIS_H
+
+/***********************************************************************************
+*
+*   MAZE_ANALYSIS IMPLEMENTATION
+*
+************************************************************************************/
+
+#if defined(MAZE_ANALYSIS_IMPLEMENTATION) && !defined(MAZE_ANALYSIS_IMPLEMENTATION_DONE)
+#define MAZE_ANALYSIS_IMPLEMENTATION_DONE
+
+#include <stdlib.h>     // Required for: malloc(), free()
+#include <string.h>     // Required for: memset()
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Declaration
+//----------------------------------------------------------------------------------
+static int FindMazeAnalysisRoot(int *parent, int cell);             // Find cell component root (path halving)
+static int GetMazePathLength(MazeAnalyzer *analyzer, MazeGrid grid, int start, int end); // Search start to end path length (breadth-first)
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+
+// Load analyzer buffers for mazes up to width*height cells
+MazeAnalyzer LoadMazeAnalyzer(int width, int height)
+{
+    MazeAnalyzer analyzer = { 0 };
+
+    if ((width <= 0) || (height <= 0)) return analyzer;
+
+    int count = width*height;
+    analyzer.parent = (int *)malloc(count*sizeof(int));
+    analyzer.distance = (int *)malloc(count*sizeof(int));
+    analyzer.queue = (int *)malloc(count*sizeof(int));
+
+    if ((analyzer.parent == NULL) || (analyzer.distance == NULL) || (analyzer.queue == NULL)) UnloadMazeAnalyzer(&analyzer);
+    else analyzer.capacity = count;
+
+    return analyzer;
+}
+
+// Unload analyzer buffers
+void UnloadMazeAnalyzer(MazeAnalyzer *analyzer)
+{
+    free(analyzer->parent);
+    free(analyzer->distance);
+    free(analyzer->queue);
+
+    *analyzer = (MazeAnalyzer){ 0 };
+}
+
+// Compute maze metrics
+// NOTE: Maze bigger than analyzer capacity is not analyzed (all metrics zero)
+MazeAnalysis AnalyzeMaze(MazeAnalyzer *analyzer, MazeGrid grid, int start_x, int start_y, int end_x, int end_y)
+{
+    MazeAnalysis analysis = { 0 };
+    int width = grid.width;
+    int count = grid.width*grid.height;
+
+    if ((grid.cells == NULL) || (count <= 0) || (count > analyzer->capacity)) return analysis;
+
+    double start_time = GetMazeTime();
+    int *parent = analyzer->parent;
+    int edges = 0;
+    int exits = 0;
+    int branch_cells = 0;
+
+    // One pass: union walkable cells with right and bottom neighbours, degree from all neighbours
+    // NOTE: Rows above and cells on the left are already joined, so every edge is joined once
+    for (int y = 0; y < grid.height; y++)
+    {
+        for (int x = 0; x < width; x++)
+        {
+            int cell = y*width + x;
+
+            if (grid.cells[cell] == MAZE_CELL_WALL) continue;
+
+            parent[cell] = cell;
+            analysis.walkable++;
+            analysis.components++;
+
+            int degree = 0;
+            if ((x > 0) && (grid.cells[cell - 1] != MAZE_CELL_WALL)) degree++;
+            if ((y > 0) && (grid.cells[cell - width] != MAZE_CELL_WALL)) degree++;
+
+            if ((x < (width - 1)) && (grid.cells[cell + 1] != MAZE_CELL_WALL)) degree++;
+            if ((y < (grid.height - 1)) && (grid.cells[cell + width] != MAZE_CELL_WALL)) degree++;
+
+            // Left and top neighbours already have a root, join them
+            for (int n = 0; n < 2; n++)
+            {
+                int neighbour = (n == 0)? cell - 1 : cell - width;
+
+                if ((n == 0) && (x == 0)) continue;
+                if ((n == 1) && (y == 0)) continue;
+                if (grid.cells[neighbour] == MAZE_CELL_WALL) continue;
+
+                edges++;
+
+                int root_a = FindMazeAnalysisRoot(parent, cell);
+                int root_b = FindMazeAnalysisRoot(parent, neighbour);
+
+                if (root_a != root_b)
+                {
+                    // NOTE: Lower index root kept, roots always precede their cells
+                    if (root_a < root_b) parent[root_b] = root_a;
+                    else parent[root_a] = root_b;
+                    analysis.components--;
+                }
+            }
+
+            if (degree == 1) analysis.dead_ends++;
+            else if (degree >= 3) analysis.junctions++;
+
+            if (degree >= 2)
+            {
+                exits += degree - 1;
+                branch_cells++;
+            }
+        }
+    }
+
+    analysis.loops = edges - analysis.walkable + analysis.components;
+    analysis.branching = (branch_cells > 0)? (float)exits/branch_cells : 0.0f;
+
+    bool ends_valid = IsMazeCellWalkable(grid, start_x, start_y) && IsMazeCellWalkable(grid, end_x, end_y);
+
+    if (ends_valid)
+    {
+        int start = start_y*width + start_x;
+        int end = end_y*width + end_x;
+
+        analysis.solvable = (FindMazeAnalysisRoot(parent, start) == FindMazeAnalysisRoot(parent, end));
+        if (analysis.solvable) analysis.path_length = GetMazePathLength(analyzer, grid, start, end);
+    }
+
+    analysis.time = GetMazeTime() - start_time;
+
+    return analysis;
+}
+
+// Get constraints not checking anything
+MazeConstraints GetMazeConstraintsDefault(void)
+{
+    MazeConstraints constraints = { false, -1, -1, -1, -1, -1, -1, -1 };
+
+    return constraints;
+}
+
+// Check maze metrics meet all constraints
+bool CheckMazeConstraints(MazeAnalysis analysis, MazeConstraints constraints)
+{
+    if (constraints.solvable && !analysis.solvable) return false;
+    if ((constraints.min_path >= 0) && (analysis.path_length < constraints.min_path)) return false;
+    if ((constraints.max_path >= 0) && (analysis.path_length > constraints.max_path)) return false;
+    if ((constraints.min_dead_ends >= 0) && (analysis.dead_ends < constraints.min_dead_ends)) return false;
+    if ((constraints.max_dead_ends >= 0) && (analysis.dead_ends > constraints.max_dead_ends)) return false;
+    if ((constraints.min_loops >= 0) && (analysis.loops < constraints.min_loops)) return false;
+    if ((constraints.max_loops >= 0) && (analysis.loops > constraints.max_loops)) return false;
+    if ((constraints.max_components >= 0) && (analysis.components > constraints.max_components)) return false;
+
+    return true;
+}
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Definition
+//----------------------------------------------------------------------------------
+
+// Find cell component root (path halving)
+static int FindMazeAnalysisRoot(int *parent, int cell)
+{
+    while (parent[cell] != cell)
+    {
+        parent[cell] = parent[parent[cell]];
+        cell = parent[cell];
+    }
+
+    return cell;
+}
+
+// Search start to end path length (breadth-first)
+// NOTE: Only called when both ends are connected, returns path cells (both ends included)
+static int GetMazePathLength(MazeAnalyzer *analyzer, MazeGrid grid, int start, int end)
+{
+    int width = grid.width;
+    int count = grid.width*grid.height;
+    int *distance = analyzer->distance;
+    int *queue = analyzer->queue;
+    int head = 0;
+    int tail = 0;
+
+    memset(distance, 0xff, count*sizeof(int));
+
+    distance[start] = 1;
+    queue[tail++] = start;
+
+    while (head < tail)
+    {
+        int cell = queue[head++];
+
+        if (cell == end) return distance[cell];
+
+        int x = cell%width;
+        int neighbours[4] = {
+            (x > 0)? cell - 1 : -1,
+            (x < (width - 1))? cell + 1 : -1,
+            (cell >= width)? cell - width : -1,
+            (cell < (count - width))? cell + width : -1
+        };
+
+        for (int n = 0; n < 4; n++)
+        {
+            int next = neighbours[n];
+
+            if ((next < 0) || (grid.cells[next] == MAZE_CELL_WALL) || (distance[next] >= 0)) continue;
+
+            distance[next] = distance[cell] + 1;
+            queue[tail++] = next;
+        }
+    }
+
+    return 0;
+}
+
+#endif // MAZE_ANALYSIS_IMPLEMENTATION
@@ -0,0 +1,511 @@
+/*******************************************************************************************
+*
+*   maze_cache - Content-addressed on-disk cache of generated mazes
+*
+*   Generated mazes are saved as maze files named by their generation key hash: algorithm,
+*   seed, size and grid parameters, plus algorithms and file format versions, so any change
+*   on generators output (MAZE_ALGO_VERSION) never returns outdated mazes. Cache is checked
+*   before generating, loading a cached maze skips generation entirely
+*
+*   Cached mazes are checked on loading: file data checksum must match (CheckMazeFileIntegrity())
+*   and file generation parameters (algorithm included) must match the key, so a key hash
+*   collision never returns another maze, damaged entries are removed and reported as
+*   misses. Cache size is bounded: once over its size limit, least recently used entries
+*   are removed (file modification time, updated on every hit)
+*
+*   Entries are written to a temporary file and renamed, so other processes sharing the
+*   cache directory never read partially written mazes. Temporary files names are unique
+*   (process id and process-wide counter), so processes saving the same maze at the same
+*   time never write the same temporary file
+*
+*   CONFIGURATION:
+*       #define MAZE_CACHE_IMPLEMENTATION
+*           Generates the implementation of the module in the including file,
+*           only one translation unit should define it
+*
+*   DEPENDENCIES:
+*       maze_grid       - Maze cells data
+*       maze_algo       - Generators version and maze ends (perfect mazes)
+*       maze_file       - Cached mazes files and integrity check
+*       maze_system     - Timing (GetMazeTime())
+*
+*   NOTE: Module is window-free and does not depend on raylib
+*
+*   NOTE: Cache is not thread-safe, it must be used by one thread at a time
+*
+*   Copyright (c) 2024-2025 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#ifndef MAZE_CACHE_H
+#define MAZE_CACHE_H
+
+#include "maze_grid.h"
+#include "maze_algo.h"
+#include "maze_file.h"
+#include "maze_system.h"
+
+#define MAZE_CACHE_PATH_SIZE    256     // Cache directory path max length (including terminator)
+
+// Maze cache key, generation parameters identifying a generated maze
+typedef struct MazeCacheKey {
+    int algorithm;              // Generation algorithm (MazeAlgorithm)
+    unsigned int seed;          // Generation seed
+    int width;                  // Maze width
+    int height;                 // Maze height
+    int spacing_rows;           // Maze points spacing, rows
+    int spacing_cols;           // Maze points spacing, columns
+    float point_chance;         // Maze point chance
+} MazeCacheKey;
+
+// Maze cache statistics, since cache loading
+typedef struct MazeCacheStats {
+    int hits;                   // Mazes loaded from cache
+    int misses;                 // Mazes not cached (or damaged)
+    int saved;                  // Mazes saved to cache
+    int damaged;                // Entries removed on loading, integrity check failed
+    int evicted;                // Entries removed to keep cache under its size limit
+    int entries;                // Entries in cache (last trim)
+    size_t size;                // Entries size in bytes
+    double time;                // Last load or save time in seconds
+} MazeCacheStats;
+
+// Maze cache, mazes files stored in a directory
+typedef struct MazeCache {
+    char path[MAZE_CACHE_PATH_SIZE]; // Cache directory
+    size_t max_size;            // Entries size limit in bytes
+    bool ready;                 // Cache directory available
+    MazeCacheStats stats;
+} MazeCache;
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+MazeCache LoadMazeCache(const char *path, size_t max_size);         // Load maze cache on directory (created if required), trimmed to size limit
+void UnloadMazeCache(MazeCache *cache);                             // Unload maze cache, entries are kept on disk
+unsigned long long GetMazeCacheKeyHash(MazeCacheKey key);           // Get cache key hash (FNV-1a, 64 bit), including versions
+MazeGrid LoadMazeCacheGrid(MazeCache *cache, MazeCacheKey key);     // Load cached maze, empty grid if not cached (or damaged)
+bool SaveMazeCacheGrid(MazeCache *cache, MazeCacheKey key, MazeGrid grid); // Save generated maze to cache, trimming cache if over size limit
+int TrimMazeCache(MazeCache *cache);                                // Remove least recently used entries until under size limit, returns entries removed
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif // MAZE_CACHE_H
+
+/***********************************************************************************
+*
+*   MAZE_CACHE IMPLEMENTATION
+*
+************************************************************************************/
+
+#if defined(MAZE_CACHE_IMPLEMENTATION) && !defined(MAZE_CACHE_IMPLEMENTATION_DONE)
+#define MAZE_CACHE_IMPLEMENTATION_DONE
+
+#include <stdio.h>      // Required for: snprintf(), remove(), rename()
+#include <stdlib.h>     // Required for: realloc(), free(), qsort()
+#include <string.h>     // Required for: strlen(), strcmp(), memcpy()
+
+#if defined(_WIN32)
+    #define WIN32_LEAN_AND_MEAN
+    #define NOGDI
+    #define NOUSER
+    #include <windows.h>
+#else
+    #include <dirent.h>         // Required for: opendir(), readdir(), closedir()
+    #include <sys/stat.h>       // Required for: stat(), mkdir()
+    #include <utime.h>          // Required for: utime()
+    #include <unistd.h>         // Required for: getpid()
+#endif
+
+#define MAZE_CACHE_FILE_EXT         ".maze"                         // Cache entries extension
+#define MAZE_CACHE_FILE_NAME_SIZE   (MAZE_CACHE_PATH_SIZE + 64)     // Cache directory path and entry (or temporary file) name
+
+// Maze cache entry, listed from cache directory
+typedef struct MazeCacheEntry {
+    char name[32];              // Entry file name
+    size_t size;                // Entry file size
+    long long time;             // Entry last use time (file modification time, nanoseconds if available)
+} MazeCacheEntry;
+
+//----------------------------------------------------------------------------------
+// Global Variables Definition
+//----------------------------------------------------------------------------------
+static volatile unsigned int maze_cache_temp_count = 0;            // Temporary files written, all threads
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Declaration
+//----------------------------------------------------------------------------------
+static void GetMazeCacheFileName(const MazeCache *cache, MazeCacheKey key, const char *ext, char *fileName, int size); // Get entry file name for key
+static MazeFileInfo GetMazeCacheFileInfo(MazeCacheKey key);         // Get maze file info for key (generation parameters and maze ends)
+static int ListMazeCacheEntries(const MazeCache *cache, MazeCacheEntry **entries); // List cache entries, returns entries count
+static int CompareMazeCacheEntries(const void *a, const void *b);   // Compare entries last use time, oldest first
+static bool MakeMazeCacheDirectory(const char *path);               // Create directory if not existing
+static void TouchMazeCacheFile(const char *fileName);               // Update file modification time to current time
+static bool ReplaceMazeCacheFile(const char *source, const char *target); // Rename file, replacing existing one
+static void GetMazeCacheTempFileName(const MazeCache *cache, MazeCacheKey key, char *fileName, int size); // Get unique temporary file name for key entry
+static bool IsMazeCacheFile(const char *fileName);                  // Check if file exists
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+
+// Load maze cache on directory (created if required), trimmed to size limit
+// NOTE: Cache is not ready (nothing cached or loaded) if directory can not be created
+MazeCache LoadMazeCache(const char *path, size_t max_size)
+{
+    MazeCache cache = { 0 };
+
+    if ((path == NULL) || (strlen(path) >= MAZE_CACHE_PATH_SIZE)) return cache;
+
+    memcpy(cache.path, path, strlen(path) + 1);
+    cache.max_size = max_size;
+    cache.ready = MakeMazeCacheDirectory(path);
+
+    if (cache.ready) TrimMazeCache(&cache);
+
+    return cache;
+}
+
+// Unload maze cache, entries are kept on disk
+void UnloadMazeCache(MazeCache *cache)
+{
+    *cache = (MazeCache){ 0 };
+}
+
+// Get cache key hash (FNV-1a, 64 bit), including versions
+// NOTE: Point chance only used by grid algorithm, but hashed for all, keys stay simple
+unsigned long long GetMazeCacheKeyHash(MazeCacheKey key)
+{
+    unsigned int chance = 0;
+    memcpy(&chance, &key.point_chance, sizeof(chance));
+
+    unsigned int values[9] = { MAZE_ALGO_VERSION, MAZE_FILE_VERSION, (unsigned int)key.algorithm, key.seed,
+        (unsigned int)key.width, (unsigned int)key.height, (unsigned int)key.spacing_rows, (unsigned int)key.spacing_cols, chance };
+    unsigned long long hash = 14695981039346656037ULL;
+
+    for (int i = 0; i < 9; i++)
+    {
+        for (int k = 0; k < 4; k++) hash = (hash ^ ((values[i] >> (8*k)) & 0xff))*1099511628211ULL;
+    }
+
+    return hash;
+}
+
+// Load cached maze, empty grid if not cached (or damaged)
+// NOTE: Entries failing integrity check or not matching key parameters are removed
+MazeGrid LoadMazeCacheGrid(MazeCache *cache, MazeCacheKey key)
+{
+    MazeGrid grid = { 0 };
+
+    if (!cache->ready) return grid;
+
+    double start_time = GetMazeTime();
+    char fileName[MAZE_CACHE_FILE_NAME_SIZE] = { 0 };
+    GetMazeCacheFileName(cache, key, MAZE_CACHE_FILE_EXT, fileName, MAZE_CACHE_FILE_NAME_SIZE);
+
+    MazeFile file = LoadMazeFile(fileName);
+
+    if (IsMazeFileValid(file))
+    {
+        MazeFileInfo info = GetMazeCacheFileInfo(key);
+        bool matching = (file.width == key.width) && (file.height == key.height) && (file.info.seed == info.seed) &&
+            (file.info.spacing_rows == info.spacing_rows) && (file.info.spacing_cols == info.spacing_cols) &&
+            (file.info.point_chance == info.point_chance) && (file.info.algorithm == info.algorithm);
+
+        if (matching && CheckMazeFileIntegrity(file)) grid = LoadMazeGridFromFile(file);
+
+        UnloadMazeFile(&file);
+
+        if (grid.cells == NULL)
+        {
+            remove(fileName);
+            cache->stats.damaged++;
+        }
+        else TouchMazeCacheFile(fileName);
+    }
+    else if (remove(fileName) == 0) cache->stats.damaged++;     // Existing but not loadable (i.e. truncated header)
+
+    if (grid.cells != NULL) cache->stats.hits++;
+    else cache->stats.misses++;
+
+    cache->stats.time = GetMazeTime() - start_time;
+
+    return grid;
+}
+
+// Save generated maze to cache, trimming cache if over size limit
+// NOTE: Maze written to a unique temporary file first, renamed once complete. Entries saved
+// again (i.e. by another process sharing the cache) are not counted twice
+bool SaveMazeCacheGrid(MazeCache *cache, MazeCacheKey key, MazeGrid grid)
+{
+    if (!cache->ready || (grid.cells == NULL) || (grid.width != key.width) || (grid.height != key.height)) return false;
+
+    double start_time = GetMazeTime();
+    char fileName[MAZE_CACHE_FILE_NAME_SIZE] = { 0 };
+    char tempFileName[MAZE_CACHE_FILE_NAME_SIZE] = { 0 };
+    GetMazeCacheFileName(cache, key, MAZE_CACHE_FILE_EXT, fileName, MAZE_CACHE_FILE_NAME_SIZE);
+    GetMazeCacheTempFileName(cache, key, tempFileName, MAZE_CACHE_FILE_NAME_SIZE);
+
+    bool success = SaveMazeFile(tempFileName, grid, NULL, GetMazeCacheFileInfo(key));
+    bool existing = IsMazeCacheFile(fileName);
+
+    if (success) success = ReplaceMazeCacheFile(tempFileName, fileName);
+    if (!success) remove(tempFileName);
+
+    if (success)
+    {
+        cache->stats.saved++;
+
+        if (!existing)
+        {
+            cache->stats.entries++;
+            cache->stats.size += (size_t)MAZE_FILE_HEADER_SIZE + (((size_t)(grid.width + 3)/4*grid.height + 3)/4)*4;
+        }
+
+        if (cache->stats.size > cache->max_size) TrimMazeCache(cache);
+    }
+
+    cache->stats.time = GetMazeTime() - start_time;
+
+    return success;
+}
+
+// Remove least recently used entries until under size limit, returns entries removed
+// NOTE: Cache size and entries count are measured again from directory entries
+int TrimMazeCache(MazeCache *cache)
+{
+    if (!cache->ready) return 0;
+
+    MazeCacheEntry *entries = NULL;
+    int count = ListMazeCacheEntries(cache, &entries);
+    int removed = 0;
+    size_t size = 0;
+
+    for (int i = 0; i < count; i++) size += entries[i].size;
+
+    if (size > cache->max_size)
+    {
+        qsort(entries, count, sizeof(MazeCacheEntry), CompareMazeCacheEntries);
+
+        for (int i = 0; (i < count) && (size > cache->max_size); i++)
+        {
+            char fileName[MAZE_CACHE_FILE_NAME_SIZE] = { 0 };
+            snprintf(fileName, MAZE_CACHE_FILE_NAME_SIZE, "%s/%s", cache->path, entries[i].name);
+
+            if (remove(fileName) == 0)
+            {
+                size -= entries[i].size;
+                removed++;
+            }
+        }
+    }
+
+    free(entries);
+
+    cache->stats.evicted += removed;
+    cache->stats.entries = count - removed;
+    cache->stats.size = size;
+
+    return removed;
+}
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Definition
+//----------------------------------------------------------------------------------
+
+// Get entry file name for key
+static void GetMazeCacheFileName(const MazeCache *cache, MazeCacheKey key, const char *ext, char *fileName, int size)
+{
+    snprintf(fileName, size, "%s/%016llx%s", cache->path, GetMazeCacheKeyHash(key), ext);
+}
+
+// Get maze file info for key (generation parameters and maze ends)
+// NOTE: Same maze ends than the game, so cached mazes can also be loaded as maze files
+static MazeFileInfo GetMazeCacheFileInfo(MazeCacheKey key)
+{
+    const MazeGenerator *generator = GetMazeGenerator(key.algorithm);
+    bool perfect = (generator != NULL) && generator->perfect;
+    int end_x = perfect? GetMazePerfectLast(key.width) : key.width - 2;
+    int end_y = perfect? GetMazePerfectLast(key.height) : key.height - 2;
+
+    return (MazeFileInfo){ key.seed, key.spacing_rows, key.spacing_cols, key.point_chance, 1, 1, end_x, end_y, key.algorithm };
+}
+
+// List cache entries, returns entries count
+// NOTE: Only maze files named by key hash are listed, temporary files are not cache entries
+static int ListMazeCacheEntries(const MazeCache *cache, MazeCacheEntry **entries)
+{
+    int count = 0;
+    int capacity = 0;
+    size_t ext_length = strlen(MAZE_CACHE_FILE_EXT);
+
+#if defined(_WIN32)
+    char pattern[MAZE_CACHE_FILE_NAME_SIZE] = { 0 };
+    snprintf(pattern, MAZE_CACHE_FILE_NAME_SIZE, "%s/*" MAZE_CACHE_FILE_EXT, cache->path);
+
+    WIN32_FIND_DATAA data = { 0 };
+    HANDLE find = FindFirstFileA(pattern, &data);
+    bool found = (find != INVALID_HANDLE_VALUE);
+
+    while (found)
+    {
+        const char *name = data.cFileName;
+        size_t length = strlen(name);
+
+        if (!(data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) && (length == (16 + ext_length)))
+        {
+            if (count == capacity)
+            {
+                capacity = (capacity > 0)? capacity*2 : 64;
+                MazeCacheEntry *grown = (MazeCacheEntry *)realloc(*entries, capacity*sizeof(MazeCacheEntry));
+                if (grown == NULL) break;
+                *entries = grown;
+            }
+
+            MazeCacheEntry *entry = &(*entries)[count++];
+            memcpy(entry->name, name, length + 1);
+            entry->size = ((size_t)data.nFileSizeHigh << 32) | data.nFileSizeLow;
+            entry->time = ((long long)data.ftLastWriteTime.dwHighDateTime << 32) | data.ftLastWriteTime.dwLowDateTime;
+        }
+
+        found = FindNextFileA(find, &data);
+    }
+
+    if (find != INVALID_HANDLE_VALUE) FindClose(find);
+#else
+    DIR *dir = opendir(cache->path);
+    struct dirent *item = NULL;
+
+    while ((dir != NULL) && ((item = readdir(dir)) != NULL))
+    {
+        const char *name = item->d_name;
+        size_t length = strlen(name);
+
+        if ((length != (16 + ext_length)) || (strcmp(name + 16, MAZE_CACHE_FILE_EXT) != 0)) continue;
+
+        if (count == capacity)
+        {
+            capacity = (capacity > 0)? capacity*2 : 64;
+            MazeCacheEntry *grown = (MazeCacheEntry *)realloc(*entries, capacity*sizeof(MazeCacheEntry));
+            if (grown == NULL) break;
+            *entries = grown;
+        }
+
+        // NOTE: Entry only counted if it is a regular file
+        MazeCacheEntry *entry = &(*entries)[count];
+        char fileName[MAZE_CACHE_FILE_NAME_SIZE] = { 0 };
+        struct stat info = { 0 };
+
+        memcpy(entry->name, name, length + 1);
+        snprintf(fileName, MAZE_CACHE_FILE_NAME_SIZE, "%s/%s", cache->path, entry->name);
+
+        if ((stat(fileName, &info) != 0) || !S_ISREG(info.st_mode)) continue;
+
+        count++;
+        entry->size = (size_t)info.st_size;
+    #if defined(__APPLE__)
+        entry->time = (long long)info.st_mtimespec.tv_sec*1000000000LL + info.st_mtimespec.tv_nsec;
+    #else
+        entry->time = (long long)info.st_mtim.tv_sec*1000000000LL + info.st_mtim.tv_nsec;
+    #endif
+    }
+
+    if (dir != NULL) closedir(dir);
+#endif
+
+    return count;
+}
+
+// Compare entries last use time, oldest first
+static int CompareMazeCacheEntries(const void *a, const void *b)
+{
+    const MazeCacheEntry *entry_a = (const MazeCacheEntry *)a;
+    const MazeCacheEntry *entry_b = (const MazeCacheEntry *)b;
+
+    if (entry_a->time != entry_b->time) return (entry_a->time < entry_b->time)? -1 : 1;
+
+    return strcmp(entry_a->name, entry_b->name);
+}
+
+// Create directory if not existing
+static bool MakeMazeCacheDirectory(const char *path)
+{
+#if defined(_WIN32)
+    DWORD attributes = GetFileAttributesA(path);
+
+    if ((attributes != INVALID_FILE_ATTRIBUTES) && (attributes & FILE_ATTRIBUTE_DIRECTORY)) return true;
+
+    return CreateDirectoryA(path, NULL);
+#else
+    struct stat info = { 0 };
+
+    if (stat(path, &info) == 0) return S_ISDIR(info.st_mode);
+
+    return (mkdir(path, 0755) == 0);
+#endif
+}
+
+// Update file modification time to current time
+static void TouchMazeCacheFile(const char *fileName)
+{
+#if defined(_WIN32)
+    HANDLE file = CreateFileA(fileName, FILE_WRITE_ATTRIBUTES, FILE_SHARE_READ | FILE_SHARE_WRITE, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+
+    if (file != INVALID_HANDLE_VALUE)
+    {
+        FILETIME now = { 0 };
+        GetSystemTimeAsFileTime(&now);
+        SetFileTime(file, NULL, NULL, &now);
+        CloseHandle(file);
+    }
+#else
+    utime(fileName, NULL);
+#endif
+}
+
+// Rename file, replacing existing one
+static bool ReplaceMazeCacheFile(const char *source, const char *target)
+{
+#if defined(_WIN32)
+    return MoveFileExA(source, target, MOVEFILE_REPLACE_EXISTING);
+#else
+    return (rename(source, target) == 0);
+#endif
+}
+
+// Get unique temporary file name for key entry
+// NOTE: Process id keeps names unique across processes, counter across threads and saves
+static void GetMazeCacheTempFileName(const MazeCache *cache, MazeCacheKey key, char *fileName, int size)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    unsigned int count = __atomic_fetch_add(&maze_cache_temp_count, 1, __ATOMIC_RELAXED);
+#else
+    unsigned int count = maze_cache_temp_count++;
+#endif
+#if defined(_WIN32)
+    unsigned long pid = (unsigned long)GetCurrentProcessId();
+#else
+    unsigned long pid = (unsigned long)getpid();
+#endif
+    char ext[48] = { 0 };
+
+    snprintf(ext, sizeof(ext), ".%lu.%u.tmp", pid, count);
+    GetMazeCacheFileName(cache, key, ext, fileName, size);
+}
+
+// Check if file exists
+static bool IsMazeCacheFile(const char *fileName)
+{
+#if defined(_WIN32)
+    return (GetFileAttributesA(fileName) != INVALID_FILE_ATTRIBUTES);
+#else
+    struct stat info = { 0 };
+
+    return (stat(fileName, &info) == 0);
+#endif
+}
+
+#endif // MAZE_CACHE_IMPLEMENTATION
@@ -0,0 +1,215 @@
+/*******************************************************************************************
+*
+*   maze_dirty - Maze cells edits tracking, gathered into dirty rectangles
+*
+*   Maze area is split into square tiles, edited cells mark their tile as dirty and
+*   dirty tiles are merged into horizontal runs, so only changed regions of the maze
+*   texture need to be uploaded (or nothing at all if nothing changed)
+*
+*   CONFIGURATION:
+*       #define MAZE_DIRTY_IMPLEMENTATION
+*           Generates the implementation of the module in the including file,
+*           only one translation unit should define it
+*
+*   NOTE: Module is window-free and does not depend on raylib
+*
+*   Copyright (c) 2024-2025 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#ifndef MAZE_DIRTY_H
+#define MAZE_DIRTY_H
+
+#include <stdbool.h>    // Required for: bool
+
+// Dirty rectangle, in cells
+typedef struct MazeDirtyRect {
+    int x;
+    int y;
+    int width;
+    int height;
+} MazeDirtyRect;
+
+// Maze dirty regions tracker
+typedef struct MazeDirtyRegions {
+    int width;                  // Tracked area width in cells
+    int height;                 // Tracked area height in cells
+    int tile_size;              // Dirty tile size in cells
+    int tiles_x;                // Number of tiles horizontally
+    int tiles_y;                // Number of tiles vertically
+
+    unsigned char *tiles;       // Tiles dirty flag
+    int *dirty_tiles;           // Dirty tiles indices, in marking order
+    int dirty_count;            // Number of dirty tiles
+
+    unsigned char *staging;     // Staging buffer for one tiles row of data (width*tile_size cells)
+    int cell_bytes;             // Bytes per cell in staging buffer
+} MazeDirtyRegions;
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+MazeDirtyRegions LoadMazeDirtyRegions(int width, int height, int tile_size, int cell_bytes); // Load dirty regions tracker
+void UnloadMazeDirtyRegions(MazeDirtyRegions *dirty);                       // Unload dirty regions tracker
+void ClearMazeDirtyRegions(MazeDirtyRegions *dirty);                        // Clear all dirty regions
+void MarkMazeCellDirty(MazeDirtyRegions *dirty, int x, int y);              // Mark cell as dirty
+void MarkMazeAreaDirty(MazeDirtyRegions *dirty, int x, int y, int width, int height); // Mark cells area as dirty
+bool PopMazeDirtyRect(MazeDirtyRegions *dirty, MazeDirtyRect *rect);        // Get next dirty rectangle (clearing it), false if none left
+
+// Copy rectangle cells from full area data into staging buffer, rows packed,
+// returns staging buffer pointer (or NULL if rectangle does not fit)
+const void *CopyMazeDirtyRect(MazeDirtyRegions *dirty, const void *data, MazeDirtyRect rect);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif // MAZE_DIRTY_H
+
+/***********************************************************************************
+*
+*   MAZE_DIRTY IMPLEMENTATION
+*
+************************************************************************************/
+
+#if defined(MAZE_DIRTY_IMPLEMENTATION) && !defined(MAZE_DIRTY_IMPLEMENTATION_DONE)
+#define MAZE_DIRTY_IMPLEMENTATION_DONE
+
+#include <stdlib.h>     // Required for: calloc(), malloc(), free()
+#include <string.h>     // Required for: memcpy()
+
+// Load dirty regions tracker
+MazeDirtyRegions LoadMazeDirtyRegions(int width, int height, int tile_size, int cell_bytes)
+{
+    MazeDirtyRegions dirty = { 0 };
+
+    if ((width <= 0) || (height <= 0) || (tile_size <= 0)) return dirty;
+
+    dirty.width = width;
+    dirty.height = height;
+    dirty.tile_size = tile_size;
+    dirty.tiles_x = (width + tile_size - 1)/tile_size;
+    dirty.tiles_y = (height + tile_size - 1)/tile_size;
+    dirty.cell_bytes = cell_bytes;
+
+    dirty.tiles = (unsigned char *)calloc((size_t)dirty.tiles_x*dirty.tiles_y, sizeof(unsigned char));
+    dirty.dirty_tiles = (int *)malloc((size_t)dirty.tiles_x*dirty.tiles_y*sizeof(int));
+    if (cell_bytes > 0) dirty.staging = (unsigned char *)malloc((size_t)width*tile_size*cell_bytes);
+
+    return dirty;
+}
+
+// Unload dirty regions tracker
+void UnloadMazeDirtyRegions(MazeDirtyRegions *dirty)
+{
+    free(dirty->tiles);
+    free(dirty->dirty_tiles);
+    free(dirty->staging);
+
+    *dirty = (MazeDirtyRegions){ 0 };
+}
+
+// Clear all dirty regions
+void ClearMazeDirtyRegions(MazeDirtyRegions *dirty)
+{
+    for (int i = 0; i < dirty->dirty_count; i++) dirty->tiles[dirty->dirty_tiles[i]] = 0;
+
+    dirty->dirty_count = 0;
+}
+
+// Mark cell as dirty
+void MarkMazeCellDirty(MazeDirtyRegions *dirty, int x, int y)
+{
+    if ((x < 0) || (x >= dirty->width) || (y < 0) || (y >= dirty->height)) return;
+
+    int tile = (y/dirty->tile_size)*dirty->tiles_x + x/dirty->tile_size;
+
+    if (!dirty->tiles[tile])
+    {
+        dirty->tiles[tile] = 1;
+        dirty->dirty_tiles[dirty->dirty_count++] = tile;
+    }
+}
+
+// Mark cells area as dirty
+void MarkMazeAreaDirty(MazeDirtyRegions *dirty, int x, int y, int width, int height)
+{
+    // Clamp area to tracked limits
+    if (x < 0) { width += x; x = 0; }
+    if (y < 0) { height += y; y = 0; }
+    if ((x + width) > dirty->width) width = dirty->width - x;
+    if ((y + height) > dirty->height) height = dirty->height - y;
+    if ((width <= 0) || (height <= 0)) return;
+
+    int min_tx = x/dirty->tile_size;
+    int min_ty = y/dirty->tile_size;
+    int max_tx = (x + width - 1)/dirty->tile_size;
+    int max_ty = (y + height - 1)/dirty->tile_size;
+
+    for (int ty = min_ty; ty <= max_ty; ty++)
+    {
+        for (int tx = min_tx; tx <= max_tx; tx++)
+        {
+            int tile = ty*dirty->tiles_x + tx;
+
+            if (!dirty->tiles[tile])
+            {
+                dirty->tiles[tile] = 1;
+                dirty->dirty_tiles[dirty->dirty_count++] = tile;
+            }
+        }
+    }
+}
+
+// Get next dirty rectangle (clearing it), false if none left
+// NOTE: Consecutive dirty tiles in the same tiles row are merged into a single rectangle
+bool PopMazeDirtyRect(MazeDirtyRegions *dirty, MazeDirtyRect *rect)
+{
+    while (dirty->dirty_count > 0)
+    {
+        int tile = dirty->dirty_tiles[--dirty->dirty_count];
+
+        // Tile could have been already merged into a previous rectangle
+        if (!dirty->tiles[tile]) continue;
+
+        int ty = tile/dirty->tiles_x;
+        int min_tx = tile%dirty->tiles_x;
+        int max_tx = min_tx;
+
+        dirty->tiles[tile] = 0;
+        while ((min_tx > 0) && dirty->tiles[ty*dirty->tiles_x + min_tx - 1]) { min_tx--; dirty->tiles[ty*dirty->tiles_x + min_tx] = 0; }
+        while ((max_tx < (dirty->tiles_x - 1)) && dirty->tiles[ty*dirty->tiles_x + max_tx + 1]) { max_tx++; dirty->tiles[ty*dirty->tiles_x + max_tx] = 0; }
+
+        rect->x = min_tx*dirty->tile_size;
+        rect->y = ty*dirty->tile_size;
+        rect->width = (max_tx + 1)*dirty->tile_size - rect->x;
+        rect->height = dirty->tile_size;
+
+        // Clamp last tiles to tracked limits
+        if ((rect->x + rect->width) > dirty->width) rect->width = dirty->width - rect->x;
+        if ((rect->y + rect->height) > dirty->height) rect->height = dirty->height - rect->y;
+
+        return true;
+    }
+
+    return false;
+}
+
+// Copy rectangle cells from full area data into staging buffer, rows packed
+const void *CopyMazeDirtyRect(MazeDirtyRegions *dirty, const void *data, MazeDirtyRect rect)
+{
+    if ((dirty->staging == NULL) || (rect.height > dirty->tile_size) || (rect.width > dirty->width)) return NULL;
+
+    const unsigned char *src = (const unsigned char *)data;
+    size_t row_bytes = (size_t)rect.width*dirty->cell_bytes;
+
+    for (int y = 0; y < rect.height; y++)
+    {
+        memcpy(dirty->staging + y*row_bytes, src + ((size_t)(rect.y + y)*dirty->width + rect.x)*dirty->cell_bytes, row_bytes);
+    }
+
+    return dirty->staging;
+}
+
+#endif // MAZE_DIRTY_IMPLEMENTATION
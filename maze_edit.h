@@ -0,0 +1,406 @@
+/*******************************************************************************************
+*
+*   maze_edit - Maze editor bulk edit tools: strokes, lines, rectangles and flood fill
+*
+*   Tools work directly on maze cells storage and gather all edited cells into a batch,
+*   as horizontal spans of cells with the same previous value, so a whole operation is
+*   committed at once by the caller (items, path, undo history) and maze textures are
+*   updated only once, for the batch bounding rectangle
+*
+*   Lines are 4-connected (consecutive cells share an edge, no diagonal steps), so painted
+*   paths are always walkable and painted walls are never crossed diagonally. Used to
+*   interpolate mouse strokes between frames, fast mouse movement does not leave gaps
+*
+*   Flood fill uses a scanline algorithm: full cells runs are filled at once and only one
+*   segment per run is pushed for the next row, fill memory is proportional to runs, not cells
+*
+*   Painted values are edit values (cell type | (item type << 2)), only cell type is written
+*   to cells, items are kept by caller. Item cells are always added to batch when painting
+*   items, item type could change
+*
+*   CONFIGURATION:
+*       #define MAZE_EDIT_IMPLEMENTATION
+*           Generates the implementation of the module in the including file,
+*           only one translation unit should define it
+*
+*   DEPENDENCIES:
+*       maze_grid       - Maze cells data
+*       maze_dirty      - Dirty rectangle, for batch bounds
+*
+*   NOTE: Module is window-free and does not depend on raylib
+*
+*   Copyright (c) 2024-2025 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#ifndef MAZE_EDIT_H
+#define MAZE_EDIT_H
+
+#include "maze_grid.h"
+#include "maze_dirty.h"
+
+// Maze edit span, horizontal run of edited cells
+typedef struct MazeEditSpan {
+    int x;                      // First cell x
+    int y;                      // Cells row
+    int length;                 // Number of cells
+    unsigned char before;       // Cells type before edit
+} MazeEditSpan;
+
+// Maze edit batch, cells edited by one operation
+typedef struct MazeEditBatch {
+    int value;                  // Painted edit value (cell type | (item type << 2))
+    int count;                  // Number of cells edited
+    MazeDirtyRect bounds;       // Edited cells bounding rectangle
+
+    MazeEditSpan *spans;        // Edited cells spans
+    int span_count;             // Number of spans
+    int span_capacity;          // Spans array size
+
+    int *stack;                 // Flood fill segments stack (parent row, x1, x2, direction)
+    int stack_capacity;         // Segments stack size, in segments
+} MazeEditBatch;
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+MazeEditBatch LoadMazeEditBatch(int capacity);                     // Load edit batch, spans capacity grows as required
+void UnloadMazeEditBatch(MazeEditBatch *batch);                     // Unload edit batch
+void ClearMazeEditBatch(MazeEditBatch *batch);                      // Clear edit batch, for a new operation
+bool HasMazeEditBatchWalls(const MazeEditBatch *batch);             // Check if batch paints walls or paints over walls (cells walkability changed)
+
+int PaintMazeCell(MazeGrid *grid, MazeEditBatch *batch, int x, int y, int value);                     // Paint one cell, returns cells edited
+int PaintMazeLine(MazeGrid *grid, MazeEditBatch *batch, int x0, int y0, int x1, int y1, int value);   // Paint 4-connected line, returns cells edited
+int PaintMazeRect(MazeGrid *grid, MazeEditBatch *batch, int x0, int y0, int x1, int y1, int value, bool filled); // Paint rectangle (outline or filled) between corners, returns cells edited
+int FloodFillMaze(MazeGrid *grid, MazeEditBatch *batch, int x, int y, int value);                     // Flood fill cells region (4-connected, same type than seed), returns cells edited
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif // MAZE_EDIT_H
+
+/***********************************************************************************
+*
+*   MAZE_EDIT IMPLEMENTATION
+*
+************************************************************************************/
+
+#if defined(MAZE_EDIT_IMPLEMENTATION) && !defined(MAZE_EDIT_IMPLEMENTATION_DONE)
+#define MAZE_EDIT_IMPLEMENTATION_DONE
+
+#include <stdlib.h>     // Required for: malloc(), realloc(), free(), abs()
+#include <string.h>     // Required for: memset(), memchr(), memcpy()
+
+#define MAZE_EDIT_MIN_CAPACITY      64
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Declaration
+//----------------------------------------------------------------------------------
+static bool AddMazeEditSpan(MazeEditBatch *batch, int x, int y, int length, int before); // Add edited cells span, merged with previous span if possible
+static int PaintMazeSpan(MazeGrid *grid, MazeEditBatch *batch, int x0, int x1, int y, int value); // Paint cells row range (clipped), returns cells edited
+static bool PushMazeFillSegment(MazeEditBatch *batch, int *count, int height, int y, int x1, int x2, int dy); // Push flood fill segment if next row is inside maze, stack grows as required
+static int FindMazeCellOther(const unsigned char *row, int x, int end, unsigned char type); // Find first cell in [x, end) with type other than type, end if none
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+
+// Load edit batch, spans capacity grows as required
+MazeEditBatch LoadMazeEditBatch(int capacity)
+{
+    MazeEditBatch batch = { 0 };
+
+    if (capacity < MAZE_EDIT_MIN_CAPACITY) capacity = MAZE_EDIT_MIN_CAPACITY;
+
+    batch.spans = (MazeEditSpan *)malloc((size_t)capacity*sizeof(MazeEditSpan));
+    if (batch.spans != NULL) batch.span_capacity = capacity;
+
+    return batch;
+}
+
+// Unload edit batch
+void UnloadMazeEditBatch(MazeEditBatch *batch)
+{
+    free(batch->spans);
+    free(batch->stack);
+
+    *batch = (MazeEditBatch){ 0 };
+}
+
+// Clear edit batch, for a new operation
+void ClearMazeEditBatch(MazeEditBatch *batch)
+{
+    batch->value = 0;
+    batch->count = 0;
+    batch->bounds = (MazeDirtyRect){ 0 };
+    batch->span_count = 0;
+}
+
+// Check if batch paints walls or paints over walls (cells walkability changed)
+// NOTE: Path and flow field only depend on walkability, other batches do not require updating them
+bool HasMazeEditBatchWalls(const MazeEditBatch *batch)
+{
+    if ((batch->count > 0) && ((batch->value & 0x03) == MAZE_CELL_WALL)) return true;
+
+    for (int i = 0; i < batch->span_count; i++)
+    {
+        if (batch->spans[i].before == MAZE_CELL_WALL) return true;
+    }
+
+    return false;
+}
+
+// Paint one cell, returns cells edited
+int PaintMazeCell(MazeGrid *grid, MazeEditBatch *batch, int x, int y, int value)
+{
+    batch->value = value;
+
+    return PaintMazeSpan(grid, batch, x, x, y, value);
+}
+
+// Paint 4-connected line, returns cells edited
+// NOTE: Bresenham line stepping only one axis at a time, cells out of maze are skipped
+int PaintMazeLine(MazeGrid *grid, MazeEditBatch *batch, int x0, int y0, int x1, int y1, int value)
+{
+    int dx = abs(x1 - x0);
+    int dy = -abs(y1 - y0);
+    int sx = (x0 < x1)? 1 : -1;
+    int sy = (y0 < y1)? 1 : -1;
+    int error = dx + dy;
+    int edited = 0;
+
+    batch->value = value;
+
+    while (true)
+    {
+        edited += PaintMazeSpan(grid, batch, x0, x0, y0, value);
+
+        if ((x0 == x1) && (y0 == y1)) break;
+
+        // Step the axis that keeps the cell closest to the ideal line
+        if ((2*error - dy) > (dx - 2*error))
+        {
+            error += dy;
+            x0 += sx;
+        }
+        else
+        {
+            error += dx;
+            y0 += sy;
+        }
+    }
+
+    return edited;
+}
+
+// Paint rectangle (outline or filled) between corners, returns cells edited
+int PaintMazeRect(MazeGrid *grid, MazeEditBatch *batch, int x0, int y0, int x1, int y1, int value, bool filled)
+{
+    int min_x = (x0 < x1)? x0 : x1;
+    int max_x = (x0 < x1)? x1 : x0;
+    int min_y = (y0 < y1)? y0 : y1;
+    int max_y = (y0 < y1)? y1 : y0;
+    int edited = 0;
+
+    batch->value = value;
+
+    for (int y = min_y; y <= max_y; y++)
+    {
+        if ((y < 0) || (y >= grid->height)) continue;
+
+        if (filled || (y == min_y) || (y == max_y)) edited += PaintMazeSpan(grid, batch, min_x, max_x, y, value);
+        else
+        {
+            edited += PaintMazeSpan(grid, batch, min_x, min_x, y, value);
+            if (max_x != min_x) edited += PaintMazeSpan(grid, batch, max_x, max_x, y, value);
+        }
+    }
+
+    return edited;
+}
+
+// Flood fill cells region (4-connected, same type than seed), returns cells edited
+// NOTE: Scanline fill using rows segments (Heckbert's seed fill): every segment stores its parent
+// row cells range, new row is filled in runs and only cells beyond parent range are checked back
+int FloodFillMaze(MazeGrid *grid, MazeEditBatch *batch, int x, int y, int value)
+{
+    batch->value = value;
+
+    if ((x < 0) || (x >= grid->width) || (y < 0) || (y >= grid->height)) return 0;
+
+    unsigned char target = grid->cells[(size_t)y*grid->width + x];
+    unsigned char type = (unsigned char)(value & 0x03);
+
+    if (target == type) return 0;
+
+    int edited = 0;
+    int count = 0;
+
+    // Seed row filled from a virtual parent segment below it, row below filled from seed row
+    PushMazeFillSegment(batch, &count, grid->height, y, x, x, 1);
+    PushMazeFillSegment(batch, &count, grid->height, y + 1, x, x, -1);
+
+    while (count > 0)
+    {
+        count--;
+        const int *segment = &batch->stack[4*count];
+        int dy = segment[3];
+        int row_y = segment[0] + dy;
+        int parent_x1 = segment[1];
+        int parent_x2 = segment[2];
+        unsigned char *row = grid->cells + (size_t)row_y*grid->width;
+        int run_x = parent_x1;
+
+        // First run can start left of parent range, leaking back into parent row
+        if (row[run_x] == target)
+        {
+            while ((run_x > 0) && (row[run_x - 1] == target)) run_x--;
+            if ((run_x < parent_x1) && !PushMazeFillSegment(batch, &count, grid->height, row_y, run_x, parent_x1 - 1, -dy)) return edited;
+        }
+
+        while (run_x <= parent_x2)
+        {
+            // Skip cells out of region up to next run
+            if (row[run_x] != target)
+            {
+                const unsigned char *found = (const unsigned char *)memchr(row + run_x, target, (size_t)(parent_x2 - run_x + 1));
+                if (found == NULL) break;
+                run_x = (int)(found - row);
+            }
+
+            int run_end = FindMazeCellOther(row, run_x, grid->width, target);
+
+            if (!AddMazeEditSpan(batch, run_x, row_y, run_end - run_x, target)) return edited;
+            memset(row + run_x, type, (size_t)(run_end - run_x));
+            edited += run_end - run_x;
+
+            // Run continues in next row, run cells beyond parent range leak back into parent row
+            if (!PushMazeFillSegment(batch, &count, grid->height, row_y, run_x, run_end - 1, dy)) return edited;
+            if (((run_end - 1) > parent_x2) && !PushMazeFillSegment(batch, &count, grid->height, row_y, parent_x2 + 1, run_end - 1, -dy)) return edited;
+
+            run_x = run_end + 1;
+        }
+    }
+
+    return edited;
+}
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Definition
+//----------------------------------------------------------------------------------
+
+// Add edited cells span, merged with previous span if possible
+static bool AddMazeEditSpan(MazeEditBatch *batch, int x, int y, int length, int before)
+{
+    MazeEditSpan *last = (batch->span_count > 0)? &batch->spans[batch->span_count - 1] : NULL;
+
+    if ((last != NULL) && (last->y == y) && ((last->x + last->length) == x) && (last->before == before)) last->length += length;
+    else
+    {
+        if (batch->span_count >= batch->span_capacity)
+        {
+            int capacity = (batch->span_capacity > 0)? batch->span_capacity*2 : MAZE_EDIT_MIN_CAPACITY;
+            MazeEditSpan *spans = (MazeEditSpan *)realloc(batch->spans, (size_t)capacity*sizeof(MazeEditSpan));
+
+            if (spans == NULL) return false;
+
+            batch->spans = spans;
+            batch->span_capacity = capacity;
+        }
+
+        batch->spans[batch->span_count++] = (MazeEditSpan){ x, y, length, (unsigned char)before };
+    }
+
+    // Bounding rectangle grown to include span
+    if (batch->count == 0) batch->bounds = (MazeDirtyRect){ x, y, length, 1 };
+    else
+    {
+        int min_x = (x < batch->bounds.x)? x : batch->bounds.x;
+        int min_y = (y < batch->bounds.y)? y : batch->bounds.y;
+        int max_x = ((x + length) > (batch->bounds.x + batch->bounds.width))? (x + length) : (batch->bounds.x + batch->bounds.width);
+        int max_y = ((y + 1) > (batch->bounds.y + batch->bounds.height))? (y + 1) : (batch->bounds.y + batch->bounds.height);
+
+        batch->bounds = (MazeDirtyRect){ min_x, min_y, max_x - min_x, max_y - min_y };
+    }
+
+    batch->count += length;
+
+    return true;
+}
+
+// Paint cells row range (clipped), returns cells edited
+static int PaintMazeSpan(MazeGrid *grid, MazeEditBatch *batch, int x0, int x1, int y, int value)
+{
+    if ((y < 0) || (y >= grid->height)) return 0;
+    if (x0 < 0) x0 = 0;
+    if (x1 > (grid->width - 1)) x1 = grid->width - 1;
+
+    unsigned char *row = grid->cells + (size_t)y*grid->width;
+    unsigned char type = (unsigned char)(value & 0x03);
+    int edited = 0;
+
+    for (int x = x0; x <= x1; x++)
+    {
+        // NOTE: Item cells always edited when painting items, only item type could change
+        if ((row[x] != type) || (type == MAZE_CELL_ITEM))
+        {
+            if (!AddMazeEditSpan(batch, x, y, 1, row[x])) break;
+            row[x] = type;
+            edited++;
+        }
+    }
+
+    return edited;
+}
+
+// Push flood fill segment if next row is inside maze, stack grows as required
+static bool PushMazeFillSegment(MazeEditBatch *batch, int *count, int height, int y, int x1, int x2, int dy)
+{
+    if (((y + dy) < 0) || ((y + dy) >= height)) return true;
+
+    if (*count >= batch->stack_capacity)
+    {
+        int capacity = (batch->stack_capacity > 0)? batch->stack_capacity*2 : MAZE_EDIT_MIN_CAPACITY;
+        int *stack = (int *)realloc(batch->stack, (size_t)capacity*4*sizeof(int));
+
+        if (stack == NULL) return false;
+
+        batch->stack = stack;
+        batch->stack_capacity = capacity;
+    }
+
+    int *segment = &batch->stack[4*(*count)];
+    segment[0] = y;
+    segment[1] = x1;
+    segment[2] = x2;
+    segment[3] = dy;
+    (*count)++;
+
+    return true;
+}
+
+// Find first cell in [x, end) with type other than type, end if none
+// NOTE: Cells compared 8 at a time on little-endian GCC/Clang targets
+static int FindMazeCellOther(const unsigned char *row, int x, int end, unsigned char type)
+{
+#if defined(__GNUC__) && defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+    const unsigned long long pattern = 0x0101010101010101ULL*type;
+
+    while ((end - x) >= 8)
+    {
+        unsigned long long cells = 0;
+        memcpy(&cells, row + x, 8);
+        cells ^= pattern;
+
+        if (cells != 0) return x + (__builtin_ctzll(cells) >> 3);
+        x += 8;
+    }
+#endif
+    while ((x < end) && (row[x] == type)) x++;
+
+    return x;
+}
+
+#endif // MAZE_EDIT_IMPLEMENTATION
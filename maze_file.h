@@ -0,0 +1,559 @@
+/*******************************************************************************************
+*
+*   maze_file - Compact binary maze file format, memory-mapped loading
+*
+*   Maze files store cells packed at 2 bits per cell (4 cells per byte, rows byte aligned),
+*   generation parameters, start/end cells and an items table, a 16384x16384 maze takes
+*   64 MB on disk (1 GB as RGBA image). Files are loaded memory-mapped: cells are read
+*   directly from mapped file data (GetMazeFileCell()), no RGBA decoding required, only
+*   pages accessed are read from disk. Packed cells rows can be uploaded as they are to a
+*   one byte texture (4 cells per texel), grid decoding can be split in rows bands
+*
+*   File data (cells and items table) checksum is stored in header, so damaged or truncated
+*   files can be detected (CheckMazeFileIntegrity()); checking reads all file data, so it is
+*   not done on loading, files with no checksum (zero) are never considered intact
+*
+*   FILE FORMAT (little endian):
+*       Offset  Size    Description
+*       0       4       Magic: "MAZE"
+*       4       2       Version: MAZE_FILE_VERSION
+*       6       2       Cells encoding: 0 = 2 bits per cell (MazeCellType)
+*       8       4       Width, in cells
+*       12      4       Height, in cells
+*       16      4       Generator seed
+*       20      4       Generator points spacing, rows
+*       24      4       Generator points spacing, columns
+*       28      4       Generator point chance (float)
+*       32      16      Start cell (x, y), end cell (x, y)
+*       48      4       Items count
+*       52      4       Data checksum: FNV-1a of all data after header (0 = not stored)
+*       56      4       Generator algorithm (MazeAlgorithm, 0 = grid)
+*       60      4       Reserved
+*       64      ...     Cells data: height rows of (width + 3)/4 bytes, cell x at bits 2*(x%4)
+*       ...     ...     Items table (4 bytes aligned): x, y, type (4 bytes each) per item
+*
+*   CONFIGURATION:
+*       #define MAZE_FILE_IMPLEMENTATION
+*           Generates the implementation of the module in the including file,
+*           only one translation unit should define it
+*
+*       #define MAZE_FILE_NO_MMAP
+*           Memory mapping is not available, file data is read into memory on loading
+*
+*   DEPENDENCIES:
+*       maze_grid       - Maze cells data
+*       maze_items      - Items table saving and loading
+*
+*   NOTE: Module is window-free and does not depend on raylib
+*
+*   Copyright (c) 2024-2025 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#ifndef MAZE_FILE_H
+#define MAZE_FILE_H
+
+#include "maze_grid.h"
+#include "maze_items.h"
+
+#define MAZE_FILE_VERSION           1
+#define MAZE_FILE_HEADER_SIZE       64
+#define MAZE_FILE_ITEM_SIZE         12
+
+// Maze file information, generation parameters and maze ends
+typedef struct MazeFileInfo {
+    unsigned int seed;          // Generator seed
+    int spacing_rows;           // Generator points spacing, rows
+    int spacing_cols;           // Generator points spacing, columns
+    float point_chance;         // Generator point chance
+    int start_x;                // Start cell
+    int start_y;
+    int end_x;                  // End cell
+    int end_y;
+    int algorithm;              // Generator algorithm (MazeAlgorithm)
+} MazeFileInfo;
+
+// Maze file, loaded memory-mapped
+typedef struct MazeFile {
+    int width;                  // Maze width in cells
+    int height;                 // Maze height in cells
+    MazeFileInfo info;          // Maze file information
+    int item_count;             // Items in items table
+    int row_size;               // Cells data bytes per row
+    unsigned int checksum;      // File data checksum (0 = not stored)
+
+    const unsigned char *cells; // Packed cells data (points into mapped data)
+    const unsigned char *items; // Items table (points into mapped data)
+
+    void *data;                 // File data (mapped)
+    size_t size;                // File data size
+} MazeFile;
+
+// Maze rows provider, fills next maze row (width cells), returns false on failure
+// NOTE: Used to save mazes generated row by row, full maze never required in memory
+typedef bool (*MazeRowFunc)(void *data, unsigned char *cells);
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+bool SaveMazeFile(const char *fileName, MazeGrid grid, const MazeItems *items, MazeFileInfo info); // Save maze file, items can be NULL
+bool SaveMazeFileRows(const char *fileName, int width, int height, MazeRowFunc next_row, void *data, MazeFileInfo info); // Save maze file from rows provided one by one (no items)
+MazeFile LoadMazeFile(const char *fileName);                        // Load maze file (memory-mapped), data is validated
+void UnloadMazeFile(MazeFile *file);                                // Unload maze file, unmapping file data
+bool IsMazeFileValid(MazeFile file);                                // Check if maze file is loaded
+bool CheckMazeFileIntegrity(MazeFile file);                         // Check maze file data matches its checksum (reads all file data)
+
+MazeGrid LoadMazeGridFromFile(MazeFile file);                       // Load maze grid from maze file cells
+void LoadMazeGridRowsFromFile(MazeGrid grid, MazeFile file, int y, int count); // Decode maze file cells rows into grid (same size), rows bands can be decoded in parallel
+int PackMazeCellsRows(MazeGrid grid, int x, int y, int width, int height, unsigned char *packed); // Pack grid cells area at 2 bits per cell (file layout, area x aligned to 4 cells), returns bytes
+int AddMazeItemsFromFile(MazeItems *items, MazeFile file);          // Add items from maze file items table, returns items added
+
+#if defined(__cplusplus)
+}
+#endif
+
+// Get maze file cell type, read directly from packed cells, cells out of bounds are considered walls
+static inline int GetMazeFileCell(MazeFile file, int x, int y)
+{
+    if ((x < 0) || (x >= file.width) || (y < 0) || (y >= file.height)) return MAZE_CELL_WALL;
+
+    return (file.cells[(size_t)y*file.row_size + x/4] >> (2*(x%4))) & 0x03;
+}
+
+#endif // MAZE_FILE_H
+
+/***********************************************************************************
+*
+*   MAZE_FILE IMPLEMENTATION
+*
+************************************************************************************/
+
+#if defined(MAZE_FILE_IMPLEMENTATION) && !defined(MAZE_FILE_IMPLEMENTATION_DONE)
+#define MAZE_FILE_IMPLEMENTATION_DONE
+
+#include <stdio.h>      // Required for: FILE, fopen(), fwrite(), fread(), fseek(), fclose()
+#include <stdlib.h>     // Required for: malloc(), free()
+#include <string.h>     // Required for: memcpy(), memset(), memcmp()
+
+#if !defined(MAZE_FILE_NO_MMAP)
+    #if defined(_WIN32)
+        #define WIN32_LEAN_AND_MEAN
+        #define NOGDI
+        #define NOUSER
+        #include <windows.h>
+    #else
+        #include <fcntl.h>          // Required for: open()
+        #include <sys/mman.h>       // Required for: mmap(), munmap()
+        #include <sys/stat.h>       // Required for: fstat()
+        #include <unistd.h>         // Required for: close()
+    #endif
+#endif
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Declaration
+//----------------------------------------------------------------------------------
+static void *MapMazeFileData(const char *fileName, size_t *size);  // Map file data (read-only), returns NULL on failure
+static void UnmapMazeFileData(void *data, size_t size);             // Unmap file data
+static unsigned int ReadMazeFileU32(const unsigned char *data);     // Read little endian 32 bit value
+static void WriteMazeFileU32(unsigned char *data, unsigned int value); // Write little endian 32 bit value
+static unsigned int UpdateMazeFileChecksum(unsigned int checksum, const unsigned char *data, size_t size); // Update data checksum (FNV-1a)
+static bool SaveMazeFileData(const char *fileName, int width, int height, MazeRowFunc next_row, void *data, const MazeItems *items, MazeFileInfo info); // Save maze file, cells rows provided one by one
+static bool GetMazeGridNextRow(void *data, unsigned char *cells);  // Maze rows provider reading maze grid rows
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+
+// Save maze file, items can be NULL
+// NOTE: Items are written from items storage, grid cells only mark items position
+bool SaveMazeFile(const char *fileName, MazeGrid grid, const MazeItems *items, MazeFileInfo info)
+{
+    if (grid.cells == NULL) return false;
+
+    // NOTE: Grid rows provider reads grid rows in order, starting from grid cells
+    MazeGrid rows = grid;
+
+    return SaveMazeFileData(fileName, grid.width, grid.height, GetMazeGridNextRow, &rows, items, info);
+}
+
+// Save maze file from rows provided one by one (no items)
+bool SaveMazeFileRows(const char *fileName, int width, int height, MazeRowFunc next_row, void *data, MazeFileInfo info)
+{
+    return SaveMazeFileData(fileName, width, height, next_row, data, NULL, info);
+}
+
+// Load maze file (memory-mapped), data is validated
+// NOTE: Returned file is not valid (IsMazeFileValid()) if file can not be loaded
+MazeFile LoadMazeFile(const char *fileName)
+{
+    MazeFile file = { 0 };
+    size_t size = 0;
+    unsigned char *data = (unsigned char *)MapMazeFileData(fileName, &size);
+
+    if (data == NULL) return file;
+
+    bool valid = (size >= MAZE_FILE_HEADER_SIZE) && (memcmp(data, "MAZE", 4) == 0) &&
+        ((data[4] | (data[5] << 8)) == MAZE_FILE_VERSION) && (data[6] == 0) && (data[7] == 0);
+
+    if (valid)
+    {
+        unsigned int width = ReadMazeFileU32(data + 8);
+        unsigned int height = ReadMazeFileU32(data + 12);
+        unsigned int item_count = ReadMazeFileU32(data + 48);
+        unsigned int chance = ReadMazeFileU32(data + 28);
+
+        // NOTE: Sizes checked before use, so corrupted files are never read out of bounds
+        valid = (width > 0) && (width <= 0x7fffffff) && (height > 0) && (height <= 0x7fffffff) && (item_count <= 0x7fffffff);
+
+        size_t cells_size = valid? (size_t)((width + 3)/4)*height : 0;
+        size_t items_offset = MAZE_FILE_HEADER_SIZE + cells_size + (4 - cells_size%4)%4;
+
+        if (valid && (cells_size/height == (width + 3)/4) && (items_offset <= size) &&
+            ((size - items_offset)/MAZE_FILE_ITEM_SIZE >= item_count))
+        {
+            file.width = (int)width;
+            file.height = (int)height;
+            file.item_count = (int)item_count;
+            file.row_size = (int)((width + 3)/4);
+            file.checksum = ReadMazeFileU32(data + 52);
+            file.cells = data + MAZE_FILE_HEADER_SIZE;
+            file.items = data + items_offset;
+
+            file.info.seed = ReadMazeFileU32(data + 16);
+            file.info.spacing_rows = (int)ReadMazeFileU32(data + 20);
+            file.info.spacing_cols = (int)ReadMazeFileU32(data + 24);
+            memcpy(&file.info.point_chance, &chance, sizeof(chance));
+            file.info.start_x = (int)ReadMazeFileU32(data + 32);
+            file.info.start_y = (int)ReadMazeFileU32(data + 36);
+            file.info.end_x = (int)ReadMazeFileU32(data + 40);
+            file.info.end_y = (int)ReadMazeFileU32(data + 44);
+            file.info.algorithm = (int)ReadMazeFileU32(data + 56);
+
+            file.data = data;
+            file.size = size;
+        }
+        else valid = false;
+    }
+
+    if (!valid) UnmapMazeFileData(data, size);
+
+    return file;
+}
+
+// Unload maze file, unmapping file data
+void UnloadMazeFile(MazeFile *file)
+{
+    if (file->data != NULL) UnmapMazeFileData(file->data, file->size);
+
+    *file = (MazeFile){ 0 };
+}
+
+// Check if maze file is loaded
+bool IsMazeFileValid(MazeFile file)
+{
+    return (file.data != NULL);
+}
+
+// Check maze file data matches its checksum (reads all file data)
+// NOTE: Files saved without checksum are never considered intact
+bool CheckMazeFileIntegrity(MazeFile file)
+{
+    if (!IsMazeFileValid(file) || (file.checksum == 0)) return false;
+
+    unsigned int checksum = UpdateMazeFileChecksum(2166136261u, (const unsigned char *)file.data + MAZE_FILE_HEADER_SIZE, file.size - MAZE_FILE_HEADER_SIZE);
+    if (checksum == 0) checksum = 1;
+
+    return (checksum == file.checksum);
+}
+
+// Load maze grid from maze file cells
+MazeGrid LoadMazeGridFromFile(MazeFile file)
+{
+    if (!IsMazeFileValid(file)) return (MazeGrid){ 0 };
+
+    MazeGrid grid = LoadMazeGrid(file.width, file.height);
+
+    if (grid.cells != NULL) LoadMazeGridRowsFromFile(grid, file, 0, file.height);
+
+    return grid;
+}
+
+// Decode maze file cells rows into grid (same size), rows bands can be decoded in parallel
+// NOTE: Packed bytes expanded with a lookup table, 4 cells at once
+void LoadMazeGridRowsFromFile(MazeGrid grid, MazeFile file, int y, int count)
+{
+    if (!IsMazeFileValid(file) || (grid.cells == NULL) || (grid.width != file.width) || (grid.height != file.height)) return;
+    if ((y < 0) || (count <= 0) || ((y + count) > file.height)) return;
+
+    unsigned char lookup[256][4] = { 0 };
+
+    for (int i = 0; i < 256; i++)
+    {
+        for (int k = 0; k < 4; k++) lookup[i][k] = (unsigned char)((i >> (2*k)) & 0x03);
+    }
+
+    int full_bytes = file.width/4;
+
+    for (int row = y; row < (y + count); row++)
+    {
+        const unsigned char *packed = &file.cells[(size_t)row*file.row_size];
+        unsigned char *cells = &grid.cells[(size_t)row*file.width];
+
+        for (int i = 0; i < full_bytes; i++) memcpy(&cells[i*4], lookup[packed[i]], 4);
+        for (int x = full_bytes*4; x < file.width; x++) cells[x] = lookup[packed[x/4]][x%4];
+    }
+}
+
+// Pack grid cells area at 2 bits per cell (file layout, area x aligned to 4 cells), returns bytes
+// NOTE: Area widened to whole bytes, rows packed one after another ((x%4 + width + 3)/4 bytes per row)
+int PackMazeCellsRows(MazeGrid grid, int x, int y, int width, int height, unsigned char *packed)
+{
+    if ((grid.cells == NULL) || (packed == NULL) || (x < 0) || (y < 0) || (width <= 0) || (height <= 0) ||
+        ((x + width) > grid.width) || ((y + height) > grid.height)) return 0;
+
+    int min_x = x - x%4;
+    int row_size = (x + width - min_x + 3)/4;
+
+    for (int row = 0; row < height; row++)
+    {
+        const unsigned char *cells = &grid.cells[(size_t)(y + row)*grid.width];
+        unsigned char *bytes = &packed[(size_t)row*row_size];
+
+        memset(bytes, 0, row_size);
+
+        int max_x = min_x + row_size*4;
+        if (max_x > grid.width) max_x = grid.width;
+
+        for (int cx = min_x; cx < max_x; cx++) bytes[(cx - min_x)/4] |= (unsigned char)((cells[cx] & 0x03) << (2*(cx%4)));
+    }
+
+    return row_size*height;
+}
+
+// Add items from maze file items table, returns items added
+// NOTE: Items out of maze bounds or of unknown type are skipped
+int AddMazeItemsFromFile(MazeItems *items, MazeFile file)
+{
+    int added = 0;
+
+    for (int i = 0; i < file.item_count; i++)
+    {
+        const unsigned char *entry = &file.items[(size_t)i*MAZE_FILE_ITEM_SIZE];
+        unsigned int x = ReadMazeFileU32(entry);
+        unsigned int y = ReadMazeFileU32(entry + 4);
+        unsigned int type = ReadMazeFileU32(entry + 8);
+
+        if ((x >= (unsigned int)file.width) || (y >= (unsigned int)file.height) || (type >= MAZE_ITEM_TYPE_COUNT)) continue;
+
+        MazeItemHandle handle = AddMazeItem(items, (int)x, (int)y, (int)type);
+        if (IsMazeItemValid(items, handle)) added++;
+    }
+
+    return added;
+}
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Definition
+//----------------------------------------------------------------------------------
+
+// Map file data (read-only), returns NULL on failure
+static void *MapMazeFileData(const char *fileName, size_t *size)
+{
+    void *data = NULL;
+
+#if defined(MAZE_FILE_NO_MMAP)
+    FILE *file = fopen(fileName, "rb");
+
+    if (file != NULL)
+    {
+        fseek(file, 0, SEEK_END);
+        long length = ftell(file);
+        fseek(file, 0, SEEK_SET);
+
+        if (length > 0) data = malloc((size_t)length);
+        if ((data != NULL) && (fread(data, 1, (size_t)length, file) != (size_t)length))
+        {
+            free(data);
+            data = NULL;
+        }
+
+        if (data != NULL) *size = (size_t)length;
+        fclose(file);
+    }
+#elif defined(_WIN32)
+    HANDLE file = CreateFileA(fileName, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+
+    if (file != INVALID_HANDLE_VALUE)
+    {
+        LARGE_INTEGER length = { 0 };
+
+        if (GetFileSizeEx(file, &length) && (length.QuadPart > 0))
+        {
+            // NOTE: View keeps mapping alive, handles can be closed once mapped
+            HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+
+            if (mapping != NULL)
+            {
+                data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+                if (data != NULL) *size = (size_t)length.QuadPart;
+                CloseHandle(mapping);
+            }
+        }
+
+        CloseHandle(file);
+    }
+#else
+    int fd = open(fileName, O_RDONLY);
+
+    if (fd >= 0)
+    {
+        struct stat info = { 0 };
+
+        if ((fstat(fd, &info) == 0) && (info.st_size > 0))
+        {
+            data = mmap(NULL, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+            if (data == MAP_FAILED) data = NULL;
+            else *size = (size_t)info.st_size;
+        }
+
+        close(fd);
+    }
+#endif
+
+    return data;
+}
+
+// Unmap file data
+static void UnmapMazeFileData(void *data, size_t size)
+{
+#if defined(MAZE_FILE_NO_MMAP)
+    (void)size;
+    free(data);
+#elif defined(_WIN32)
+    (void)size;
+    UnmapViewOfFile(data);
+#else
+    munmap(data, size);
+#endif
+}
+
+// Read little endian 32 bit value
+static unsigned int ReadMazeFileU32(const unsigned char *data)
+{
+    return (unsigned int)data[0] | ((unsigned int)data[1] << 8) | ((unsigned int)data[2] << 16) | ((unsigned int)data[3] << 24);
+}
+
+// Write little endian 32 bit value
+static void WriteMazeFileU32(unsigned char *data, unsigned int value)
+{
+    data[0] = value & 0xff;
+    data[1] = (value >> 8) & 0xff;
+    data[2] = (value >> 16) & 0xff;
+    data[3] = (value >> 24) & 0xff;
+}
+
+// Update data checksum (FNV-1a)
+static unsigned int UpdateMazeFileChecksum(unsigned int checksum, const unsigned char *data, size_t size)
+{
+    for (size_t i = 0; i < size; i++) checksum = (checksum ^ data[i])*16777619u;
+
+    return checksum;
+}
+
+// Save maze file, cells rows provided one by one
+static bool SaveMazeFileData(const char *fileName, int width, int height, MazeRowFunc next_row, void *data, const MazeItems *items, MazeFileInfo info)
+{
+    if ((next_row == NULL) || (width <= 0) || (height <= 0)) return false;
+
+    FILE *file = fopen(fileName, "wb");
+
+    if (file == NULL) return false;
+
+    unsigned char header[MAZE_FILE_HEADER_SIZE] = { 0 };
+    unsigned int chance = 0;
+    memcpy(&chance, &info.point_chance, sizeof(chance));
+
+    memcpy(header, "MAZE", 4);
+    header[4] = MAZE_FILE_VERSION & 0xff;
+    header[5] = (MAZE_FILE_VERSION >> 8) & 0xff;
+    WriteMazeFileU32(header + 8, (unsigned int)width);
+    WriteMazeFileU32(header + 12, (unsigned int)height);
+    WriteMazeFileU32(header + 16, info.seed);
+    WriteMazeFileU32(header + 20, (unsigned int)info.spacing_rows);
+    WriteMazeFileU32(header + 24, (unsigned int)info.spacing_cols);
+    WriteMazeFileU32(header + 28, chance);
+    WriteMazeFileU32(header + 32, (unsigned int)info.start_x);
+    WriteMazeFileU32(header + 36, (unsigned int)info.start_y);
+    WriteMazeFileU32(header + 40, (unsigned int)info.end_x);
+    WriteMazeFileU32(header + 44, (unsigned int)info.end_y);
+    WriteMazeFileU32(header + 48, (items != NULL)? (unsigned int)items->count : 0);
+    WriteMazeFileU32(header + 56, (unsigned int)info.algorithm);
+
+    bool success = (fwrite(header, 1, MAZE_FILE_HEADER_SIZE, file) == MAZE_FILE_HEADER_SIZE);
+    unsigned int checksum = 2166136261u;
+
+    // Cells data, packed row by row
+    int row_size = (width + 3)/4;
+    unsigned char *row = (unsigned char *)malloc(row_size);
+    unsigned char *cells = (unsigned char *)malloc(width);
+    if ((row == NULL) || (cells == NULL)) success = false;
+
+    for (int y = 0; success && (y < height); y++)
+    {
+        success = next_row(data, cells);
+        memset(row, 0, row_size);
+
+        for (int x = 0; x < width; x++) row[x/4] |= (unsigned char)((cells[x] & 0x03) << (2*(x%4)));
+
+        if (success) success = (fwrite(row, 1, row_size, file) == (size_t)row_size);
+        if (success) checksum = UpdateMazeFileChecksum(checksum, row, row_size);
+    }
+
+    free(row);
+    free(cells);
+
+    // Items table, 4 bytes aligned
+    size_t padding = (4 - ((size_t)row_size*height)%4)%4;
+    unsigned char zero[4] = { 0 };
+    if (success && (padding > 0)) success = (fwrite(zero, 1, padding, file) == padding);
+    checksum = UpdateMazeFileChecksum(checksum, zero, padding);
+
+    for (int i = 0; success && (items != NULL) && (i < items->used_slots); i++)
+    {
+        if (items->state[i] != MAZE_ITEM_STATE_ACTIVE) continue;
+
+        unsigned char entry[MAZE_FILE_ITEM_SIZE] = { 0 };
+        WriteMazeFileU32(entry, (unsigned int)(items->cell[i]%items->width));
+        WriteMazeFileU32(entry + 4, (unsigned int)(items->cell[i]/items->width));
+        WriteMazeFileU32(entry + 8, items->type[i]);
+
+        success = (fwrite(entry, 1, MAZE_FILE_ITEM_SIZE, file) == MAZE_FILE_ITEM_SIZE);
+        checksum = UpdateMazeFileChecksum(checksum, entry, MAZE_FILE_ITEM_SIZE);
+    }
+
+    // Checksum only known once all data is written, header field rewritten
+    // NOTE: Zero means no checksum stored, so it is never used as checksum
+    if (checksum == 0) checksum = 1;
+    WriteMazeFileU32(header + 52, checksum);
+    if (success) success = (fseek(file, 52, SEEK_SET) == 0) && (fwrite(header + 52, 1, 4, file) == 4);
+
+    if (fclose(file) != 0) success = false;
+
+    return success;
+}
+
+// Maze rows provider reading maze grid rows
+// NOTE: Provider data is a maze grid, its cells pointer advanced one row per call
+static bool GetMazeGridNextRow(void *data, unsigned char *cells)
+{
+    MazeGrid *grid = (MazeGrid *)data;
+
+    memcpy(cells, grid->cells, grid->width);
+    grid->cells += grid->width;
+
+    return true;
+}
+
+#endif // MAZE_FILE_IMPLEMENTATION
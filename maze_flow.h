@@ -0,0 +1,547 @@
+/*******************************************************************************************
+*
+*   maze_flow - Flow field navigation, distance to target cell for all maze cells
+*
+*   A single breadth-first search from the target cell (player, goal...) computes the
+*   walking distance of every maze cell, any number of agents then move towards target
+*   just stepping into the neighbour cell with lower distance, no per-agent search
+*
+*   Distance field is updated incrementally:
+*     - Target moved to a neighbour cell: maze cells are a bipartite graph, so every
+*       distance changes exactly by one. Only cells whose shortest path goes through new
+*       target get closer (search limited to them), all other cells get one step further
+*       at once using a global distance offset
+*     - Cell blocked: distances depending on cell are invalidated (cells without another
+*       neighbour one step closer) and searched again from invalidated area boundary
+*     - Cell opened: new cell distance taken from neighbours and closer distances
+*       propagated from it, only visiting cells that get closer
+*   Other cases (target moved further, target blocked, cells area edits changing many
+*   cells walkability) search the full field again
+*
+*   CONFIGURATION:
+*       #define MAZE_FLOW_IMPLEMENTATION
+*           Generates the implementation of the module in the including file,
+*           only one translation unit should define it
+*
+*   DEPENDENCIES:
+*       maze_grid       - Maze cells data, walls are not walkable
+*       maze_system     - Timing (GetMazeTime())
+*
+*   NOTE: Module is window-free and does not depend on raylib
+*
+*   Copyright (c) 2024-2025 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#ifndef MAZE_FLOW_H
+#define MAZE_FLOW_H
+
+#include "maze_grid.h"
+#include "maze_system.h"
+
+#define MAZE_FLOW_WALL              0x7fffffff  // Field value for not walkable cells
+#define MAZE_FLOW_UNREACHABLE       0x7ffffffe  // Field value for walkable cells not connected to target
+#define MAZE_FLOW_AREA_CELLS        64          // Cells area edit changed cells updated incrementally, above it field searched again
+
+// Flow field update statistics, last update
+typedef struct MazeFlowStats {
+    int visited;                // Number of cells visited
+    double time;                // Update time in seconds
+    int rebuilds;               // Number of full searches since field loading
+} MazeFlowStats;
+
+// Flow field, distance to target for every maze cell
+// NOTE: Field values are relative (actual distance = value + offset), only differences
+// between cells matter for navigation, so target moves do not require updating all cells
+typedef struct MazeFlowField {
+    int width;                  // Maze width in cells
+    int height;                 // Maze height in cells
+    int *field;                 // Cells distance (relative) or MAZE_FLOW_WALL/MAZE_FLOW_UNREACHABLE
+    int offset;                 // Distance offset, target cell actual distance is 0
+    int target;                 // Target cell index (-1 if none)
+
+    // Update working buffers
+    int *queue;                 // Cells search queue
+    int *invalid;               // Cells invalidated by a blocked cell
+    unsigned long long *boundary; // Invalidated area boundary cells, sorted by distance
+    unsigned char *marked;      // Cells already queued/added to boundary
+
+    MazeFlowStats stats;
+} MazeFlowField;
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+MazeFlowField LoadMazeFlowField(MazeGrid grid);                     // Load flow field from maze grid walkable cells (no target)
+void UnloadMazeFlowField(MazeFlowField *flow);                      // Unload flow field data
+void SetMazeFlowTarget(MazeFlowField *flow, int x, int y);          // Set flow field target cell, distances updated
+void UpdateMazeFlowCell(MazeFlowField *flow, MazeGrid grid, int x, int y); // Update flow field after a cell edit
+void UpdateMazeFlowArea(MazeFlowField *flow, MazeGrid grid, int x, int y, int width, int height); // Update flow field after a cells area edit
+void RebuildMazeFlowField(MazeFlowField *flow);                     // Search all distances from target again
+int GetMazeFlowDistance(MazeFlowField flow, int x, int y);          // Get cell distance to target, -1 if not reachable
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif // MAZE_FLOW_H
+
+/***********************************************************************************
+*
+*   MAZE_FLOW IMPLEMENTATION
+*
+************************************************************************************/
+
+#if defined(MAZE_FLOW_IMPLEMENTATION) && !defined(MAZE_FLOW_IMPLEMENTATION_DONE)
+#define MAZE_FLOW_IMPLEMENTATION_DONE
+
+#include <stdlib.h>     // Required for: malloc(), calloc(), free(), qsort(), abs()
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Declaration
+//----------------------------------------------------------------------------------
+static int GetMazeFlowNeighbours(const MazeFlowField *flow, int cell, int *neighbours); // Get cell neighbours indices, returns count
+static bool MoveMazeFlowTarget(MazeFlowField *flow, int cell);     // Move target to neighbour cell, returns false if not possible
+static void BlockMazeFlowCell(MazeFlowField *flow, int cell);       // Update field for a cell becoming wall
+static void OpenMazeFlowCell(MazeFlowField *flow, int cell);        // Update field for a wall cell becoming walkable
+static int CompareMazeFlowBoundary(const void *a, const void *b);   // Compare boundary keys (qsort)
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+
+// Load flow field from maze grid walkable cells (no target)
+MazeFlowField LoadMazeFlowField(MazeGrid grid)
+{
+    MazeFlowField flow = { 0 };
+    flow.target = -1;
+
+    if ((grid.width <= 0) || (grid.height <= 0) || (grid.cells == NULL)) return flow;
+
+    size_t count = (size_t)grid.width*grid.height;
+    flow.field = (int *)malloc(count*sizeof(int));
+    flow.queue = (int *)malloc(count*sizeof(int));
+    flow.invalid = (int *)malloc(count*sizeof(int));
+    flow.boundary = (unsigned long long *)malloc(count*sizeof(unsigned long long));
+    flow.marked = (unsigned char *)calloc(count, 1);
+
+    if ((flow.field == NULL) || (flow.queue == NULL) || (flow.invalid == NULL) || (flow.boundary == NULL) || (flow.marked == NULL))
+    {
+        UnloadMazeFlowField(&flow);
+        return flow;
+    }
+
+    flow.width = grid.width;
+    flow.height = grid.height;
+
+    for (size_t i = 0; i < count; i++) flow.field[i] = (grid.cells[i] == MAZE_CELL_WALL)? MAZE_FLOW_WALL : MAZE_FLOW_UNREACHABLE;
+
+    return flow;
+}
+
+// Unload flow field data
+void UnloadMazeFlowField(MazeFlowField *flow)
+{
+    free(flow->field);
+    free(flow->queue);
+    free(flow->invalid);
+    free(flow->boundary);
+    free(flow->marked);
+
+    *flow = (MazeFlowField){ 0 };
+    flow->target = -1;
+}
+
+// Set flow field target cell, distances updated
+// NOTE: Moving target to a neighbour cell (or diagonal cell through a walkable corner)
+// only visits cells that get closer, any other move searches the full field
+void SetMazeFlowTarget(MazeFlowField *flow, int x, int y)
+{
+    if (flow->field == NULL) return;
+
+    int cell = ((x >= 0) && (x < flow->width) && (y >= 0) && (y < flow->height))? y*flow->width + x : -1;
+
+    // NOTE: Target can not be placed on a wall, no cell can reach it
+    if ((cell >= 0) && (flow->field[cell] == MAZE_FLOW_WALL)) cell = -1;
+    if (cell == flow->target) return;
+
+    double start_time = GetMazeTime();
+    flow->stats.visited = 0;
+
+    bool moved = false;
+
+    if ((cell >= 0) && (flow->target >= 0))
+    {
+        int target_x = flow->target%flow->width;
+        int target_y = flow->target/flow->width;
+        int distance = abs(x - target_x) + abs(y - target_y);
+
+        if (distance == 1) moved = MoveMazeFlowTarget(flow, cell);
+        else if ((distance == 2) && (x != target_x) && (y != target_y))
+        {
+            // Diagonal move, moved through any of both corner cells
+            moved = MoveMazeFlowTarget(flow, target_y*flow->width + x) || MoveMazeFlowTarget(flow, y*flow->width + target_x);
+            if (moved) moved = MoveMazeFlowTarget(flow, cell);
+        }
+    }
+
+    if (!moved)
+    {
+        flow->target = cell;
+        RebuildMazeFlowField(flow);
+    }
+
+    flow->stats.time = GetMazeTime() - start_time;
+}
+
+// Update flow field after a cell edit
+// NOTE: Only walkable state changes update the field (items or goal placement do not)
+void UpdateMazeFlowCell(MazeFlowField *flow, MazeGrid grid, int x, int y)
+{
+    if ((flow->field == NULL) || (x < 0) || (x >= flow->width) || (y < 0) || (y >= flow->height)) return;
+
+    int cell = y*flow->width + x;
+    bool walkable = IsMazeCellWalkable(grid, x, y);
+
+    if (walkable == (flow->field[cell] != MAZE_FLOW_WALL)) return;
+
+    double start_time = GetMazeTime();
+    flow->stats.visited = 0;
+
+    if (!walkable && (cell == flow->target))
+    {
+        // Target blocked, no cell can reach it
+        flow->field[cell] = MAZE_FLOW_WALL;
+        flow->target = -1;
+        RebuildMazeFlowField(flow);
+    }
+    else if (walkable) OpenMazeFlowCell(flow, cell);
+    else BlockMazeFlowCell(flow, cell);
+
+    flow->stats.time = GetMazeTime() - start_time;
+}
+
+// Update flow field after a cells area edit
+// NOTE: Few changed cells are updated incrementally, otherwise field is searched again only once,
+// every incremental update could visit most of the field
+void UpdateMazeFlowArea(MazeFlowField *flow, MazeGrid grid, int x, int y, int width, int height)
+{
+    if (flow->field == NULL) return;
+
+    int x0 = (x < 0)? 0 : x;
+    int y0 = (y < 0)? 0 : y;
+    int x1 = ((x + width) > flow->width)? flow->width : x + width;
+    int y1 = ((y + height) > flow->height)? flow->height : y + height;
+    int changed = 0;
+
+    for (int cy = y0; cy < y1; cy++)
+    {
+        for (int cx = x0; cx < x1; cx++)
+        {
+            if (IsMazeCellWalkable(grid, cx, cy) == (flow->field[cy*flow->width + cx] == MAZE_FLOW_WALL)) changed++;
+        }
+    }
+
+    if (changed == 0) return;
+
+    if (changed <= MAZE_FLOW_AREA_CELLS)
+    {
+        for (int cy = y0; cy < y1; cy++)
+        {
+            for (int cx = x0; cx < x1; cx++) UpdateMazeFlowCell(flow, grid, cx, cy);
+        }
+
+        return;
+    }
+
+    double start_time = GetMazeTime();
+    flow->stats.visited = 0;
+
+    for (int cy = y0; cy < y1; cy++)
+    {
+        for (int cx = x0; cx < x1; cx++)
+        {
+            int cell = cy*flow->width + cx;
+            flow->field[cell] = IsMazeCellWalkable(grid, cx, cy)? MAZE_FLOW_UNREACHABLE : MAZE_FLOW_WALL;
+        }
+    }
+
+    if ((flow->target >= 0) && (flow->field[flow->target] == MAZE_FLOW_WALL)) flow->target = -1;
+
+    RebuildMazeFlowField(flow);
+
+    flow->stats.time = GetMazeTime() - start_time;
+}
+
+// Search all distances from target again (breadth-first search)
+void RebuildMazeFlowField(MazeFlowField *flow)
+{
+    if (flow->field == NULL) return;
+
+    int count = flow->width*flow->height;
+
+    for (int i = 0; i < count; i++)
+    {
+        if (flow->field[i] != MAZE_FLOW_WALL) flow->field[i] = MAZE_FLOW_UNREACHABLE;
+    }
+
+    flow->offset = 0;
+    flow->stats.rebuilds++;
+
+    if (flow->target < 0) return;
+
+    int head = 0;
+    int tail = 0;
+    flow->field[flow->target] = 0;
+    flow->queue[tail++] = flow->target;
+
+    while (head < tail)
+    {
+        int cell = flow->queue[head++];
+        int distance = flow->field[cell] + 1;
+        int neighbours[4] = { 0 };
+        int neighbour_count = GetMazeFlowNeighbours(flow, cell, neighbours);
+
+        for (int n = 0; n < neighbour_count; n++)
+        {
+            if (flow->field[neighbours[n]] == MAZE_FLOW_UNREACHABLE)
+            {
+                flow->field[neighbours[n]] = distance;
+                flow->queue[tail++] = neighbours[n];
+            }
+        }
+    }
+
+    flow->stats.visited += tail;
+}
+
+// Get cell distance to target, -1 if not reachable
+int GetMazeFlowDistance(MazeFlowField flow, int x, int y)
+{
+    if ((flow.field == NULL) || (x < 0) || (x >= flow.width) || (y < 0) || (y >= flow.height)) return -1;
+
+    int value = flow.field[y*flow.width + x];
+
+    return (value >= MAZE_FLOW_UNREACHABLE)? -1 : value + flow.offset;
+}
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Definition
+//----------------------------------------------------------------------------------
+
+// Get cell neighbours indices, returns count
+static int GetMazeFlowNeighbours(const MazeFlowField *flow, int cell, int *neighbours)
+{
+    int count = 0;
+    int x = cell%flow->width;
+
+    if (cell >= flow->width) neighbours[count++] = cell - flow->width;
+    if (x < (flow->width - 1)) neighbours[count++] = cell + 1;
+    if (cell < (flow->width*(flow->height - 1))) neighbours[count++] = cell + flow->width;
+    if (x > 0) neighbours[count++] = cell - 1;
+
+    return count;
+}
+
+// Move target to neighbour cell, returns false if not possible (cell not reachable)
+// NOTE: Cells reached from new target only through increasing distances (new target
+// descendants) get one step closer, all other reachable cells one step further
+// (increasing offset), cells are visited only for the first case
+static bool MoveMazeFlowTarget(MazeFlowField *flow, int cell)
+{
+    int target_value = flow->field[flow->target];
+
+    if (flow->field[cell] != (target_value + 1)) return false;
+
+    int head = 0;
+    int tail = 0;
+    flow->field[cell] -= 2;
+    flow->queue[tail++] = cell;
+
+    while (head < tail)
+    {
+        int current = flow->queue[head++];
+        int next_value = flow->field[current] + 3;  // Previous value + 1
+        int neighbours[4] = { 0 };
+        int neighbour_count = GetMazeFlowNeighbours(flow, current, neighbours);
+
+        // NOTE: Neighbour distances differ by one, so cells already updated (value - 2)
+        // can never match previous value + 1
+        for (int n = 0; n < neighbour_count; n++)
+        {
+            if (flow->field[neighbours[n]] == next_value)
+            {
+                flow->field[neighbours[n]] -= 2;
+                flow->queue[tail++] = neighbours[n];
+            }
+        }
+    }
+
+    flow->offset++;
+    flow->target = cell;
+    flow->stats.visited += tail;
+
+    return true;
+}
+
+// Update field for a cell becoming wall
+// NOTE: Cells invalidated in increasing distance order, a cell keeps its distance if any
+// neighbour is still one step closer. Invalidated area is searched again from its
+// boundary cells, processed in increasing distance order (merged with search queue)
+static void BlockMazeFlowCell(MazeFlowField *flow, int cell)
+{
+    int value = flow->field[cell];
+    flow->field[cell] = MAZE_FLOW_WALL;
+
+    if (value == MAZE_FLOW_UNREACHABLE) return;
+
+    int neighbours[4] = { 0 };
+    int neighbour_count = GetMazeFlowNeighbours(flow, cell, neighbours);
+    int head = 0;
+    int tail = 0;
+    int invalid_count = 0;
+
+    // NOTE: Cells queued only once (marked), queued marks cleared once all cells checked
+    for (int n = 0; n < neighbour_count; n++)
+    {
+        if (flow->field[neighbours[n]] == (value + 1))
+        {
+            flow->marked[neighbours[n]] = 1;
+            flow->queue[tail++] = neighbours[n];
+        }
+    }
+
+    while (head < tail)
+    {
+        int current = flow->queue[head++];
+        int current_value = flow->field[current];
+        neighbour_count = GetMazeFlowNeighbours(flow, current, neighbours);
+        bool supported = false;
+
+        for (int n = 0; (n < neighbour_count) && !supported; n++) supported = (flow->field[neighbours[n]] == (current_value - 1));
+
+        if (supported) continue;
+
+        flow->field[current] = MAZE_FLOW_UNREACHABLE;
+        flow->invalid[invalid_count++] = current;
+
+        for (int n = 0; n < neighbour_count; n++)
+        {
+            if ((flow->field[neighbours[n]] == (current_value + 1)) && !flow->marked[neighbours[n]])
+            {
+                flow->marked[neighbours[n]] = 1;
+                flow->queue[tail++] = neighbours[n];
+            }
+        }
+    }
+
+    for (int i = 0; i < tail; i++) flow->marked[flow->queue[i]] = 0;
+
+    // Invalidated area boundary: valid neighbours, sorted by distance
+    // NOTE: Key stores value (sign bit flipped for unsigned ordering) and cell index
+    int boundary_count = 0;
+
+    for (int i = 0; i < invalid_count; i++)
+    {
+        neighbour_count = GetMazeFlowNeighbours(flow, flow->invalid[i], neighbours);
+
+        for (int n = 0; n < neighbour_count; n++)
+        {
+            int neighbour = neighbours[n];
+
+            if ((flow->field[neighbour] < MAZE_FLOW_UNREACHABLE) && !flow->marked[neighbour])
+            {
+                flow->marked[neighbour] = 1;
+                flow->boundary[boundary_count++] = ((unsigned long long)((unsigned int)flow->field[neighbour] ^ 0x80000000u) << 32) | (unsigned int)neighbour;
+            }
+        }
+    }
+
+    qsort(flow->boundary, boundary_count, sizeof(unsigned long long), CompareMazeFlowBoundary);
+
+    head = 0;
+    tail = 0;
+    int next_boundary = 0;
+
+    while ((head < tail) || (next_boundary < boundary_count))
+    {
+        int current = 0;
+
+        if ((next_boundary < boundary_count) && ((head == tail) ||
+            (flow->field[(int)(flow->boundary[next_boundary] & 0xffffffff)] <= flow->field[flow->queue[head]])))
+        {
+            current = (int)(flow->boundary[next_boundary++] & 0xffffffff);
+            flow->marked[current] = 0;
+        }
+        else current = flow->queue[head++];
+
+        int distance = flow->field[current] + 1;
+        neighbour_count = GetMazeFlowNeighbours(flow, current, neighbours);
+
+        for (int n = 0; n < neighbour_count; n++)
+        {
+            if (flow->field[neighbours[n]] == MAZE_FLOW_UNREACHABLE)
+            {
+                flow->field[neighbours[n]] = distance;
+                flow->queue[tail++] = neighbours[n];
+            }
+        }
+    }
+
+    flow->stats.visited += invalid_count + boundary_count;
+}
+
+// Update field for a wall cell becoming walkable
+static void OpenMazeFlowCell(MazeFlowField *flow, int cell)
+{
+    int neighbours[4] = { 0 };
+    int neighbour_count = GetMazeFlowNeighbours(flow, cell, neighbours);
+    int value = MAZE_FLOW_UNREACHABLE;
+
+    for (int n = 0; n < neighbour_count; n++)
+    {
+        int neighbour_value = flow->field[neighbours[n]];
+        if ((neighbour_value < MAZE_FLOW_UNREACHABLE) && ((neighbour_value + 1) < value)) value = neighbour_value + 1;
+    }
+
+    flow->field[cell] = value;
+
+    if (value == MAZE_FLOW_UNREACHABLE) return;
+
+    // Closer distances propagated, only cells getting closer visited
+    int head = 0;
+    int tail = 0;
+    flow->queue[tail++] = cell;
+
+    while (head < tail)
+    {
+        int current = flow->queue[head++];
+        int distance = flow->field[current] + 1;
+        neighbour_count = GetMazeFlowNeighbours(flow, current, neighbours);
+
+        for (int n = 0; n < neighbour_count; n++)
+        {
+            int neighbour_value = flow->field[neighbours[n]];
+
+            if ((neighbour_value != MAZE_FLOW_WALL) && (neighbour_value > distance))
+            {
+                flow->field[neighbours[n]] = distance;
+                flow->queue[tail++] = neighbours[n];
+            }
+        }
+    }
+
+    flow->stats.visited += tail;
+}
+
+// Compare boundary keys (qsort)
+static int CompareMazeFlowBoundary(const void *a, const void *b)
+{
+    unsigned long long key_a = *(const unsigned long long *)a;
+    unsigned long long key_b = *(const unsigned long long *)b;
+
+    return (key_a > key_b) - (key_a < key_b);
+}
+
+#endif // MAZE_FLOW_IMPLEMENTATION
@@ -13,13 +13,109 @@
 
 #include "raylib.h"
 
-#include <stdlib.h>     // Required for: malloc(), free()
+#include <stdlib.h>     // Required for: malloc(), free(), abs()
+#include <stdio.h>      // Required for: sscanf()
+
+// NOTE: Profiler included first, so heap allocations of all maze modules are counted
+#define MAZE_PROFILE_TRACK_ALLOCATIONS
+#define MAZE_PROFILE_IMPLEMENTATION
+#include "maze_profile.h" // Required for: MazeProfiler, BeginMazeProfilePhase(), EndMazeProfilePhase()
+
+#define MAZE_GRID_IMPLEMENTATION
+#include "maze_grid.h"  // Required for: MazeGrid, GetMazeCell(), SetMazeCell()
+
+#define MAZE_SYSTEM_IMPLEMENTATION
+#include "maze_system.h" // Required for: GetMazeTime()
+
+#define MAZE_GEN_IMPLEMENTATION
+#include "maze_gen.h"   // Required for: GenMazeGrid(), MazeRandom, SetMazeRandomSeed()
+
+#define MAZE_ALGO_IMPLEMENTATION
+#include "maze_algo.h"  // Required for: GenMazeGridAlgorithm(), GetMazeGenerator()
+
+#define MAZE_RENDER_IMPLEMENTATION
+#include "maze_render.h" // Required for: MazeAtlas, MazeTiles, DrawMazeTiles(), GetMazeViewRange()
+
+#define MAZE_MESH_IMPLEMENTATION
+#include "maze_mesh.h"  // Required for: MazeMesh, MarkMazeMeshDirty(), UpdateMazeMesh(), DrawMazeMesh()
+
+#define MAZE_TILEMAP_IMPLEMENTATION
+#include "maze_tilemap.h" // Required for: MazeTilemap, UpdateMazeTilemap(), DrawMazeTilemap()
+
+#define MAZE_MINIMAP_IMPLEMENTATION
+#include "maze_minimap.h" // Required for: MazeMinimap, RevealMazeMinimap(), UpdateMazeMinimap(), DrawMazeMinimap()
+
+#define MAZE_ITEMS_IMPLEMENTATION
+#include "maze_items.h" // Required for: MazeItems, AddMazeItem(), RemoveMazeItem(), GetMazeItemAt()
+
+#define MAZE_DIRTY_IMPLEMENTATION
+#include "maze_dirty.h" // Required for: MazeDirtyRegions, MarkMazeCellDirty(), PopMazeDirtyRect()
+
+#define MAZE_PATH_IMPLEMENTATION
+#include "maze_path.h"  // Required for: MazePath, UpdateMazePathArea(), UpdateMazePath()
+
+#define MAZE_STREAM_IMPLEMENTATION
+#include "maze_stream.h" // Required for: MazeStream, UpdateMazeStream(), DrawMazeStream()
+
+#define MAZE_PLAYER_IMPLEMENTATION
+#include "maze_player.h" // Required for: MoveMazePlayer(), UpdateMazePlayerCell()
+
+#define MAZE_FILE_IMPLEMENTATION
+#include "maze_file.h"  // Required for: SaveMazeFile(), LoadMazeFile(), LoadMazeGridFromFile()
+
+#define MAZE_SIM_IMPLEMENTATION
+#include "maze_sim.h"   // Required for: MazeSim, StepMazeSim(), RecordMazeInput(), SaveMazeReplay()
+
+#define MAZE_UNDO_IMPLEMENTATION
+#include "maze_undo.h"  // Required for: MazeUndo, RecordMazeEditBatch(), UndoMazeEdit(), RedoMazeEdit()
+
+#define MAZE_EDIT_IMPLEMENTATION
+#include "maze_edit.h"  // Required for: MazeEditBatch, PaintMazeLine(), PaintMazeRect(), FloodFillMaze()
+
+#define MAZE_FLOW_IMPLEMENTATION
+#include "maze_flow.h"  // Required for: MazeFlowField, SetMazeFlowTarget(), UpdateMazeFlowArea()
+
+#define MAZE_AGENTS_IMPLEMENTATION
+#include "maze_agents.h" // Required for: MazeAgents, SpawnMazeAgents(), UpdateMazeAgents()
+
+#define MAZE_ANALYSIS_IMPLEMENTATION
+#include "maze_analysis.h" // Required for: MazeAnalyzer, MazeAnalysis, AnalyzeMaze()
+
+#define MAZE_CACHE_IMPLEMENTATION
+#include "maze_cache.h" // Required for: MazeCache, LoadMazeCacheGrid(), SaveMazeCacheGrid()
+
+#define MAZE_PREGEN_IMPLEMENTATION
+#include "maze_pregen.h" // Required for: MazePregen, RequestMazePregen(), TakeMazePregen()
+
+#define MAZE_DIRTY_TILE_SIZE    16      // Maze texture dirty regions tile size, in cells
+#define MAZE_DECODE_BAND_ROWS   256     // Maze file rows decoded per job
 
 #define MAZE_WIDTH          64
 #define MAZE_HEIGHT         64
 #define MAZE_SCALE          10.0f
 
-#define MAX_MAZE_ITEMS      16
+#define MAZE_STREAM_CHUNKS      64      // Endless maze resident chunks (MAZE_WIDTH x MAZE_HEIGHT cells each)
+#define MAZE_FILE_NAME          "maze_saved.maze"   // Editor maze file, if no maze file provided on startup
+#define MAZE_SESSION_FILE_NAME  "maze_session.maze" // Recorded session maze, at session start
+#define MAZE_REPLAY_FILE_NAME   "maze_session.replay" // Recorded session input
+#define MAZE_SEEDS_FILE_NAME    "maze_seeds.txt" // Seeds found by maze_search tool, used by [R] if available
+#define MAZE_PROFILE_FRAMES     240     // Frame profiler frames kept (4 seconds at 60 fps)
+#define MAZE_UNDO_MEMORY        1048576 // Editor undo history memory limit (1 MB)
+#define MAZE_ATLAS_TILE_SIZE    64      // Biomes atlas tile size, in pixels
+#define MAZE_AGENTS_COUNT       1000    // Maze agents spawned (half chasers, half wanderers)
+#define MAZE_AGENTS_SPEED       0.1f    // Maze agents speed, cells per simulation tick
+#define MAZE_MESH_CHUNK_SIZE    16      // Maze 3d mesh chunk size, in cells
+#define MAZE_MINIMAP_SIZE       192     // Minimap biggest side, in pixels (cells blocks merged on bigger mazes)
+#define MAZE_MINIMAP_REVEAL     6       // Minimap cells revealed around player, radius in cells
+#define MAZE_UPLOAD_FRAME_BYTES 2097152 // Maze texture upload budget per frame (2 MB), bigger uploads spread over frames
+#define MAZE_CACHE_PATH         "maze_cache" // Generated mazes cache directory
+#define MAZE_CACHE_MAX_SIZE     67108864 // Generated mazes cache size limit (64 MB), least recently used mazes removed
+#define MAZE_ZOOM_DEFAULT       10.0f   // Game camera zoom (cells drawn MAZE_SCALE*zoom pixels)
+#define MAZE_ZOOM_MAX           20.0f   // Game camera zoom limit, zoomed out down to whole maze view
+#define MAZE_ZOOM_STEP          1.2f    // Game camera zoom change per mouse wheel step
+#define MAZE_ZOOM_SPEED         10.0f   // Game camera zoom easing towards zoom target, per second
+#define MAZE_LOD_FADE_START     8.0f    // Cells size on screen (pixels) where maze overview starts fading in over tiles
+#define MAZE_LOD_FADE_END       4.0f    // Cells size on screen (pixels) where only maze overview is drawn
 
 // Declare new data type: Point
 typedef struct Point {
@@ -27,22 +123,120 @@ typedef struct Point {
     int y;
 } Point;
 
+// Maze edit context, maze data kept in sync when cells are edited (editor and undo/redo)
+typedef struct MazeEditContext {
+    MazeGrid *grid;
+    MazeItems *items;
+    MazeDirtyRegions *dirty;
+    MazePath *path;
+    MazeFlowField *flow;
+    MazeDirtyRect bounds;       // Cells area applied by undo/redo, path and flow updated once for it
+} MazeEditContext;
+
+// Maze file rows bands decoding into grid, jobs data
+typedef struct MazeFileDecode {
+    MazeFile file;              // Maze file (mapped)
+    MazeGrid grid;              // Maze grid, same size than file
+    int band_rows;              // Rows decoded per job
+} MazeFileDecode;
+
+// Biomes atlas background loading, atlas image packed on loading thread
+typedef struct AtlasLoader {
+    const char **file_names;    // Biome textures file names
+    int count;                  // Biomes count
+    int tile_size;              // Atlas tile size
+    Image image;                // Packed atlas image, available when done
+    bool done;                  // Atlas image packed (protected by mutex)
+    MazeMutex *mutex;
+    MazeThread *thread;
+} AtlasLoader;
+
+// Frame profiler phases, main loop sections
+typedef enum {
+    PROFILE_INPUT = 0,          // Input and mode handling
+    PROFILE_GAME_UPDATE,        // Game mode update
+    PROFILE_AGENTS,             // Flow field and agents update
+    PROFILE_EDITOR_UPDATE,      // Editor mode update
+    PROFILE_PATH,               // Maze path search
+    PROFILE_UPLOAD,             // Maze texture uploads
+    PROFILE_DRAW_TILES,         // Maze tiles/texture drawing
+    PROFILE_DRAW_ITEMS,         // Items, player and path drawing
+    PROFILE_DRAW_UI,            // UI text drawing
+    PROFILE_PRESENT,            // Render batch flush and buffers swap (EndDrawing())
+    PROFILE_PHASE_COUNT
+} ProfilePhase;
+
+static const char *profile_phase_names[PROFILE_PHASE_COUNT] = {
+    "input", "game_update", "agents", "editor_update", "path", "upload", "draw_tiles", "draw_items", "draw_ui", "present"
+};
+
+// Editor tools, mouse buttons select the painted cell type
+typedef enum {
+    EDIT_TOOL_BRUSH = 0,        // Paint cells under mouse, interpolated between frames
+    EDIT_TOOL_LINE,             // Paint line from stroke start to stroke end
+    EDIT_TOOL_RECT,             // Paint rectangle outline from stroke start to stroke end
+    EDIT_TOOL_RECT_FILLED,      // Paint filled rectangle from stroke start to stroke end
+    EDIT_TOOL_FILL,             // Flood fill region under mouse on stroke start
+    EDIT_TOOL_COUNT
+} EditTool;
+
+static const char *edit_tool_names[EDIT_TOOL_COUNT] = { "BRUSH", "LINE", "RECTANGLE", "FILLED RECTANGLE", "FLOOD FILL" };
+
 // Generate procedural maze image, using grid-based algorithm
 // NOTE: Functions defined as static are internal to the module
-Texture tex_maze;
 Image GenImageMaze(int width, int height, int spacing_rows, int spacing_cols, float point_chance);
+Image GenImageFromMazeGrid(MazeGrid grid);
+
+// Maze packed cells (overview texture data) prepared on background generation thread (MazePregen prepare callback)
+void *PrepareMazeCells(MazeGrid grid);
+
+// Load maze grid from maze file cells, rows bands decoded in parallel by jobs pool
+MazeGrid LoadMazeGridFromFileJobs(MazeFile file, MazeJobPool *pool);
+void DecodeMazeFileBand(void *data, int index);
+
+// Get request of the maze generated by [R]: next found seed (if seeds file loaded) or seed + 11
+MazePregenRequest GetNextMazeRequest(int algorithm, int seed, const int *seeds, int seed_count, int seed_index);
+
+// Biomes atlas image packing, loading thread entry point (data: AtlasLoader *)
+void LoadAtlasWorker(void *data);
+
+// Maze image color scheme, by cell and item type
+Color GetMazeCellColor(int type);
+Color GetMazeItemColor(int type);
+
+// Upload maze cells dirty regions into maze textures, returns bytes uploaded
+int UpdateMazeTextureRegions(MazeOverview *overview, MazeDirtyRegions *dirty, MazeTiles *tiles, MazeGrid grid, MazeAtlas atlas, MazeTilemap *tilemap, MazeMesh *mesh, MazeMinimap *minimap);
+
+// Set maze cells run edit value (cell and item type), keeping dirty regions and edited area in sync
+void ApplyMazeEdit(void *data, int x, int y, int length, int value);
+
+// Update path and flow field once for cells area applied by undo/redo
+void UpdateMazeEditArea(MazeEditContext *context);
+
+// Commit edit batch cells (already painted): items, path and undo history updated, one dirty area
+void CommitMazeEditBatch(MazeEditContext *context, const MazeEditBatch *batch, MazeUndo *undo);
+
+// Draw maze path cells inside view range, over maze
+void DrawMazePath(MazePath path, MazeViewRange view, Vector2 position, float scale, Color color);
+
+// Load seeds list from seeds file (maze_search tool output), NULL if not available or generated with other parameters
+int *LoadMazeSeeds(const char *fileName, MazePregenRequest params, int *algorithm, int *count);
+
+// Draw maze agents inside view range, over maze
+void DrawMazeAgents(MazeAgents agents, MazeViewRange view, Vector2 position, float scale);
+
+// Draw frame profiler overlay: phases time graph for last frames, phases and counters average
+void DrawMazeProfiler(const MazeProfiler *profiler, int x, int y);
 
 //----------------------------------------------------------------------------------
 // Main entry point
 //----------------------------------------------------------------------------------
-int main(void)
+int main(int argc, char *argv[])
 {
     // Initialization
     //---------------------------------------------------------
     const int screen_width = 1280;
     const int screen_height = 720;
-    int score = 0;
-    bool player_won = false;
 
     InitWindow(screen_width, screen_height, "Delivery04 - maze game");
 
@@ -54,26 +248,104 @@ int main(void)
     int seed = 37867;
     SetRandomSeed(seed);
 
-    // Generate maze image using the grid-based generator
-    // TODO: [1p] Implement GenImageMaze() function with required parameters
-    Image im_maze = GenImageMaze(MAZE_WIDTH, MAZE_HEIGHT, 4, 4, 0.75f);
+    // Maze generator random state, mazes can be reproduced from seed (i.e. with maze_batch tool)
+    MazeRandom maze_rng = { 0 };
+    SetMazeRandomSeed(&maze_rng, seed);
+
+    // Maze generation algorithm, selected in editor mode
+    int maze_algorithm = MAZE_ALGORITHM_GRID;
+    MazeGenStats gen_stats = { 0 };
+    bool gen_cached = false;    // Current maze loaded from cache, not generated
+
+    // Generated mazes cache, checked before generating any maze (startup and pre-generation)
+    // NOTE: Cache used by pre-generation thread once started, only used here before that
+    MazeCache maze_cache = LoadMazeCache(MAZE_CACHE_PATH, MAZE_CACHE_MAX_SIZE);
+
+    // Seeds found by maze_search tool (i.e. solvable with long paths), [R] walks through them
+    // NOTE: Seeds file must be generated with [R] maze parameters, seeds only used for its algorithm
+    int search_seed_count = 0;
+    int search_seed_index = 0;
+    int search_seed_algorithm = -1;
+    int *search_seeds = LoadMazeSeeds(MAZE_SEEDS_FILE_NAME, GetNextMazeRequest(maze_algorithm, 0, NULL, 0, 0), &search_seed_algorithm, &search_seed_count);
+
+    // Next maze always pre-generated in background (maze cells and packed cells), swapped in when requested
+    // NOTE: Maze swap waits for its maze to be ready, frames keep running meanwhile
+    MazePregen maze_pregen = LoadMazePregen(&maze_cache, PrepareMazeCells, free);
+    MazePregenRequest swap_request = { 0 };
+    bool swap_pending = false;
+    unsigned char *swap_cells = NULL;
+
+    // Jobs pool threads, used by maze files decoding and agents update
+    MazeJobPool *jobs_pool = LoadMazeJobPool(0);
 
-    // Load a texture to be drawn on screen from our image data
-    // WARNING: If im_maze pixel data is modified, tex_maze needs to be re-loaded
-    tex_maze = LoadTextureFromImage(im_maze);
+    // Maze file used by editor save/load, maze loaded from it if provided on startup (maze_game file.maze)
+    // NOTE: Maze file is memory-mapped, cells read from file data without image decoding, file kept
+    // mapped until its packed cells are uploaded to overview texture
+    const char *maze_file_name = (argc > 1)? argv[1] : MAZE_FILE_NAME;
+    MazeFile maze_file = (argc > 1)? LoadMazeFile(maze_file_name) : (MazeFile){ 0 };
+    MazeFileInfo maze_info = { (unsigned int)seed, 4, 4, 0.75f, 1, 1, MAZE_WIDTH - 2, MAZE_HEIGHT - 2, maze_algorithm };
+    MazeGrid maze_grid = { 0 };
 
-    Color* pixels = LoadImageColors(im_maze);
-    UpdateTexture(tex_maze, pixels);
-    UnloadImageColors(pixels);
+    if (IsMazeFileValid(maze_file))
+    {
+        maze_grid = LoadMazeGridFromFileJobs(maze_file, jobs_pool);
+        maze_info = maze_file.info;
+        seed = (int)maze_info.seed;
+        TraceLog(LOG_INFO, "MAZE: [%s] Loaded [%ix%i] with %i items", maze_file_name, maze_grid.width, maze_grid.height, maze_file.item_count);
+    }
+    else
+    {
+        if (argc > 1) TraceLog(LOG_WARNING, "MAZE: [%s] Maze file could not be loaded", maze_file_name);
+
+        // Load maze cells grid from cache, generation skipped if already generated
+        MazeCacheKey cache_key = { maze_algorithm, (unsigned int)seed, MAZE_WIDTH, MAZE_HEIGHT, maze_info.spacing_rows, maze_info.spacing_cols, maze_info.point_chance };
+        maze_grid = LoadMazeCacheGrid(&maze_cache, cache_key);
+        gen_cached = (maze_grid.cells != NULL);
+
+        if (gen_cached)
+        {
+            gen_stats.time = maze_cache.stats.time;
+            TraceLog(LOG_INFO, "MAZE: [%s] Loaded cached [%ix%i] in %.2f ms", MAZE_CACHE_PATH, maze_grid.width, maze_grid.height, gen_stats.time*1000.0);
+        }
+        else
+        {
+            // Generate maze cells grid using the selected generator, used by game logic
+            // TODO: [1p] Implement GenImageMaze() function with required parameters
+            maze_grid = GenMazeGridAlgorithm(maze_algorithm, MAZE_WIDTH, MAZE_HEIGHT, maze_info.spacing_rows, maze_info.spacing_cols, maze_info.point_chance, &maze_rng, &gen_stats);
+            TraceLog(LOG_INFO, "MAZE: Generated [%ix%i] with %i points in %.2f ms (peak memory: %zu bytes)",
+                maze_grid.width, maze_grid.height, gen_stats.points, gen_stats.time*1000.0, gen_stats.peak_memory);
+
+            SaveMazeCacheGrid(&maze_cache, cache_key, maze_grid);
+        }
+
+        // NOTE: Random state re-seeded (same than maze swaps), agents spawn the same with or without cache
+        SetMazeRandomSeed(&maze_rng, seed);
+    }
+
+    // Maze overview, packed cells texture (2 bits per cell) drawn with cell colors: editor view and
+    // zoomed out game view, no maze image kept in memory (maze_grid is the only cells copy)
+    // NOTE: Maze file packed cells uploaded as they are, otherwise texture cells uploaded by regions
+    // NOTE: Overview cells texture only loaded by classic renderer, tilemap renderer draws overview from its cells texture
+    Color maze_palette[4] = { GetMazeCellColor(MAZE_CELL_FLOOR), GetMazeCellColor(MAZE_CELL_WALL), GetMazeCellColor(MAZE_CELL_ITEM), GetMazeCellColor(MAZE_CELL_GOAL) };
+    MazeOverview maze_overview = LoadMazeOverview(maze_palette);
+    bool tilemap_mode = true;   // Maze renderer: tilemap shader or classic tiles and overview texture, [F5] toggles it
+
+    if (!tilemap_mode) ResetMazeOverview(&maze_overview, maze_grid.width, maze_grid.height, IsMazeFileValid(maze_file)? maze_file.cells : NULL);
+
+    // Maze cells edited since last texture update, only those regions get uploaded
+    // NOTE: Regions packed from maze_grid cells on upload, no staging copy required
+    MazeDirtyRegions maze_dirty = LoadMazeDirtyRegions(maze_grid.width, maze_grid.height, MAZE_DIRTY_TILE_SIZE, 0);
+    if (!tilemap_mode && !IsMazeFileValid(maze_file)) MarkMazeAreaDirty(&maze_dirty, 0, 0, maze_grid.width, maze_grid.height);
+    int upload_bytes = 0;   // Texture bytes uploaded in current frame
 
     // Player start-position and end-position initialization
-    Point start_cell = { 1, 1 };
-    Point end_cell = { im_maze.width - 2, im_maze.height - 2 };
+    Point start_cell = { maze_info.start_x, maze_info.start_y };
+    Point end_cell = { maze_info.end_x, maze_info.end_y };
 
     // Maze drawing position (editor mode)
     Vector2 maze_position;
-    maze_position.x = (GetScreenWidth() - tex_maze.width * MAZE_SCALE) / 2;
-    maze_position.y = (GetScreenHeight() - tex_maze.height * MAZE_SCALE) / 2;
+    maze_position.x = (GetScreenWidth() - maze_grid.width * MAZE_SCALE) / 2;
+    maze_position.y = (GetScreenHeight() - maze_grid.height * MAZE_SCALE) / 2;
 
     // Define player position and size
     Rectangle player = { maze_position.x + 10 * MAZE_SCALE + 2, maze_position.y + 10 * MAZE_SCALE + 2, 4, 4 };
@@ -84,26 +356,114 @@ int main(void)
     camera2d.target = (Vector2){ player.x, player.y };
     camera2d.offset = (Vector2){ screen_width / 2, screen_height / 2 };
     camera2d.rotation = 0.0f;
-    camera2d.zoom = 10.0f;
+    camera2d.zoom = MAZE_ZOOM_DEFAULT;
+    float zoom_target = MAZE_ZOOM_DEFAULT;  // Camera zoom eased towards zoom target (mouse wheel)
 
     // Mouse selected cell for maze editing
     Point selected_cell = { 0 };
 
-    // Maze items position and state
-    Point maze_items[MAX_MAZE_ITEMS] = { 0 };
-    bool maze_item_picked[MAX_MAZE_ITEMS] = { 0 };
+    // Maze items type and state, maze_grid cells only mark items position
+    // NOTE: Maze file items table provides items type, items cells not listed default to coins
+    MazeItems maze_items = LoadMazeItems(maze_grid.width, 0);
+    AddMazeItemsFromGrid(&maze_items, maze_grid, MAZE_ITEM_COIN);
+    AddMazeItemsFromFile(&maze_items, maze_file);
+    UnloadMazeFile(&maze_file);     // Maze file no longer required: grid decoded, cells texture and items loaded
+
+    // Maze path from start to end, validated again only when edits can change it
+    MazePath maze_path = LoadMazePath(maze_grid);
+    SetMazePathEnds(&maze_path, start_cell.x, start_cell.y, end_cell.x, end_cell.y);
+    bool show_path = true;
+
+    // Maze agents (chasers follow player through flow field, wanderers walk randomly)
+    // NOTE: Agents updated in parallel by jobs pool, flow field updated incrementally
+    MazeFlowField maze_flow = LoadMazeFlowField(maze_grid);
+    MazeAgents maze_agents = LoadMazeAgents(MAZE_AGENTS_COUNT, MAZE_AGENTS_SPEED);
+
+    // Endless maze world, chunks streamed around camera2d while enabled (game mode)
+    MazeStream maze_stream = { 0 };
+    bool endless_mode = false;
+
+    // Game simulation (player movement, collisions, items pickup, win), updated in fixed ticks
+    // NOTE: Player moves 2 units per tick, same speed than previous 2 units per frame at 60 fps
+    MazeSim maze_sim = { 0 };
+    maze_sim.origin_x = maze_position.x;
+    maze_sim.origin_y = maze_position.y;
+    maze_sim.scale = MAZE_SCALE;
+    maze_sim.speed = 2.0f;
+    maze_sim.items = &maze_items;
+    maze_sim.dirty = &maze_dirty;
+    ResetMazeSim(&maze_sim, player.x, player.y);
 
-    // Define textures to be used as our "biomes"
+    // Game session recording, input log can be replayed headless (tools/maze_replay)
+    MazeReplay maze_replay = { 0 };
+    bool recording = false;
+
+    // Define textures to be used as our "biomes", all packed into one atlas texture
     // TODO: Load additional textures for different biomes
-    Texture2D tex_biomes[4] = 
+    const char *biome_file_names[4] =
     {
-        LoadTexture("resources/maze_atlas01.png"),
-        LoadTexture("resources/maze_atlas02.png"),
-        LoadTexture("resources/maze_atlas03.png"),
-        LoadTexture("resources/maze_atlas04.png"),
+        "resources/maze_atlas01.png",
+        "resources/maze_atlas02.png",
+        "resources/maze_atlas03.png",
+        "resources/maze_atlas04.png",
     };
+    // NOTE: Placeholder atlas (flat colors, same layout) used until biome textures are loaded in background
+    MazeAtlas maze_atlas = LoadMazeAtlas(NULL, 4, MAZE_ATLAS_TILE_SIZE);
+    AtlasLoader atlas_loader = { biome_file_names, 4, MAZE_ATLAS_TILE_SIZE, { 0 }, false, LoadMazeMutex(), NULL };
+    atlas_loader.thread = StartMazeThread(LoadAtlasWorker, &atlas_loader);
+
+    if (atlas_loader.thread == NULL)
+    {
+        // NOTE: Loading thread could not be started, biomes atlas loaded synchronously
+        UnloadMazeAtlas(&maze_atlas);
+        maze_atlas = LoadMazeAtlas(biome_file_names, 4, MAZE_ATLAS_TILE_SIZE);
+    }
     int current_biome = 0;
 
+    // Maze cells atlas tiles (autotiling by wall neighbours), updated with maze texture regions
+    MazeTiles maze_tiles = LoadMazeTiles(maze_grid, maze_atlas);
+
+    // Maze tilemap, one byte per cell texture drawn as one quad by tilemap shader, [F5] toggles it
+    // NOTE: Tilemap cells texture also drawn as zoomed out overview, only maze texture loaded in tilemap mode
+    MazeTilemap maze_tilemap = LoadMazeTilemap(maze_tiles, tilemap_mode? maze_grid : (MazeGrid){ 0 });
+
+    // Maze 3d view, chunked mesh sharing biomes atlas, only edited chunks rebuilt (game mode)
+    // NOTE: Mesh chunks built when 3d view is shown, biome changes only update material shader
+    MazeMesh maze_mesh = LoadMazeMesh(maze_grid, maze_atlas, MAZE_MESH_CHUNK_SIZE, 1.0f);
+    Camera3D camera3d = { 0 };
+    camera3d.up = (Vector3){ 0.0f, 1.0f, 0.0f };
+    camera3d.fovy = 45.0f;
+    camera3d.projection = CAMERA_PERSPECTIVE;
+    bool show_3d = false;
+
+    // Maze minimap, cells revealed around player (game mode), only changed pixels redrawn
+    MazeMinimap maze_minimap = LoadMazeMinimap(maze_grid, MAZE_MINIMAP_SIZE);
+    bool show_minimap = true;
+
+    // Maze tiles rendering statistics, updated every frame in game mode
+    MazeRenderStats render_stats = { 0 };
+
+    // Maze metrics (components, dead ends, loops, path length, branching), updated when cells change
+    MazeAnalyzer maze_analyzer = LoadMazeAnalyzer(maze_grid.width, maze_grid.height);
+    MazeAnalysis maze_analysis = AnalyzeMaze(&maze_analyzer, maze_grid, start_cell.x, start_cell.y, end_cell.x, end_cell.y);
+
+    // Editor undo/redo history, every mouse stroke is one command
+    // NOTE: Only edited cells are recorded, undo/redo only updates those cells
+    MazeUndo maze_undo = LoadMazeUndo(maze_grid.width, MAZE_UNDO_MEMORY);
+    MazeEditContext edit_context = { &maze_grid, &maze_items, &maze_dirty, &maze_path, &maze_flow, { 0 } };
+
+    // Editor tools, every operation edits cells directly and is committed as one batch
+    EditTool edit_tool = EDIT_TOOL_BRUSH;
+    MazeEditBatch edit_batch = LoadMazeEditBatch(0);
+    bool stroke_active = false;     // Mouse stroke in progress (any paint button down)
+    Point stroke_start = { 0 };     // Stroke start cell (line and rectangle tools)
+    Point stroke_cell = { 0 };      // Stroke cell on previous frame (brush interpolation)
+    int stroke_value = 0;           // Stroke start painted value
+
+    // Frame profiler, main loop phases timing and frame counters for last frames
+    MazeProfiler profiler = LoadMazeProfiler(profile_phase_names, PROFILE_PHASE_COUNT, MAZE_PROFILE_FRAMES);
+    bool show_profiler = false;
+
     // TODO: Define all variables required for game UI elements (sprites, fonts...)
 
     SetTargetFPS(60);       // Set our game to run at 60 frames-per-second
@@ -114,80 +474,348 @@ int main(void)
     {
         // Update
         //----------------------------------------------------------------------------------
+        BeginMazeProfileFrame(&profiler);
+        BeginMazeProfilePhase(&profiler, PROFILE_INPUT);
+
+        // Frame profiler: [F3] toggles overlay, [F4] exports last frames (Chrome trace and CSV)
+        if (IsKeyPressed(KEY_F3)) show_profiler = !show_profiler;
+        if (IsKeyPressed(KEY_F4))
+        {
+            if (ExportMazeProfileTrace(&profiler, "maze_profile.json") && ExportMazeProfileCSV(&profiler, "maze_profile.csv"))
+                TraceLog(LOG_INFO, "MAZE: Profiler %i frames exported: maze_profile.json, maze_profile.csv", profiler.count);
+            else TraceLog(LOG_WARNING, "MAZE: Profiler frames could not be exported");
+        }
+
+        // Session recording: [F2] starts/stops it, stopped on win and before maze or mode changes
+        // NOTE: Session start maze is saved too, replay requires the same maze
+        if (recording && (IsKeyPressed(KEY_F2) || maze_sim.state.won || IsKeyPressed(KEY_SPACE) || IsKeyPressed(KEY_R) || IsKeyPressed(KEY_I)))
+        {
+            StopMazeRecording(&maze_replay, &maze_sim);
+            recording = false;
+
+            if (SaveMazeReplay(MAZE_REPLAY_FILE_NAME, maze_replay)) TraceLog(LOG_INFO, "MAZE: [%s] Session saved (%u ticks, %i input runs)",
+                MAZE_REPLAY_FILE_NAME, maze_replay.log.ticks, maze_replay.log.count);
+            else TraceLog(LOG_WARNING, "MAZE: [%s] Session could not be saved", MAZE_REPLAY_FILE_NAME);
+        }
+        else if (!recording && IsKeyPressed(KEY_F2) && (current_mode == 0) && !endless_mode)
+        {
+            MazeFileInfo session_info = maze_info;
+            session_info.start_x = start_cell.x;
+            session_info.start_y = start_cell.y;
+            session_info.end_x = end_cell.x;
+            session_info.end_y = end_cell.y;
+
+            if (SaveMazeFile(MAZE_SESSION_FILE_NAME, maze_grid, &maze_items, session_info))
+            {
+                StartMazeRecording(&maze_replay, &maze_sim);
+                recording = true;
+            }
+            else TraceLog(LOG_WARNING, "MAZE: [%s] Session maze could not be saved", MAZE_SESSION_FILE_NAME);
+        }
+
         // Select current mode as desired
         if (IsKeyPressed(KEY_SPACE)) current_mode = !current_mode; // Toggle mode: 0-Game, 1-Editor
-        if (IsKeyPressed(KEY_R))
+
+        // Maze replaced (re-generated or loaded from file), maze image, texture and path re-created
+        bool maze_changed = false;
+        bool maze_edited = false;       // Editor stroke (or undo/redo) committed this frame
+
+        bool maze_changed_generator = (current_mode == 1) && IsKeyPressed(KEY_G);
+
+        if (IsKeyPressed(KEY_R) || maze_changed_generator)
         {
-            // Set a new seed and re-generate maze
-            seed += 11;
-            UnloadImage(im_maze);
-            UnloadTexture(tex_maze);
-            im_maze = GenImageMaze(MAZE_WIDTH, MAZE_HEIGHT, 4, 4, 0.5f);
-            tex_maze = LoadTextureFromImage(im_maze);
+            // Request new seed maze (or next generator, same seed), swapped in once generated
+            // NOTE: Next seed maze is already pre-generated in background, usually ready
+            if (maze_changed_generator)
+            {
+                if (!swap_pending) swap_request = GetNextMazeRequest(maze_algorithm, seed, NULL, 0, 0);
+                swap_request.algorithm = (swap_request.algorithm + 1)%MAZE_ALGORITHM_COUNT;
+                swap_request.seed = (unsigned int)seed;
+            }
+            else swap_request = GetNextMazeRequest(maze_algorithm, seed, search_seeds, (maze_algorithm == search_seed_algorithm)? search_seed_count : 0, search_seed_index);
+
+            RequestMazePregen(&maze_pregen, swap_request);
+            swap_pending = true;
+        }
+
+        MazePregenResult swap_result = { 0 };
+
+        if (swap_pending && TakeMazePregen(&maze_pregen, swap_request, &swap_result))
+        {
+            // Swap generated maze in, its packed cells already prepared on generation thread
+            seed = (int)swap_result.request.seed;
+            maze_algorithm = swap_result.request.algorithm;
+            gen_stats = swap_result.stats;
+            gen_cached = swap_result.cached;
+            if ((search_seed_count > 0) && (maze_algorithm == search_seed_algorithm) && (swap_result.request.seed == (unsigned int)search_seeds[search_seed_index%search_seed_count])) search_seed_index++;
+            swap_pending = false;
+
+            // NOTE: Perfect mazes last cell depends on maze size parity
+            const MazeGenerator *generator = GetMazeGenerator(maze_algorithm);
+            int end_x = generator->perfect? GetMazePerfectLast(MAZE_WIDTH) : MAZE_WIDTH - 2;
+            int end_y = generator->perfect? GetMazePerfectLast(MAZE_HEIGHT) : MAZE_HEIGHT - 2;
+
+            SetMazeRandomSeed(&maze_rng, seed);
+            UnloadMazeGrid(maze_grid);
+            maze_info = (MazeFileInfo){ (unsigned int)seed, swap_result.request.spacing_rows, swap_result.request.spacing_cols, swap_result.request.point_chance, 1, 1, end_x, end_y, maze_algorithm };
+            maze_grid = swap_result.grid;
+
+            swap_cells = (unsigned char *)swap_result.prepared;
+
+            UnloadMazeItems(&maze_items);
+            maze_items = LoadMazeItems(maze_grid.width, 0);
+            AddMazeItemsFromGrid(&maze_items, maze_grid, MAZE_ITEM_COIN);
+            maze_changed = true;
+
+            if (endless_mode)
+            {
+                UnloadMazeStream(&maze_stream);
+                maze_stream = LoadMazeStream(seed, MAZE_WIDTH, 4, 4, 0.75f, MAZE_STREAM_CHUNKS);
+            }
         }
+        if ((current_mode == 1) && IsKeyDown(KEY_LEFT_CONTROL) && IsKeyPressed(KEY_S))
+        {
+            // Save edited maze, current path ends saved as maze start/end cells
+            maze_info.start_x = start_cell.x;
+            maze_info.start_y = start_cell.y;
+            maze_info.end_x = end_cell.x;
+            maze_info.end_y = end_cell.y;
+
+            if (SaveMazeFile(maze_file_name, maze_grid, &maze_items, maze_info)) TraceLog(LOG_INFO, "MAZE: [%s] Maze file saved", maze_file_name);
+            else TraceLog(LOG_WARNING, "MAZE: [%s] Maze file could not be saved", maze_file_name);
+        }
+        if ((current_mode == 1) && IsKeyDown(KEY_LEFT_CONTROL) && IsKeyPressed(KEY_L))
+        {
+            // NOTE: Maze file kept mapped until maze change, its packed cells uploaded as they are
+            maze_file = LoadMazeFile(maze_file_name);
+
+            if (IsMazeFileValid(maze_file))
+            {
+                UnloadMazeGrid(maze_grid);
+                maze_grid = LoadMazeGridFromFileJobs(maze_file, jobs_pool);
+                maze_info = maze_file.info;
+                seed = (int)maze_info.seed;
+                UnloadMazeItems(&maze_items);
+                maze_items = LoadMazeItems(maze_grid.width, maze_file.item_count);
+                AddMazeItemsFromGrid(&maze_items, maze_grid, MAZE_ITEM_COIN);
+                AddMazeItemsFromFile(&maze_items, maze_file);
+                maze_changed = true;
+                TraceLog(LOG_INFO, "MAZE: [%s] Loaded [%ix%i] with %i items", maze_file_name, maze_grid.width, maze_grid.height, maze_file.item_count);
+            }
+            else TraceLog(LOG_WARNING, "MAZE: [%s] Maze file could not be loaded", maze_file_name);
+        }
+        if (maze_changed)
+        {
+            // NOTE: Loaded mazes can have a different size, data sized by maze is re-created
+            // NOTE: Only current renderer maze texture re-created (overview cells or tilemap cells)
+            // NOTE: Overview texture uploaded at once from packed cells (maze file or prepared on generation thread),
+            // otherwise created empty and cells uploaded by regions over next frames (upload budget per frame)
+            const unsigned char *packed_cells = IsMazeFileValid(maze_file)? maze_file.cells : swap_cells;
+            if (!tilemap_mode) ResetMazeOverview(&maze_overview, maze_grid.width, maze_grid.height, packed_cells);
+            UnloadMazeDirtyRegions(&maze_dirty);
+            maze_dirty = LoadMazeDirtyRegions(maze_grid.width, maze_grid.height, MAZE_DIRTY_TILE_SIZE, 0);
+            if (!tilemap_mode && (packed_cells == NULL)) MarkMazeAreaDirty(&maze_dirty, 0, 0, maze_grid.width, maze_grid.height);
+            UnloadMazeFile(&maze_file);
+            free(swap_cells);
+            swap_cells = NULL;
+            UnloadMazePath(&maze_path);
+            maze_path = LoadMazePath(maze_grid);
+            UnloadMazeFlowField(&maze_flow);
+            maze_flow = LoadMazeFlowField(maze_grid);
+            UnloadMazeTiles(&maze_tiles);
+            maze_tiles = LoadMazeTiles(maze_grid, maze_atlas);
+            if (tilemap_mode) ResetMazeTilemap(&maze_tilemap, maze_tiles, maze_grid);
+            UnloadMazeAnalyzer(&maze_analyzer);
+            maze_analyzer = LoadMazeAnalyzer(maze_grid.width, maze_grid.height);
+            UnloadMazeMinimap(&maze_minimap);
+            maze_minimap = LoadMazeMinimap(maze_grid, MAZE_MINIMAP_SIZE);
+            ResetMazeMesh(&maze_mesh, maze_grid);
+            start_cell = (Point){ maze_info.start_x, maze_info.start_y };
+            end_cell = (Point){ maze_info.end_x, maze_info.end_y };
+            SetMazePathEnds(&maze_path, start_cell.x, start_cell.y, end_cell.x, end_cell.y);
+            maze_position.x = (GetScreenWidth() - maze_grid.width * MAZE_SCALE) / 2;
+            maze_position.y = (GetScreenHeight() - maze_grid.height * MAZE_SCALE) / 2;
+
+            // Player placed back at new maze start
+            maze_sim.origin_x = maze_position.x;
+            maze_sim.origin_y = maze_position.y;
+            maze_sim.state.player_x = maze_position.x + start_cell.x * MAZE_SCALE + 2;
+            maze_sim.state.player_y = maze_position.y + start_cell.y * MAZE_SCALE + 2;
+            maze_sim.state.won = false;
+
+            // Edit history refers to previous maze cells
+            ClearMazeUndo(&maze_undo, maze_grid.width);
+
+            // Agents spawned again on new maze cells
+            if (maze_agents.count > 0)
+            {
+                ClearMazeAgents(&maze_agents);
+                SpawnMazeAgents(&maze_agents, maze_grid, MAZE_AGENTS_COUNT/2, MAZE_AGENT_CHASER, &maze_rng);
+                SpawnMazeAgents(&maze_agents, maze_grid, MAZE_AGENTS_COUNT - MAZE_AGENTS_COUNT/2, MAZE_AGENT_WANDERER, &maze_rng);
+            }
+        }
+
+        // Keep next seed maze pre-generating in background, unless a swap is waiting for its maze
+        if (!swap_pending) RequestMazePregen(&maze_pregen, GetNextMazeRequest(maze_algorithm, seed, search_seeds, (maze_algorithm == search_seed_algorithm)? search_seed_count : 0, search_seed_index));
+
+        // Biome textures atlas replaces placeholder atlas once packed on loading thread
+        if (atlas_loader.thread != NULL)
+        {
+            LockMazeMutex(atlas_loader.mutex);
+            bool atlas_done = atlas_loader.done;
+            UnlockMazeMutex(atlas_loader.mutex);
+
+            if (atlas_done)
+            {
+                JoinMazeThread(atlas_loader.thread);
+                atlas_loader.thread = NULL;
+
+                UnloadMazeAtlas(&maze_atlas);
+                maze_atlas = LoadMazeAtlasFromImage(atlas_loader.image, atlas_loader.count, atlas_loader.tile_size);
+                UnloadImage(atlas_loader.image);
+                atlas_loader.image = (Image){ 0 };
+
+                // NOTE: Same atlas layout, tiles map still valid, 3d mesh material only swaps atlas texture
+                SetMazeMeshAtlas(&maze_mesh, maze_atlas);
+            }
+        }
+        if (IsKeyPressed(KEY_P)) show_path = !show_path;
+        if (IsKeyPressed(KEY_V)) show_3d = !show_3d;
+        if (IsKeyPressed(KEY_M)) show_minimap = !show_minimap;
+
+        // Maze renderer: [F5] toggles tilemap shader and classic tiles/texture drawing
+        // NOTE: Previous renderer maze texture unloaded, current renderer texture uploaded at once
+        if (IsKeyPressed(KEY_F5))
+        {
+            tilemap_mode = !tilemap_mode;
+
+            if (tilemap_mode)
+            {
+                ResetMazeOverview(&maze_overview, 0, 0, NULL);
+                ResetMazeTilemap(&maze_tilemap, maze_tiles, maze_grid);
+            }
+            else
+            {
+                unsigned char *packed_cells = (unsigned char *)PrepareMazeCells(maze_grid);
+                ResetMazeOverview(&maze_overview, maze_grid.width, maze_grid.height, packed_cells);
+                if (packed_cells == NULL) MarkMazeAreaDirty(&maze_dirty, 0, 0, maze_grid.width, maze_grid.height);
+                free(packed_cells);
+                ResetMazeTilemap(&maze_tilemap, maze_tiles, (MazeGrid){ 0 });
+            }
+        }
+
+        if (IsKeyPressed(KEY_N))
+        {
+            // Toggle maze agents
+            if (maze_agents.count > 0) ClearMazeAgents(&maze_agents);
+            else
+            {
+                SpawnMazeAgents(&maze_agents, maze_grid, MAZE_AGENTS_COUNT/2, MAZE_AGENT_CHASER, &maze_rng);
+                SpawnMazeAgents(&maze_agents, maze_grid, MAZE_AGENTS_COUNT - MAZE_AGENTS_COUNT/2, MAZE_AGENT_WANDERER, &maze_rng);
+            }
+        }
+        if (IsKeyPressed(KEY_I))
+        {
+            // Toggle endless maze, player placed back at start position
+            endless_mode = !endless_mode;
+
+            if (endless_mode)
+            {
+                maze_stream = LoadMazeStream(seed, MAZE_WIDTH, 4, 4, 0.75f, MAZE_STREAM_CHUNKS);
+                current_mode = 0;
+            }
+            else UnloadMazeStream(&maze_stream);
+
+            maze_sim.state.player_x = maze_position.x + 10 * MAZE_SCALE + 2;
+            maze_sim.state.player_y = maze_position.y + 10 * MAZE_SCALE + 2;
+            maze_sim.state.won = false;
+        }
+
+        EndMazeProfilePhase(&profiler, PROFILE_INPUT);
+
         if (current_mode == 0) // Game mode
         {
+            BeginMazeProfilePhase(&profiler, PROFILE_GAME_UPDATE);
+
             // TODO: [2p] Player 2D movement from predefined Start-point to End-point
             // Implement maze 2D player movement logic (cursors || WASD)
             // Use im_maze pixel information to check collisions
             // Detect if current playerCell == end_cell to finish game
 
-            int player_cell_x = (int)((player.x - maze_position.x) / MAZE_SCALE);
-            int player_cell_y = (int)((player.y - maze_position.y) / MAZE_SCALE);
-            float speed = 2.0f;
-            Vector2 move = { 0 };
-            if (player_cell_x >= 0 && player_cell_x < im_maze.width && player_cell_y >= 0 && player_cell_y < im_maze.height)
+            // Player input, movement logic is independent of input devices
+            MazePlayerInput input = { 0 };
+            input.up = IsKeyDown(KEY_W) || IsKeyDown(KEY_UP);
+            input.down = IsKeyDown(KEY_S) || IsKeyDown(KEY_DOWN);
+            input.left = IsKeyDown(KEY_A) || IsKeyDown(KEY_LEFT);
+            input.right = IsKeyDown(KEY_D) || IsKeyDown(KEY_RIGHT);
+
+            // NOTE: Collisions are checked against maze_grid cells (or endless maze chunks),
+            // no image pixels decoding required, endless maze has no items pickup
+            maze_sim.walkable = endless_mode? IsMazeStreamCellWalkable : IsMazeGridCellWalkable;
+            maze_sim.walkable_data = endless_mode? (void *)&maze_stream : (void *)&maze_grid;
+            maze_sim.grid = endless_mode? NULL : &maze_grid;
+
+            // TODO: [2p] Maze items pickup logic
+            // Fixed timestep simulation, ticks due for frame time run with current frame input
+            int sim_ticks = GetMazeSimTicks(&maze_sim, GetFrameTime());
+
+            for (int i = 0; i < sim_ticks; i++)
             {
+                // Player picks item or reaches the end, picked item cell marked dirty (uploaded as floor)
+                StepMazeSim(&maze_sim, input);
 
-                Color* pixels = LoadImageColors(im_maze);
-                if (!player_won) {
-                    if (IsKeyDown(KEY_W) || IsKeyDown(KEY_UP)) {
-                        int new_cell_y = (int)((player.y - speed - maze_position.y) / MAZE_SCALE);
-                        if (!(pixels[new_cell_y * im_maze.width + player_cell_x].r == 255)) move.y = -speed;
-                    }
+                if (recording) RecordMazeInput(&maze_replay.log, input);
+            }
 
-                    if (IsKeyDown(KEY_S) || IsKeyDown(KEY_DOWN)) {
-                        int new_cell_y = (int)((player.y + speed - maze_position.y) / MAZE_SCALE);
-                        if (!(pixels[new_cell_y * im_maze.width + player_cell_x].r == 255)) move.y = speed;
-                    }
+            // TODO: [1p] Camera 2D system following player movement around the map
+            // Update Camera2D parameters as required to follow player and zoom control
+            player.x = maze_sim.state.player_x;
+            player.y = maze_sim.state.player_y;
+            camera2d.target = (Vector2){ player.x, player.y };
 
-                    if (IsKeyDown(KEY_A) || IsKeyDown(KEY_LEFT)) {
-                        int new_cell_x = (int)((player.x - speed - maze_position.x) / MAZE_SCALE);
-                        if (!(pixels[player_cell_y * im_maze.width + new_cell_x].r == 255)) move.x = -speed;
-                    }
+            // Zoom control: mouse wheel changes zoom target, camera zoom eased towards it
+            // NOTE: Endless maze keeps default zoom, chunks are only streamed around default view
+            float wheel = GetMouseWheelMove();
 
-                    if (IsKeyDown(KEY_D) || IsKeyDown(KEY_RIGHT)) {
-                        int new_cell_x = (int)((player.x + speed - maze_position.x) / MAZE_SCALE);
-                        if (!(pixels[player_cell_y * im_maze.width + new_cell_x].r == 255)) move.x = speed;
-                    }
-                }
+            if (endless_mode) zoom_target = MAZE_ZOOM_DEFAULT;
+            else if (wheel != 0.0f)
+            {
+                float zoom_min = (float)screen_width/(maze_grid.width*MAZE_SCALE);
+                if (((float)screen_height/(maze_grid.height*MAZE_SCALE)) < zoom_min) zoom_min = (float)screen_height/(maze_grid.height*MAZE_SCALE);
+                if (zoom_min > MAZE_ZOOM_DEFAULT) zoom_min = MAZE_ZOOM_DEFAULT;
 
-                player.x += move.x;
-                player.y += move.y;
+                zoom_target *= (wheel > 0.0f)? MAZE_ZOOM_STEP : 1.0f/MAZE_ZOOM_STEP;
+                if (zoom_target < zoom_min) zoom_target = zoom_min;
+                if (zoom_target > MAZE_ZOOM_MAX) zoom_target = MAZE_ZOOM_MAX;
+            }
 
-                player_cell_x = (int)((player.x - maze_position.x) / MAZE_SCALE);
-                player_cell_y = (int)((player.y - maze_position.y) / MAZE_SCALE);
-                if (player_cell_x >= 0 && player_cell_x < im_maze.width && player_cell_y >= 0 && player_cell_y < im_maze.height)
-                {
-                    Color pixel_color = pixels[player_cell_y * im_maze.width + player_cell_x];
-                    if (ColorToInt(pixel_color) == ColorToInt(GREEN)) // Player Wins
-                        player_won = true;
-                    // TODO: [1p] Camera 2D system following player movement around the map
-                    // Update Camera2D parameters as required to follow player and zoom control
-                    // TODO: [2p] Maze items pickup logic
-                    if (ColorToInt(pixel_color) == ColorToInt(RED)) //Player Picks Item
-                    {
-                        ImageDrawPixel(&im_maze, player_cell_x, player_cell_y, BLACK);
-                        UpdateTexture(tex_maze, im_maze.data);
-                        score += 10;
-                    }
-                }
-                UnloadImageColors(pixels);
+            float zoom_ease = GetFrameTime()*MAZE_ZOOM_SPEED;
+            camera2d.zoom += (zoom_target - camera2d.zoom)*((zoom_ease < 1.0f)? zoom_ease : 1.0f);
+
+            // Reveal minimap cells around player, only new cells queued for drawing
+            if (!endless_mode) RevealMazeMinimap(&maze_minimap, GetMazeWorldCell(maze_sim.state.player_x, maze_sim.origin_x, MAZE_SCALE),
+                GetMazeWorldCell(maze_sim.state.player_y, maze_sim.origin_y, MAZE_SCALE), MAZE_MINIMAP_REVEAL);
+
+            // Request endless maze chunks around camera view (and one chunk further), generated in background
+            if (endless_mode) UpdateMazeStream(&maze_stream, camera2d, maze_position, MAZE_SCALE, 1);
+
+            EndMazeProfilePhase(&profiler, PROFILE_GAME_UPDATE);
+
+            // Flow field target follows player cell, agents updated for same simulation ticks
+            // NOTE: Endless maze has no agents, only fixed maze cells are navigated
+            if (!endless_mode && (maze_agents.count > 0))
+            {
+                BeginMazeProfilePhase(&profiler, PROFILE_AGENTS);
+                SetMazeFlowTarget(&maze_flow, GetMazeWorldCell(maze_sim.state.player_x, maze_sim.origin_x, MAZE_SCALE),
+                    GetMazeWorldCell(maze_sim.state.player_y, maze_sim.origin_y, MAZE_SCALE));
+                UpdateMazeAgents(&maze_agents, maze_grid, &maze_flow, jobs_pool, sim_ticks);
+                EndMazeProfilePhase(&profiler, PROFILE_AGENTS);
             }
-            camera2d.target = (Vector2){ player.x, player.y };
         }
         else if (current_mode == 1) // Editor mode
         {
+            BeginMazeProfilePhase(&profiler, PROFILE_EDITOR_UPDATE);
+
             // TODO: [2p] Maze editor mode, edit image pixels with mouse.
             // Implement logic to selecte image cell from mouse position -> TIP: GetMousePosition()
             // NOTE: Mouse position is returned in screen coordinates and it has to 
@@ -198,27 +826,91 @@ int main(void)
 
             // TODO: [2p] Collectible map items: player score
             // Using same mechanism than maze editor, implement an items editor, registering
-            // points in the map where items should be added for player pickup -> TIP: Use maze_items[]
+            // points in the map where items should be added for player pickup -> TIP: Use maze_items
 
             Vector2 mouse_pos = GetMousePosition();
             int cell_x = (mouse_pos.x - maze_position.x) / MAZE_SCALE;
             int cell_y = (mouse_pos.y - maze_position.y) / MAZE_SCALE;
-            Color* pixels = LoadImageColors(im_maze);
+            int paint_cell = -1;
+            int paint_item = MAZE_ITEM_COIN;
 
             if (IsMouseButtonDown(MOUSE_BUTTON_LEFT))
-                ImageDrawPixel(&im_maze, cell_x, cell_y, BLACK); // Cambia un pixel a negro (camino)
+                paint_cell = MAZE_CELL_FLOOR;   // Cambia un pixel a negro (camino)
             if (IsMouseButtonDown(MOUSE_BUTTON_RIGHT))
-                ImageDrawPixel(&im_maze, cell_x, cell_y, WHITE); // Cambia un pixel a blanco (pared)
+                paint_cell = MAZE_CELL_WALL;    // Cambia un pixel a blanco (pared)
             if (IsMouseButtonDown(MOUSE_BUTTON_MIDDLE))
-                ImageDrawPixel(&im_maze, cell_x, cell_y, RED);   // Aade un tem
+            {
+                paint_cell = MAZE_CELL_ITEM;    // Aade un tem
+                if (IsKeyDown(KEY_LEFT_SHIFT)) paint_item = MAZE_ITEM_GEM;
+            }
             if (IsKeyDown(KEY_LEFT_CONTROL) && IsMouseButtonDown(MOUSE_BUTTON_RIGHT))
-                ImageDrawPixel(&im_maze, cell_x, cell_y, GREEN); // Marca el final del laberinto
-            UpdateTexture(tex_maze, im_maze.data);
-            UnloadImageColors(pixels);
+                paint_cell = MAZE_CELL_GOAL;    // Marca el final del laberinto
+
+            if (IsKeyPressed(KEY_T)) edit_tool = (edit_tool + 1)%EDIT_TOOL_COUNT;
+
+            // Tools edit maze_grid cells directly, edited cells gathered into one batch
+            // NOTE: End cell is always painted as one cell under mouse, whatever the tool
+            int paint_value = paint_cell | ((paint_cell == MAZE_CELL_ITEM)? (paint_item << 2) : 0);
+            ClearMazeEditBatch(&edit_batch);
+
+            if ((paint_cell != -1) && !stroke_active)
+            {
+                // Mouse stroke edits merged into one undo command, until all buttons released
+                BeginMazeEdit(&maze_undo);
+                stroke_active = true;
+                stroke_start = (Point){ cell_x, cell_y };
+                stroke_value = paint_value;
+
+                if (paint_cell == MAZE_CELL_GOAL) PaintMazeCell(&maze_grid, &edit_batch, cell_x, cell_y, paint_value);
+                else if (edit_tool == EDIT_TOOL_BRUSH) PaintMazeCell(&maze_grid, &edit_batch, cell_x, cell_y, paint_value);
+                else if (edit_tool == EDIT_TOOL_FILL) FloodFillMaze(&maze_grid, &edit_batch, cell_x, cell_y, paint_value);
+            }
+            else if (paint_cell != -1)
+            {
+                // Brush stroke interpolated from previous frame cell, fast mouse movement leaves no gaps
+                if (paint_cell == MAZE_CELL_GOAL) PaintMazeCell(&maze_grid, &edit_batch, cell_x, cell_y, paint_value);
+                else if (edit_tool == EDIT_TOOL_BRUSH) PaintMazeLine(&maze_grid, &edit_batch, stroke_cell.x, stroke_cell.y, cell_x, cell_y, paint_value);
+            }
+            else if (stroke_active && ((stroke_value & 0x03) != MAZE_CELL_GOAL))
+            {
+                // Stroke ended, line and rectangles painted from stroke start to current cell
+                if (edit_tool == EDIT_TOOL_LINE) PaintMazeLine(&maze_grid, &edit_batch, stroke_start.x, stroke_start.y, cell_x, cell_y, stroke_value);
+                else if (edit_tool == EDIT_TOOL_RECT) PaintMazeRect(&maze_grid, &edit_batch, stroke_start.x, stroke_start.y, cell_x, cell_y, stroke_value, false);
+                else if (edit_tool == EDIT_TOOL_RECT_FILLED) PaintMazeRect(&maze_grid, &edit_batch, stroke_start.x, stroke_start.y, cell_x, cell_y, stroke_value, true);
+            }
+
+            stroke_cell = (Point){ cell_x, cell_y };
+
+            // Keep maze_items, path and history in sync, textures updated once for batch area
+            if (edit_batch.count > 0)
+            {
+                CommitMazeEditBatch(&edit_context, &edit_batch, &maze_undo);
+
+                // Last placed goal becomes the path end
+                if ((edit_batch.value & 0x03) == MAZE_CELL_GOAL)
+                {
+                    end_cell = (Point){ cell_x, cell_y };
+                    SetMazePathEnds(&maze_path, start_cell.x, start_cell.y, end_cell.x, end_cell.y);
+                }
+            }
+
+            if ((paint_cell == -1) && stroke_active)
+            {
+                EndMazeEdit(&maze_undo);
+                stroke_active = false;
+                maze_edited = true;
+            }
+
+            // Undo/redo last mouse stroke: [CTRL + Z] / [CTRL + Y]
+            if (IsKeyDown(KEY_LEFT_CONTROL) && IsKeyPressed(KEY_Z) && (UndoMazeEdit(&maze_undo, ApplyMazeEdit, &edit_context) > 0)) maze_edited = true;
+            if (IsKeyDown(KEY_LEFT_CONTROL) && IsKeyPressed(KEY_Y) && (RedoMazeEdit(&maze_undo, ApplyMazeEdit, &edit_context) > 0)) maze_edited = true;
+            UpdateMazeEditArea(&edit_context);
+
+            EndMazeProfilePhase(&profiler, PROFILE_EDITOR_UPDATE);
         }
         
         // TODO: [1p] Multiple maze biomes supported
-        // Implement changing between the different textures to be used as biomes
+        // NOTE: All biomes share the atlas texture, changing biome only changes tiles texture coordinates offset
         // NOTE: For the 3d model, the current selected texture must be applied to the model material  
         if(IsKeyPressed(KEY_ONE))
         {
@@ -236,53 +928,108 @@ int main(void)
         {
             current_biome = 3;
         } 
-        
+        SetMazeMeshBiome(&maze_mesh, current_biome);
+
+        // Search maze path again, only if any edit invalidated it
+        BeginMazeProfilePhase(&profiler, PROFILE_PATH);
+        UpdateMazePath(&maze_path);
+        EndMazeProfilePhase(&profiler, PROFILE_PATH);
+
+        // Upload only maze texture regions changed by editor or items pickup, if any
+        BeginMazeProfilePhase(&profiler, PROFILE_UPLOAD);
+        upload_bytes = UpdateMazeTextureRegions(&maze_overview, &maze_dirty, &maze_tiles, maze_grid, maze_atlas, &maze_tilemap, &maze_mesh, &maze_minimap);
+
+        // Draw newly revealed and changed minimap pixels into minimap render texture
+        UpdateMazeMinimap(&maze_minimap, maze_grid);
+
+        // Rebuild edited 3d mesh chunks, only while 3d view is shown (pending chunks kept dirty)
+        if (show_3d && (current_mode == 0) && !endless_mode) UpdateMazeMesh(&maze_mesh, maze_grid);
+        AddMazeProfileCounter(&profiler, MAZE_PROFILE_UPLOAD_BYTES, upload_bytes);
+
+        // Maze metrics computed again only for a new maze or a finished editor stroke
+        // NOTE: Items pickup and budgeted texture uploads do not change maze structure
+        if (maze_changed || maze_edited) maze_analysis = AnalyzeMaze(&maze_analyzer, maze_grid, start_cell.x, start_cell.y, end_cell.x, end_cell.y);
+        EndMazeProfilePhase(&profiler, PROFILE_UPLOAD);
         //----------------------------------------------------------------------------------
 
         // Draw
         //----------------------------------------------------------------------------------
+        // NOTE: Drawing phases measure CPU time to batch draws, GPU work happens when
+        // batch is flushed, mostly on EndDrawing() (present phase)
         BeginDrawing();
 
         ClearBackground(DARKGRAY);
 
         if (current_mode == 0) // Game mode
         {
+            BeginMazeProfilePhase(&profiler, PROFILE_DRAW_TILES);
+
+            // Draw maze 3d view, camera3d following player from above
+            // NOTE: Mesh in cells units, one draw call per chunk
+            bool draw_3d = show_3d && !endless_mode;
+            if (draw_3d)
+            {
+                camera3d.target = (Vector3){ (player.x - maze_position.x)/MAZE_SCALE, 0.0f, (player.y - maze_position.y)/MAZE_SCALE };
+                camera3d.position = (Vector3){ camera3d.target.x, camera3d.target.y + 14.0f, camera3d.target.z + 10.0f };
+
+                BeginMode3D(camera3d);
+                DrawMazeMesh(maze_mesh, (Vector3){ 0.0f, 0.0f, 0.0f }, 1.0f);
+                DrawCube((Vector3){ camera3d.target.x, 0.25f, camera3d.target.z }, 0.4f, 0.5f, 0.4f, BLUE);
+                DrawCube((Vector3){ end_cell.x + 0.5f, 0.25f, end_cell.y + 0.5f }, 0.5f, 0.5f, 0.5f, GREEN);
+                EndMode3D();
+
+                render_stats = (MazeRenderStats){ 0, maze_mesh.chunks_x*maze_mesh.chunks_y };
+            }
+
             // Draw maze using camera2d (for automatic positioning and scale)
             BeginMode2D(camera2d);
 
-            // TODO: Draw maze walls and floor using current texture biome 
-            for (int y = 0; y < im_maze.height; y++)
+            // Draw maze walls and floor using current biome atlas tiles
+            // NOTE: Only tiles visible through camera2d are drawn, batched in a single quads stream
+            // NOTE: Endless maze chunks drawn with one texture each, fixed maze items and path not drawn
+            // NOTE: Zoomed out, maze overview fades in over tiles, drawn alone (one quad) once cells get too small
+            // NOTE: Tilemap renderer draws all visible tiles as one quad, cells looked up by tilemap shader,
+            // its overview drawn from tilemap cells texture (cell types)
+            float lod_blend = GetMazeLodBlend(camera2d, MAZE_SCALE, MAZE_LOD_FADE_START, MAZE_LOD_FADE_END);
+            if (endless_mode) render_stats = (MazeRenderStats){ 0, DrawMazeStream(&maze_stream, camera2d, maze_position, MAZE_SCALE) };
+            else if (!draw_3d)
             {
-                for (int x = 0; x < im_maze.width; x++)
+                if (tilemap_mode)
                 {
-                    if (ColorIsEqual(GetImageColor(im_maze, x, y), WHITE))
-                    {
-                        DrawTexturePro(tex_biomes[current_biome], (Rectangle){ 0, tex_biomes[current_biome].height/2, tex_biomes[current_biome].width/2, tex_biomes[current_biome].height/2 },
-                            (Rectangle){ maze_position.x + x*MAZE_SCALE, maze_position.y + y*MAZE_SCALE, MAZE_SCALE, MAZE_SCALE }, 
-                            (Vector2){ 0 }, 0.0f, WHITE);
-                    }
-                    else
-                    {
-                        DrawTexturePro(tex_biomes[current_biome], (Rectangle){ tex_biomes[current_biome].width/2, tex_biomes[current_biome].height/2, tex_biomes[current_biome].width/2, tex_biomes[current_biome].height/2 },
-                            (Rectangle){ maze_position.x + x*MAZE_SCALE, maze_position.y + y*MAZE_SCALE, MAZE_SCALE, MAZE_SCALE }, 
-                            (Vector2){ 0 }, 0.0f, WHITE);
-                    }
+                    if (lod_blend < 1.0f) render_stats = DrawMazeTilemap(maze_tilemap, maze_atlas, current_biome, camera2d, maze_position, MAZE_SCALE, NULL);
+                    else render_stats = (MazeRenderStats){ 0 };
+                    render_stats.draw_calls += DrawMazeOverviewTexture(maze_overview, maze_tilemap.texture, MAZE_TILEMAP_TYPE_SHIFT, camera2d, maze_position, MAZE_SCALE, lod_blend);
                 }
+                else render_stats = DrawMazeLod(maze_tiles, maze_atlas, current_biome, maze_overview, camera2d, maze_position, MAZE_SCALE, lod_blend);
             }
+            MazeViewRange view = (endless_mode || draw_3d)? (MazeViewRange){ 0, 0, -1, -1 } : GetMazeViewRange(maze_grid, camera2d, maze_position, MAZE_SCALE);
+            MazeViewRange cells_view = (lod_blend < 1.0f)? view : (MazeViewRange){ 0, 0, -1, -1 };   // Items and path only drawn over tiles
+            AddMazeProfileCounter(&profiler, MAZE_PROFILE_DRAW_CALLS_EST, render_stats.draw_calls);
+
+            EndMazeProfilePhase(&profiler, PROFILE_DRAW_TILES);
+            BeginMazeProfilePhase(&profiler, PROFILE_DRAW_ITEMS);
+
+            if (show_path && (lod_blend < 1.0f)) DrawMazePath(maze_path, view, maze_position, MAZE_SCALE, Fade(YELLOW, 0.6f));
+
+            if (!endless_mode) DrawMazeAgents(maze_agents, view, maze_position, MAZE_SCALE);
+
             // TODO: Draw player rectangle or sprite at player position
-            DrawRectangleRec(player, BLUE);
+            if (!draw_3d) DrawRectangleRec(player, BLUE);
             // TODO: Draw maze items 2d (using sprite texture?)
-            for (int y = 0; y < im_maze.height; y++)
+            for (int y = cells_view.min_y; y <= cells_view.max_y; y++)
             {
-                for (int x = 0; x < im_maze.width; x++)
+                for (int x = cells_view.min_x; x <= cells_view.max_x; x++)
                 {
-                    if (ColorIsEqual(GetImageColor(im_maze, x, y), RED))
+                    int cell = GetMazeCell(maze_grid, x, y);
+                    if (cell == MAZE_CELL_ITEM)
                     {
+                        // NOTE: Item type lookup by cell, no items list traversal required
+                        int item_type = GetMazeItemType(&maze_items, GetMazeItemAt(&maze_items, x, y));
                         Vector2 item_position = {maze_position.x + x * MAZE_SCALE + MAZE_SCALE / 2, maze_position.y + y * MAZE_SCALE + MAZE_SCALE / 2};
-                        DrawCircleV(item_position, MAZE_SCALE / 4, RED);
+                        DrawCircleV(item_position, MAZE_SCALE / 4, GetMazeItemColor(item_type));
                     }
                     //Draw the End
-                    if (ColorIsEqual(GetImageColor(im_maze, x, y), GREEN))
+                    if (cell == MAZE_CELL_GOAL)
                     {
                         Vector2 end_position = {maze_position.x + x * MAZE_SCALE + MAZE_SCALE / 2, maze_position.y + y * MAZE_SCALE + MAZE_SCALE / 2};
                         DrawRectangleV(end_position, (Vector2){ MAZE_SCALE / 2, MAZE_SCALE / 2 }, GREEN);
@@ -291,8 +1038,31 @@ int main(void)
             }
             
             EndMode2D();
-            DrawText(TextFormat("Score: %d", score), screen_width - 190, 20, 30, BLACK);
-            if (player_won)
+
+            EndMazeProfilePhase(&profiler, PROFILE_DRAW_ITEMS);
+            BeginMazeProfilePhase(&profiler, PROFILE_DRAW_UI);
+
+            DrawText(TextFormat("Score: %d", maze_sim.state.score), screen_width - 190, 20, 30, BLACK);
+            if (endless_mode) DrawText(TextFormat("CHUNKS: %i RESIDENT - %i PENDING - %i EVICTED - DRAW CALLS (EST): %i", maze_stream.stats.resident,
+                maze_stream.stats.pending, maze_stream.stats.evicted, render_stats.draw_calls), 10, 116, 10, YELLOW);
+            else DrawText(TextFormat("TILES: %i - DRAW CALLS (EST): %i - ZOOM: %.2f (OVERVIEW: %i%%)", render_stats.visible_tiles, render_stats.draw_calls,
+                camera2d.zoom, (int)(lod_blend*100.0f)), 10, 116, 10, YELLOW);
+            if (recording) DrawText(TextFormat("REC: %i TICKS", maze_replay.log.ticks), 10, 156, 10, RED);
+            if (maze_agents.count > 0) DrawText(TextFormat("AGENTS: %i (%.2f ms, %i JOBS) - ON PLAYER: %i - FLOW: %i CELLS (%.2f ms)", maze_agents.count,
+                maze_agents.stats.time*1000.0, maze_agents.stats.jobs, maze_agents.stats.at_target, maze_flow.stats.visited, maze_flow.stats.time*1000.0), 10, 176, 10, YELLOW);
+            if (draw_3d) DrawText(TextFormat("MESH: %i CHUNKS - %i TRIANGLES - REBUILT: %i (%.2f ms)", maze_mesh.chunks_x*maze_mesh.chunks_y,
+                maze_mesh.stats.triangles, maze_mesh.stats.rebuilt, maze_mesh.stats.time*1000.0), 10, 196, 10, YELLOW);
+            if (show_minimap && !endless_mode)
+            {
+                // NOTE: Minimap drawn from its render texture, one quad, no cells drawing
+                float minimap_scale = (float)MAZE_MINIMAP_SIZE/((maze_minimap.map_width > maze_minimap.map_height)? maze_minimap.map_width : maze_minimap.map_height);
+                Rectangle minimap_bounds = { screen_width - maze_minimap.map_width*minimap_scale - 10, screen_height - maze_minimap.map_height*minimap_scale - 10,
+                    maze_minimap.map_width*minimap_scale, maze_minimap.map_height*minimap_scale };
+                DrawMazeMinimap(maze_minimap, minimap_bounds, (Vector2){ (player.x - maze_position.x)/MAZE_SCALE, (player.y - maze_position.y)/MAZE_SCALE }, BLUE);
+                DrawText(TextFormat("MINIMAP: %i%% EXPLORED - %i PIXELS DRAWN (%.3f ms)", (int)(100.0f*maze_minimap.stats.explored/(maze_grid.width*maze_grid.height)),
+                    maze_minimap.stats.drawn, maze_minimap.stats.time*1000.0), 10, 216, 10, YELLOW);
+            }
+            if (maze_sim.state.won)
             {
                 DrawRectangle(0, 0, screen_width, screen_height, Fade(WHITE, 0.6f));
                 DrawText("You Won!", screen_width / 2 - 100, screen_height / 2 - 30, 50, GREEN);
@@ -300,42 +1070,144 @@ int main(void)
             // TODO: Draw game UI (score, time...) using custom sprites/fonts
             // NOTE: Game UI does not receive the camera2d transformations,
             // it is drawn in screen space coordinates directly
+
+            EndMazeProfilePhase(&profiler, PROFILE_DRAW_UI);
         }
         else if (current_mode == 1) // Editor mode
         {
+            BeginMazeProfilePhase(&profiler, PROFILE_DRAW_TILES);
+
             // Draw generated maze texture, scaled and centered on screen 
-            DrawTextureEx(tex_maze, maze_position, 0.0f, MAZE_SCALE, WHITE);
+            // NOTE: Tilemap renderer draws biome tiles instead, cell types marked as maze overview colors
+            Camera2D camera_editor = { { 0.0f, 0.0f }, { 0.0f, 0.0f }, 0.0f, 1.0f };
+
+            if (tilemap_mode)
+            {
+                Color cell_colors[4] = { BLANK, BLANK, Fade(RED, 0.6f), Fade(GREEN, 0.6f) };
+
+                BeginMode2D(camera_editor);
+                MazeRenderStats editor_stats = DrawMazeTilemap(maze_tilemap, maze_atlas, current_biome, camera_editor, maze_position, MAZE_SCALE, cell_colors);
+                EndMode2D();
+
+                AddMazeProfileCounter(&profiler, MAZE_PROFILE_DRAW_CALLS_EST, editor_stats.draw_calls);
+            }
+            else
+            {
+                int draw_calls = DrawMazeOverview(maze_overview, camera_editor, maze_position, MAZE_SCALE, 1.0f);
+                AddMazeProfileCounter(&profiler, MAZE_PROFILE_DRAW_CALLS_EST, draw_calls);
+            }
 
             // Draw lines rectangle over texture, scaled and centered on screen 
-            DrawRectangleLines(maze_position.x, maze_position.y, MAZE_WIDTH * MAZE_SCALE, MAZE_HEIGHT * MAZE_SCALE, RED);
+            DrawRectangleLines(maze_position.x, maze_position.y, maze_grid.width * MAZE_SCALE, maze_grid.height * MAZE_SCALE, RED);
+
+            EndMazeProfilePhase(&profiler, PROFILE_DRAW_TILES);
+            BeginMazeProfilePhase(&profiler, PROFILE_DRAW_ITEMS);
+
+            if (show_path) DrawMazePath(maze_path, (MazeViewRange){ 0, 0, maze_grid.width - 1, maze_grid.height - 1 }, maze_position, MAZE_SCALE, Fade(YELLOW, 0.6f));
+
+            // Line and rectangle tools preview, painted when stroke ends
+            if (stroke_active && ((stroke_value & 0x03) != MAZE_CELL_GOAL))
+            {
+                Vector2 preview_start = { maze_position.x + (stroke_start.x + 0.5f)*MAZE_SCALE, maze_position.y + (stroke_start.y + 0.5f)*MAZE_SCALE };
+                Vector2 preview_end = { maze_position.x + (stroke_cell.x + 0.5f)*MAZE_SCALE, maze_position.y + (stroke_cell.y + 0.5f)*MAZE_SCALE };
+                Color preview_color = Fade(GetMazeCellColor(stroke_value & 0x03), 0.5f);
+
+                if (edit_tool == EDIT_TOOL_LINE) DrawLineEx(preview_start, preview_end, MAZE_SCALE, preview_color);
+                else if ((edit_tool == EDIT_TOOL_RECT) || (edit_tool == EDIT_TOOL_RECT_FILLED))
+                {
+                    int min_x = (stroke_start.x < stroke_cell.x)? stroke_start.x : stroke_cell.x;
+                    int min_y = (stroke_start.y < stroke_cell.y)? stroke_start.y : stroke_cell.y;
+                    Rectangle preview = { maze_position.x + min_x*MAZE_SCALE, maze_position.y + min_y*MAZE_SCALE,
+                        (abs(stroke_cell.x - stroke_start.x) + 1)*MAZE_SCALE, (abs(stroke_cell.y - stroke_start.y) + 1)*MAZE_SCALE };
+
+                    if (edit_tool == EDIT_TOOL_RECT) DrawRectangleLinesEx(preview, MAZE_SCALE, preview_color);
+                    else DrawRectangleRec(preview, preview_color);
+                }
+            }
 
             // TODO: Draw player using a rectangle, consider maze screen coordinates!
 
             // TODO: Draw editor UI required elements
+
+            EndMazeProfilePhase(&profiler, PROFILE_DRAW_ITEMS);
         }
+
+        BeginMazeProfilePhase(&profiler, PROFILE_DRAW_UI);
+
         // Draw required UI info
         DrawText("[R] GENERATE NEW RANDOM SEQUENCE", 10, 36, 10, LIGHTGRAY);
         DrawText("[ESC] QUIT GAME", 10, 56, 10, LIGHTGRAY);
-        DrawText(TextFormat("SEED: %i", seed), 10, 76, 10, YELLOW);
+        DrawText(TextFormat("SEED: %i%s%s", seed, swap_pending? " - GENERATING NEXT MAZE..." : "", (atlas_loader.thread != NULL)? " - LOADING BIOMES..." : ""), 10, 76, 10, YELLOW);
+        DrawText(TextFormat("TEXTURE UPLOAD: %i BYTES", upload_bytes), 10, 96, 10, YELLOW);
+        if (maze_path.reachable) DrawText(TextFormat("PATH: %i CELLS (SEARCH: %.2f ms)", maze_path.length, maze_path.stats.time*1000.0), 10, 136, 10, YELLOW);
+        else DrawText("PATH: END NOT REACHABLE!", 10, 136, 10, RED);
+        if (current_mode == 1) DrawText(TextFormat("HISTORY: %i COMMANDS, %i EDITS (%i KB)", maze_undo.stats.commands, maze_undo.stats.edits, (int)(maze_undo.stats.memory/1024)), 10, 156, 10, YELLOW);
+        if (current_mode == 1) DrawText(TextFormat("TOOL: %s", edit_tool_names[edit_tool]), 10, 176, 10, YELLOW);
+        if (current_mode == 1) DrawText(TextFormat("ANALYSIS: PATH %i - DEAD ENDS %i - LOOPS %i - JUNCTIONS %i - AREAS %i - BRANCHING %.2f (%.3f ms)",
+            maze_analysis.path_length, maze_analysis.dead_ends, maze_analysis.loops, maze_analysis.junctions, maze_analysis.components,
+            maze_analysis.branching, maze_analysis.time*1000.0), 10, 216, 10, YELLOW);
+        if (current_mode == 1) DrawText(TextFormat("GENERATOR: %s (%s%.2f ms, %i KB PEAK)", GetMazeGenerator(maze_algorithm)->name, gen_cached? "CACHED, " : "", gen_stats.time*1000.0, (int)(gen_stats.peak_memory/1024)), 10, 196, 10, YELLOW);
         
         //CONTROLS
-        DrawText("[AWDS/ARROW KEYS] PLAYER MOVEMENT", 10, GetScreenHeight() - 70, 10, WHITE);
+        DrawText("[G] CHANGE MAZE GENERATOR (EDITOR)", 10, GetScreenHeight() - 150, 10, WHITE);
+        DrawText("[T] CHANGE EDIT TOOL (EDITOR)", 10, GetScreenHeight() - 140, 10, WHITE);
+        DrawText("[CTRL + Z/Y] UNDO/REDO EDIT (EDITOR)", 10, GetScreenHeight() - 130, 10, WHITE);
+        DrawText("[F3] PROFILER OVERLAY - [F4] EXPORT PROFILE - [F5] TOGGLE TILEMAP RENDERER", 10, GetScreenHeight() - 120, 10, WHITE);
+        DrawText("[F2] RECORD SESSION (GAME)", 10, GetScreenHeight() - 110, 10, WHITE);
+        DrawText("[CTRL + S/L] SAVE/LOAD MAZE FILE (EDITOR)", 10, GetScreenHeight() - 100, 10, WHITE);
+        DrawText("[I] TOGGLE ENDLESS MAZE - [V] TOGGLE 3D VIEW (GAME)", 10, GetScreenHeight() - 90, 10, WHITE);
+        DrawText("[P] TOGGLE PATH OVERLAY - [N] TOGGLE AGENTS - [M] TOGGLE MINIMAP", 10, GetScreenHeight() - 80, 10, WHITE);
+        DrawText("[AWDS/ARROW KEYS] PLAYER MOVEMENT - [MOUSE WHEEL] ZOOM (GAME)", 10, GetScreenHeight() - 70, 10, WHITE);
         DrawText("[SPACE] TOGGLE MODE: EDITOR/GAME", 10, GetScreenHeight() - 60, 10, WHITE);
         DrawText("[LEFT CLICK] CREATE PATH ", 10, GetScreenHeight() - 50, 10, WHITE);
         DrawText("[RIGHT CLICK] CREATE WALL ", 10, GetScreenHeight() - 40, 10, WHITE);
-        DrawText("[MIDDLE CLICK] ADD ITEM ", 10, GetScreenHeight() - 30, 10, WHITE);
+        DrawText("[MIDDLE CLICK] ADD ITEM (+SHIFT: GEM) ", 10, GetScreenHeight() - 30, 10, WHITE);
         DrawText("[CTRL + RIGHT CLICK] SET END ", 10, GetScreenHeight() - 20, 10, WHITE);
 
+        if (show_profiler) DrawMazeProfiler(&profiler, GetScreenWidth() - 330, 60);
+
         DrawFPS(10, 10);
 
+        EndMazeProfilePhase(&profiler, PROFILE_DRAW_UI);
+
+        BeginMazeProfilePhase(&profiler, PROFILE_PRESENT);
         EndDrawing();
+        EndMazeProfilePhase(&profiler, PROFILE_PRESENT);
+
+        EndMazeProfileFrame(&profiler);
         //----------------------------------------------------------------------------------
     }
 
     // De-Initialization
     //--------------------------------------------------------------------------------------
-    UnloadTexture(tex_maze);     // Unload maze texture from VRAM (GPU)
-    UnloadImage(im_maze);        // Unload maze image from RAM (CPU)
+    UnloadMazeOverview(&maze_overview); // Unload maze overview cells texture and shader
+    UnloadMazeGrid(maze_grid);   // Unload maze cells grid from RAM (CPU)
+    UnloadMazeItems(&maze_items); // Unload maze items storage
+    UnloadMazeDirtyRegions(&maze_dirty); // Unload maze texture edits tracking
+    UnloadMazePath(&maze_path);  // Unload maze path data
+    UnloadMazeFlowField(&maze_flow); // Unload agents flow field
+    UnloadMazeAgents(&maze_agents); // Unload agents data
+    UnloadMazeJobPool(jobs_pool);   // Unload jobs pool, stopping its threads
+    UnloadMazeStream(&maze_stream); // Unload endless maze chunks, stopping generation thread
+    UnloadMazeReplay(&maze_replay); // Unload recorded session input
+    UnloadMazeProfiler(&profiler);  // Unload frame profiler frames
+    UnloadMazeUndo(&maze_undo);     // Unload editor undo history
+    UnloadMazeEditBatch(&edit_batch); // Unload editor tools batch
+    UnloadMazeTiles(&maze_tiles);   // Unload maze cells atlas tiles
+    UnloadMazeTilemap(&maze_tilemap); // Unload maze tilemap cells texture and shader
+    UnloadMazeMesh(&maze_mesh);     // Unload maze 3d mesh chunks and material
+    UnloadMazeMinimap(&maze_minimap); // Unload minimap render texture and explored cells
+    UnloadMazeAnalyzer(&maze_analyzer); // Unload maze metrics buffers
+    UnloadMazePregen(&maze_pregen); // Unload maze pre-generation, stopping generation thread
+    TraceLog(LOG_INFO, "MAZE: [%s] Cache: %i hits, %i misses, %i damaged, %i evicted (%i entries, %i KB)", MAZE_CACHE_PATH, maze_cache.stats.hits,
+        maze_cache.stats.misses, maze_cache.stats.damaged, maze_cache.stats.evicted, maze_cache.stats.entries, (int)(maze_cache.stats.size/1024));
+    UnloadMazeCache(&maze_cache);   // Unload generated mazes cache, cached mazes kept on disk
+    free(swap_cells);               // Unload swapped maze packed cells, if not used yet
+    JoinMazeThread(atlas_loader.thread); // Wait for biomes atlas loading, if still running
+    if (atlas_loader.done) UnloadImage(atlas_loader.image);
+    UnloadMazeMutex(atlas_loader.mutex);
+    free(search_seeds);             // Unload found seeds list
+    UnloadMazeAtlas(&maze_atlas);   // Unload biomes atlas texture
 
     // TODO: Unload all loaded resources
 
@@ -349,101 +1221,365 @@ int main(void)
 // NOTE: Color scheme used: WHITE = Wall, BLACK = Walkable, RED = Item
 Image GenImageMaze(int width, int height, int spacing_rows, int spacing_cols, float point_chance)
 {
-    Image im_maze = { 0 };
+    // NOTE: Generator random state seeded from raylib random generator,
+    // so same raylib seed (SetRandomSeed()) gives same maze
+    MazeRandom rng = { 0 };
+    SetMazeRandomSeed(&rng, (unsigned int)GetRandomValue(0, 1000000000));
+
+    // Maze is generated as cells grid, image only created at the end
+    MazeGrid grid = GenMazeGrid(width, height, spacing_rows, spacing_cols, point_chance, &rng, NULL);
+    Image im_maze = GenImageFromMazeGrid(grid);
+
+    UnloadMazeGrid(grid);
 
-    // STEP 1: Generate empty image with borders
-    //---------------------------------------------------------------------------------
-    // STEP 1.1: Generate image of plain color
-    im_maze = GenImageColor(width, height, BLACK);
+    return im_maze;
+}
 
-    // STEP 1.2: Draw image border
-    for (int y = 0; y < im_maze.height; y++)
+// Generate maze image from maze cells grid
+// NOTE: Color scheme used: WHITE = Wall, BLACK = Walkable, RED = Item, GREEN = End
+Image GenImageFromMazeGrid(MazeGrid grid)
+{
+    Image image = GenImageColor(grid.width, grid.height, BLACK);
+    Color *pixels = (Color *)image.data;
+
+    if (pixels != NULL)
     {
-        for (int x = 0; x < im_maze.width; x++)
+        for (size_t i = 0; i < (size_t)grid.width*grid.height; i++)
         {
-            if ((x == 0) || (x == (im_maze.width - 1)) ||
-                (y == 0) || (y == (im_maze.height - 1)))
-            {
-                ImageDrawPixel(&im_maze, x, y, WHITE);
-            }
+            if (grid.cells[i] != MAZE_CELL_FLOOR) pixels[i] = GetMazeCellColor(grid.cells[i]);
         }
     }
-    //---------------------------------------------------------------------------------
-
-    // STEP 2: Set some random point in image at specific row-column distances
-    //---------------------------------------------------------------------------------
-    // STEP 2.1: Define an array of point used for maze generation
-    // NOTE A: Static array allocation, memory allocated in STACK (MAX: 1MB)
-    // NOTE B: Dynamic array allocation, memory allocated in HEAP (MAX: Available RAM)
-    //Point maze_points[64] = { 0 }; // Static array
-    Point* maze_points = malloc(256 * sizeof(Point)); // Dynamic array (MAX: 256 points)
-    int maze_point_counter = 0;
-
-    // STEP 2.2: Store specific points, at specific row-column distances
-    for (int y = 0; y < im_maze.height; y++)
+
+    return image;
+}
+
+// Maze packed cells (overview texture data) prepared on background generation thread
+// NOTE: Cells packing only uses CPU memory, safe out of main thread, released with free()
+void *PrepareMazeCells(MazeGrid grid)
+{
+    unsigned char *packed = (unsigned char *)malloc((size_t)(grid.width + 3)/4*grid.height);
+
+    if ((packed != NULL) && (PackMazeCellsRows(grid, 0, 0, grid.width, grid.height, packed) == 0))
     {
-        for (int x = 0; x < im_maze.width; x++)
-        {
-            if ((x != 0) && (x != (im_maze.width - 1)) &&
-                (y != 0) && (y != (im_maze.height - 1)))
-            {
-                if ((x % spacing_cols == 0) && (y % spacing_rows == 0))
-                {
-                    if (GetRandomValue(0, 100) <= (int)(point_chance * 100))
-                    {
-                        maze_points[maze_point_counter] = (Point){ x, y };
-                        maze_point_counter++;
-                    }
-                }
-            }
-        }
+        free(packed);
+        packed = NULL;
     }
 
-    // STEP 2.3: Draw our points in image
-    for (int i = 0; i < maze_point_counter; i++)
+    return packed;
+}
+
+// Load maze grid from maze file cells, rows bands decoded in parallel by jobs pool
+MazeGrid LoadMazeGridFromFileJobs(MazeFile file, MazeJobPool *pool)
+{
+    if (!IsMazeFileValid(file)) return (MazeGrid){ 0 };
+
+    MazeFileDecode decode = { file, LoadMazeGrid(file.width, file.height), MAZE_DECODE_BAND_ROWS };
+
+    if (decode.grid.cells != NULL) RunMazeJobs(pool, DecodeMazeFileBand, &decode, (file.height + decode.band_rows - 1)/decode.band_rows);
+
+    return decode.grid;
+}
+
+// Decode maze file rows band into grid, job entry point (data: MazeFileDecode *)
+void DecodeMazeFileBand(void *data, int index)
+{
+    MazeFileDecode *decode = (MazeFileDecode *)data;
+    int y = index*decode->band_rows;
+    int count = (y + decode->band_rows > decode->file.height)? decode->file.height - y : decode->band_rows;
+
+    LoadMazeGridRowsFromFile(decode->grid, decode->file, y, count);
+}
+
+// Get request of the maze generated by [R]: next found seed (if seeds file loaded) or seed + 11
+MazePregenRequest GetNextMazeRequest(int algorithm, int seed, const int *seeds, int seed_count, int seed_index)
+{
+    MazePregenRequest request = { algorithm, (unsigned int)seed + 11, MAZE_WIDTH, MAZE_HEIGHT, 4, 4, 0.5f };
+
+    if (seed_count > 0) request.seed = (unsigned int)seeds[seed_index%seed_count];
+
+    return request;
+}
+
+// Biomes atlas image packing, loading thread entry point
+void LoadAtlasWorker(void *data)
+{
+    AtlasLoader *loader = (AtlasLoader *)data;
+    Image image = GenImageMazeAtlas(loader->file_names, loader->count, loader->tile_size);
+
+    LockMazeMutex(loader->mutex);
+    loader->image = image;
+    loader->done = true;
+    UnlockMazeMutex(loader->mutex);
+}
+
+// Get maze image color for a cell type
+Color GetMazeCellColor(int type)
+{
+    Color color = BLACK;
+
+    switch (type)
+    {
+        case MAZE_CELL_WALL: color = WHITE; break;
+        case MAZE_CELL_ITEM: color = RED; break;
+        case MAZE_CELL_GOAL: color = GREEN; break;
+        default: break;
+    }
+
+    return color;
+}
+
+// Get color used to draw an item type
+Color GetMazeItemColor(int type)
+{
+    Color color = RED;
+
+    switch (type)
+    {
+        case MAZE_ITEM_GEM: color = SKYBLUE; break;
+        default: break;
+    }
+
+    return color;
+}
+
+// Upload maze cells dirty regions into maze textures, returns bytes uploaded
+// NOTE: Nothing is uploaded if no cells changed since last update, uploads limited per frame,
+// dirty regions cells atlas tiles and tilemap cells are updated at the same time, 3d mesh chunks
+// and minimap pixels marked for redraw
+int UpdateMazeTextureRegions(MazeOverview *overview, MazeDirtyRegions *dirty, MazeTiles *tiles, MazeGrid grid, MazeAtlas atlas, MazeTilemap *tilemap, MazeMesh *mesh, MazeMinimap *minimap)
+{
+    int bytes = 0;
+    MazeDirtyRect rect = { 0 };
+
+    // NOTE: Regions left after upload budget are uploaded on next frames
+    while ((bytes < MAZE_UPLOAD_FRAME_BYTES) && PopMazeDirtyRect(dirty, &rect))
+    {
+        UpdateMazeTiles(tiles, grid, atlas, rect.x, rect.y, rect.width, rect.height);
+        bytes += UpdateMazeTilemap(tilemap, *tiles, grid, rect.x, rect.y, rect.width, rect.height);
+        MarkMazeMeshDirty(mesh, rect.x, rect.y, rect.width, rect.height);
+        MarkMazeMinimapArea(minimap, rect.x, rect.y, rect.width, rect.height);
+
+        // Dirty rectangle cells packed from grid (2 bits per cell) into overview texture
+        bytes += UpdateMazeOverview(overview, grid, rect.x, rect.y, rect.width, rect.height);
+    }
+
+    return bytes;
+}
+
+// Set maze cells run edit value (cell and item type), keeping dirty regions and edited area in sync
+// NOTE: Used as undo/redo apply callback, data is a MazeEditContext. Path and flow field are
+// not updated per run, UpdateMazeEditArea() updates them once after undo/redo
+void ApplyMazeEdit(void *data, int x, int y, int length, int value)
+{
+    MazeEditContext *context = (MazeEditContext *)data;
+    int changed = 0;
+
+    for (int i = 0; i < length; i++)
     {
-        ImageDrawPixel(&im_maze, maze_points[i].x, maze_points[i].y, WHITE);
+        if (SetMazeEditValue(context->grid, context->items, x + i, y, value)) changed++;
     }
-    //---------------------------------------------------------------------------------
-
-    // STEP 3: Draw lines from every point in a random direction
-    //---------------------------------------------------------------------------------
-    // STEP 3.1: Define an array of 4 directions for convenience
-    Point directions[4] = {
-        { 1, 0 },   // East
-        { -1, 0 },  // West
-        { 0, 1 },   // South
-        { 0, -1 },  // North
+
+    if (changed == 0) return;
+
+    MarkMazeAreaDirty(context->dirty, x, y, length, 1);
+
+    // Edited area grown to include run
+    MazeDirtyRect *bounds = &context->bounds;
+
+    if ((bounds->width == 0) || (bounds->height == 0)) *bounds = (MazeDirtyRect){ x, y, length, 1 };
+    else
+    {
+        int min_x = (x < bounds->x)? x : bounds->x;
+        int min_y = (y < bounds->y)? y : bounds->y;
+        int max_x = ((x + length) > (bounds->x + bounds->width))? (x + length) : (bounds->x + bounds->width);
+        int max_y = ((y + 1) > (bounds->y + bounds->height))? (y + 1) : (bounds->y + bounds->height);
+
+        *bounds = (MazeDirtyRect){ min_x, min_y, max_x - min_x, max_y - min_y };
+    }
+}
+
+// Update path and flow field once for cells area applied by undo/redo
+void UpdateMazeEditArea(MazeEditContext *context)
+{
+    MazeDirtyRect bounds = context->bounds;
+
+    if ((bounds.width == 0) || (bounds.height == 0)) return;
+
+    UpdateMazePathArea(context->path, *context->grid, bounds.x, bounds.y, bounds.width, bounds.height);
+    UpdateMazeFlowArea(context->flow, *context->grid, bounds.x, bounds.y, bounds.width, bounds.height);
+
+    context->bounds = (MazeDirtyRect){ 0 };
+}
+
+// Commit edit batch cells (already painted): items, path and undo history updated, one dirty area
+// NOTE: Undo history records one edit per span, path and flow field updated once for batch
+// bounding rectangle (only if walkability changed), textures only upload batch bounding rectangle tiles
+void CommitMazeEditBatch(MazeEditContext *context, const MazeEditBatch *batch, MazeUndo *undo)
+{
+    MazeDirtyRect bounds = batch->bounds;
+
+    RecordMazeEditBatch(undo, context->items, batch);
+
+    if (HasMazeEditBatchWalls(batch))
+    {
+        UpdateMazePathArea(context->path, *context->grid, bounds.x, bounds.y, bounds.width, bounds.height);
+        UpdateMazeFlowArea(context->flow, *context->grid, bounds.x, bounds.y, bounds.width, bounds.height);
+    }
+
+    MarkMazeAreaDirty(context->dirty, bounds.x, bounds.y, bounds.width, bounds.height);
+}
+
+// Load seeds list from seeds file (maze_search tool output), NULL if not available or generated with other parameters
+// NOTE: First line is generation parameters header, file rejected if size, spacing or point chance differ from
+// params (seeds would generate other mazes), file algorithm returned. One seed per line (first value), lines
+// starting with '#' skipped
+int *LoadMazeSeeds(const char *fileName, MazePregenRequest params, int *algorithm, int *count)
+{
+    *count = 0;
+    *algorithm = -1;
+
+    if (!FileExists(fileName)) return NULL;
+
+    char *text = LoadFileText(fileName);
+    if (text == NULL) return NULL;
+
+    MazePregenRequest header = { 0 };
+    char name[32] = { 0 };
+    header.algorithm = -1;
+
+    if (sscanf(text, "# maze_search: width %i height %i spacing_rows %i spacing_cols %i point_chance %f algorithm %31s", &header.width, &header.height,
+        &header.spacing_rows, &header.spacing_cols, &header.point_chance, name) == 6)
+    {
+        for (int a = 0; a < MAZE_ALGORITHM_COUNT; a++) if (TextIsEqual(name, GetMazeGenerator(a)->name)) header.algorithm = a;
+    }
+
+    if ((header.algorithm < 0) || (header.width != params.width) || (header.height != params.height) || (header.spacing_rows != params.spacing_rows) ||
+        (header.spacing_cols != params.spacing_cols) || ((int)(header.point_chance*1000.0f + 0.5f) != (int)(params.point_chance*1000.0f + 0.5f)))
+    {
+        TraceLog(LOG_WARNING, "MAZE: [%s] Seeds file ignored, not generated with game maze parameters (%ix%i, spacing %ix%i, point chance %.3f)",
+            fileName, params.width, params.height, params.spacing_rows, params.spacing_cols, params.point_chance);
+        UnloadFileText(text);
+        return NULL;
+    }
+
+    int capacity = 0;
+    for (const char *c = text; *c != '\0'; c++) if (*c == '\n') capacity++;
+
+    int *seeds = (int *)malloc((capacity + 1)*sizeof(int));
+
+    for (char *line = text; (seeds != NULL) && (*line != '\0'); )
+    {
+        char *next = line;
+        while ((*next != '\0') && (*next != '\n')) next++;
+
+        if ((*line != '#') && (*line != '\n') && (*line != '\0')) seeds[(*count)++] = atoi(line);
+
+        line = (*next == '\n')? next + 1 : next;
+    }
+
+    UnloadFileText(text);
+
+    if ((seeds != NULL) && (*count == 0))
+    {
+        free(seeds);
+        seeds = NULL;
+    }
+    else
+    {
+        *algorithm = header.algorithm;
+        TraceLog(LOG_INFO, "MAZE: [%s] Loaded %i seeds (%s algorithm)", fileName, *count, GetMazeGenerator(header.algorithm)->name);
+    }
+
+    return seeds;
+}
+
+// Draw maze path cells inside view range, over maze
+// NOTE: Path cells drawn as small squares centered in cells, so maze tiles remain visible
+void DrawMazePath(MazePath path, MazeViewRange view, Vector2 position, float scale, Color color)
+{
+    for (int i = 0; i < path.length; i++)
+    {
+        int x = path.cells[i]%path.width;
+        int y = path.cells[i]/path.width;
+
+        if ((x < view.min_x) || (x > view.max_x) || (y < view.min_y) || (y > view.max_y)) continue;
+
+        DrawRectangleV((Vector2){ position.x + x*scale + scale/4, position.y + y*scale + scale/4 }, (Vector2){ scale/2, scale/2 }, color);
+    }
+}
+
+// Draw maze agents inside view range, over maze
+// NOTE: Agents drawn as small squares (chasers: red, wanderers: sky blue), all batched together
+void DrawMazeAgents(MazeAgents agents, MazeViewRange view, Vector2 position, float scale)
+{
+    for (int i = 0; i < agents.count; i++)
+    {
+        float x = agents.x[i];
+        float y = agents.y[i];
+
+        if ((x < (view.min_x - 1)) || (x > view.max_x) || (y < (view.min_y - 1)) || (y > view.max_y)) continue;
+
+        Color color = (agents.type[i] == MAZE_AGENT_CHASER)? RED : SKYBLUE;
+        DrawRectangleV((Vector2){ position.x + x*scale + scale/4, position.y + y*scale + scale/4 }, (Vector2){ scale/2, scale/2 }, color);
+    }
+}
+
+// Draw frame profiler overlay: phases time graph for last frames, phases and counters average
+// NOTE: Graph shows one stacked bar per frame (newest on the right), frame budget (60 fps) as a line
+void DrawMazeProfiler(const MazeProfiler *profiler, int x, int y)
+{
+    static const Color phase_colors[MAZE_PROFILE_MAX_PHASES] = {
+        LIGHTGRAY, GREEN, LIME, ORANGE, RED, SKYBLUE, GOLD, VIOLET, DARKBLUE, PINK, BEIGE, MAROON, PURPLE, BROWN, DARKGREEN, MAGENTA
     };
+    const int width = 320;
+    const int graph_height = 100;
+    const float graph_scale = graph_height/33.3f;   // Pixels per millisecond, graph shows up to 2 frames budget
+    const int height = graph_height + 30 + (profiler->phase_count + 3)*12;
+
+    DrawRectangle(x - 5, y - 5, width + 10, height + 10, Fade(BLACK, 0.75f));
 
-    // STEP 3.2: Load a random sequence of points, to be used as indices, so,
-    // we can access maze-points randomly indexed, instead of following the order we stored them
-    int* point_order = LoadRandomSequence(maze_point_counter, 0, maze_point_counter - 1);
+    // Phases time graph, frames stacked bars
+    int bar_width = width/((profiler->capacity > 0)? profiler->capacity : 1);
+    if (bar_width < 1) bar_width = 1;
 
-    // STEP 3.3: Process every random maze point, drawing pixels in one random direction,
-    // until we collision with another wall (WHITE pixel)
-    for (int i = 0; i < maze_point_counter; i++)
+    for (int age = 0; age < profiler->count; age++)
     {
-        Point current_point = maze_points[point_order[i]];
-        Point current_dir = directions[GetRandomValue(0, 3)];
-        Point next_point = { current_point.x + current_dir.x, current_point.y + current_dir.y };
+        const MazeProfileFrame *frame = GetMazeProfileFrame(profiler, age);
+        int bar_x = x + width - (age + 1)*bar_width;
+        float bar_y = (float)(y + graph_height);
+
+        if (bar_x < x) break;
 
-        while (ColorIsEqual(GetImageColor(im_maze, next_point.x, next_point.y), BLACK))
+        for (int p = 0; p < profiler->phase_count; p++)
         {
-            ImageDrawPixel(&im_maze, next_point.x, next_point.y, WHITE);
+            float bar_height = frame->phase_time[p]*graph_scale;
+            if ((bar_y - bar_height) < y) bar_height = bar_y - y;
 
-            next_point.x += current_dir.x;
-            next_point.y += current_dir.y;
+            DrawRectangleRec((Rectangle){ (float)bar_x, bar_y - bar_height, (float)bar_width, bar_height }, phase_colors[p]);
+            bar_y -= bar_height;
         }
     }
 
-    // If using dynamic memory allocation for maze_points,
-    // they allocated memory must be manually freed 
-    free(maze_points);
+    DrawLine(x, y + graph_height - (int)(16.6f*graph_scale), x + width, y + graph_height - (int)(16.6f*graph_scale), YELLOW);
+    DrawRectangleLines(x, y, width, graph_height, GRAY);
 
-    // Free point_order array, allocated internally by LoadRandomSequence()
-    UnloadRandomSequence(point_order);
-    //-----------------------------------------------------------------------------------
+    // Phases and counters average, last frame
+    MazeProfileFrame average = GetMazeProfileAverage(profiler);
+    const MazeProfileFrame *last = GetMazeProfileFrame(profiler, 0);
+    int text_y = y + graph_height + 8;
 
-    return im_maze;
-}
\ No newline at end of file
+    DrawText(TextFormat("FRAME: %.2f ms AVG (%i FRAMES)", average.time, profiler->count), x, text_y, 10, WHITE);
+    text_y += 16;
+
+    for (int p = 0; p < profiler->phase_count; p++)
+    {
+        DrawRectangle(x, text_y + 1, 8, 8, phase_colors[p]);
+        DrawText(TextFormat("%-14s %6.3f ms AVG  %6.3f ms LAST", profiler->phase_names[p], average.phase_time[p],
+            (last != NULL)? last->phase_time[p] : 0.0f), x + 14, text_y, 10, WHITE);
+        text_y += 12;
+    }
+
+    DrawText(TextFormat("DRAW CALLS (EST): %i - UPLOAD: %i B - ALLOCS: %i (AVG)", average.counters[MAZE_PROFILE_DRAW_CALLS_EST],
+        average.counters[MAZE_PROFILE_UPLOAD_BYTES], average.counters[MAZE_PROFILE_ALLOCATIONS]), x, text_y + 4, 10, YELLOW);
+    DrawText("ALLOCS: MAZE MODULES ONLY, RAYLIB NOT COUNTED", x, text_y + 18, 10, GRAY);
+}
@@ -0,0 +1,544 @@
+/*******************************************************************************************
+*
+*   maze_gen - Procedural maze generation using Maze Grid Algorithm
+*
+*   Window-free maze generation library, every generation call uses an explicit random
+*   generator state, so mazes can be generated offline and from multiple threads at once.
+*   Random generator is the same used by raylib (xoshiro128** seeded with splitmix64),
+*   generated mazes are the same than the ones generated in game for the same seed
+*
+*   CONFIGURATION:
+*       #define MAZE_GEN_IMPLEMENTATION
+*           Generates the implementation of the module in the including file,
+*           only one translation unit should define it
+*
+*   DEPENDENCIES:
+*       maze_grid       - Maze cells data, generation output
+*       maze_system     - Timing (GetMazeTime()) and jobs pool, for chunked generation
+*
+*   NOTE: Module is window-free and does not depend on raylib
+*
+*   Copyright (c) 2024-2025 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#ifndef MAZE_GEN_H
+#define MAZE_GEN_H
+
+#include "maze_grid.h"
+#include "maze_system.h"
+
+#include <stddef.h>     // Required for: size_t
+
+// Random values generator state
+// NOTE: Same algorithm used by raylib GetRandomValue() and LoadRandomSequence()
+typedef struct MazeRandom {
+    unsigned long long seed;    // Splitmix64 state, used for seeding
+    unsigned int state[4];      // Xoshiro128** state
+} MazeRandom;
+
+// Maze generation statistics
+typedef struct MazeGenStats {
+    int points;             // Number of maze points generated
+    double time;            // Generation time in seconds
+    size_t peak_memory;     // Peak memory allocated by generator, in bytes
+} MazeGenStats;
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+void SetMazeRandomSeed(MazeRandom *rng, unsigned int seed);        // Set random generator seed, same seed gives same values sequence
+int GetMazeRandomValue(MazeRandom *rng, int min, int max);         // Get random value between min and max (both included)
+unsigned int GetMazeChunkSeed(unsigned int seed, int chunk_x, int chunk_y); // Get chunk seed, derived from maze seed and chunk position
+
+// Generate procedural maze cells grid, using grid-based algorithm
+MazeGrid GenMazeGrid(int width, int height, int spacing_rows, int spacing_cols, float point_chance, MazeRandom *rng, MazeGenStats *stats);
+
+// Generate procedural maze cells grid split in chunks, every chunk generated in parallel using pool (NULL = caller thread)
+// NOTE: Output depends only on parameters and seed (not on the number of threads), but it is not
+// the same maze GenMazeGrid() generates for the same seed
+MazeGrid GenMazeGridChunked(int width, int height, int spacing_rows, int spacing_cols, float point_chance, unsigned int seed, int chunk_size, MazeJobPool *pool, MazeGenStats *stats);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif // MAZE_GEN_H
+
+/***********************************************************************************
+*
+*   MAZE_GEN IMPLEMENTATION
+*
+************************************************************************************/
+
+#if defined(MAZE_GEN_IMPLEMENTATION) && !defined(MAZE_GEN_IMPLEMENTATION_DONE)
+#define MAZE_GEN_IMPLEMENTATION_DONE
+
+#include <stdlib.h>     // Required for: malloc(), calloc(), realloc(), free(), abs()
+
+// Maze generator working grid bits access (1 bit per cell)
+#define MAZE_BIT_GET(bits, i)   (((bits)[(i) >> 6] >> ((i) & 63)) & 1ULL)
+#define MAZE_BIT_SET(bits, i)   ((bits)[(i) >> 6] |= (1ULL << ((i) & 63)))
+
+#define MAZE_CHUNK_DEFAULT_SIZE     512     // Chunk size used by chunked generation when not provided
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+
+// Line cut by a chunk limit, continued when stitching chunks seams
+typedef struct MazeChunkCut {
+    int x;                  // First cell out of the chunk
+    int y;
+    int dir;                // Line direction index
+} MazeChunkCut;
+
+// Chunked generation shared data, every chunk job writes only its own cells and cuts
+typedef struct MazeChunkJobData {
+    MazeGrid *grid;
+    int spacing_rows;
+    int spacing_cols;
+    float point_chance;
+    unsigned int seed;
+    int chunk_size;
+    int chunks_x;
+
+    MazeChunkCut **cuts;    // Lines cut by chunk limits, per chunk
+    int *cut_counts;        // Number of lines cut, per chunk
+    int *point_counts;      // Number of points generated, per chunk
+    size_t *peak_memory;    // Peak memory allocated by job, per chunk
+} MazeChunkJobData;
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Declaration
+//----------------------------------------------------------------------------------
+static unsigned long long MazeRandomSplitmix64(MazeRandom *rng);    // Splitmix64 generator, used for seeding
+static unsigned int MazeRandomXoshiro(MazeRandom *rng);             // Xoshiro128** generator
+static void GenMazeChunkJob(void *data, int index);                 // Generate one maze chunk, jobs pool function
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+
+// Set random generator seed, same seed gives same values sequence
+void SetMazeRandomSeed(MazeRandom *rng, unsigned int seed)
+{
+    rng->seed = (unsigned long long)seed;
+
+    // NOTE: State initialized same way than raylib SetRandomSeed()
+    rng->state[0] = (unsigned int)(MazeRandomSplitmix64(rng) & 0xffffffff);
+    rng->state[1] = (unsigned int)((MazeRandomSplitmix64(rng) & 0xffffffff00000000) >> 32);
+    rng->state[2] = (unsigned int)(MazeRandomSplitmix64(rng) & 0xffffffff);
+    rng->state[3] = (unsigned int)((MazeRandomSplitmix64(rng) & 0xffffffff00000000) >> 32);
+}
+
+// Get random value between min and max (both included)
+int GetMazeRandomValue(MazeRandom *rng, int min, int max)
+{
+    if (min > max)
+    {
+        int tmp = max;
+        max = min;
+        min = tmp;
+    }
+
+    return (int)(MazeRandomXoshiro(rng)%(unsigned int)(abs(max - min) + 1)) + min;
+}
+
+// Get chunk seed, derived from maze seed and chunk position
+// NOTE: Chunk coordinates can be negative, every chunk position gets a different seed
+unsigned int GetMazeChunkSeed(unsigned int seed, int chunk_x, int chunk_y)
+{
+    MazeRandom rng = { 0 };
+    rng.seed = ((unsigned long long)(unsigned int)chunk_y << 32) | (unsigned long long)(unsigned int)chunk_x;
+    rng.seed ^= (unsigned long long)seed*0x9e3779b97f4a7c15ULL;
+
+    return (unsigned int)(MazeRandomSplitmix64(&rng) >> 32);
+}
+
+// Generate procedural maze cells grid, using grid-based algorithm
+// NOTE: Working grid is bit-packed (1 bit per cell, set = wall) and memory used for points
+// is proportional to the number of points, supporting mazes up to 32768x32768 cells.
+// Random values are requested in the same order than the original image-based algorithm
+// using raylib random generator, so generated maze is the same for the same seed
+MazeGrid GenMazeGrid(int width, int height, int spacing_rows, int spacing_cols, float point_chance, MazeRandom *rng, MazeGenStats *stats)
+{
+    MazeGrid grid = { 0 };
+
+    if ((width <= 0) || (height <= 0) || (spacing_rows <= 0) || (spacing_cols <= 0) || (rng == NULL)) return grid;
+
+    double start_time = GetMazeTime();
+    size_t memory = 0;
+    size_t peak_memory = 0;
+
+    // STEP 1: Generate empty bit-packed grid with borders
+    //---------------------------------------------------------------------------------
+    // STEP 1.1: Allocate grid of plain floor cells
+    size_t cell_count = (size_t)width*height;
+    size_t word_count = (cell_count + 63)/64;
+    unsigned long long *walls = (unsigned long long *)calloc(word_count, sizeof(unsigned long long));
+    memory += word_count*sizeof(unsigned long long);
+
+    if (walls == NULL) return grid;
+
+    // STEP 1.2: Draw grid border
+    for (int x = 0; x < width; x++)
+    {
+        MAZE_BIT_SET(walls, x);
+        MAZE_BIT_SET(walls, (size_t)(height - 1)*width + x);
+    }
+
+    for (int y = 0; y < height; y++)
+    {
+        MAZE_BIT_SET(walls, (size_t)y*width);
+        MAZE_BIT_SET(walls, (size_t)y*width + width - 1);
+    }
+    //---------------------------------------------------------------------------------
+
+    // STEP 2: Set some random point in grid at specific row-column distances
+    //---------------------------------------------------------------------------------
+    // STEP 2.1: Define an array of points used for maze generation, points stored as cell index
+    // NOTE: Array sized for all candidate points, no fixed limit on number of points
+    size_t max_points = (size_t)((width > 2)? (width - 2)/spacing_cols : 0)*((height > 2)? (height - 2)/spacing_rows : 0);
+    unsigned int *maze_points = (unsigned int *)malloc((max_points + 1)*sizeof(unsigned int));
+    int maze_point_counter = 0;
+    memory += (max_points + 1)*sizeof(unsigned int);
+
+    // STEP 2.2: Store specific points, at specific row-column distances
+    // NOTE: Border cells are never candidate points
+    for (int y = spacing_rows; y < (height - 1); y += spacing_rows)
+    {
+        for (int x = spacing_cols; x < (width - 1); x += spacing_cols)
+        {
+            if (GetMazeRandomValue(rng, 0, 100) <= (int)(point_chance*100))
+            {
+                maze_points[maze_point_counter] = (unsigned int)((size_t)y*width + x);
+                maze_point_counter++;
+            }
+        }
+    }
+
+    // STEP 2.3: Draw our points in grid
+    for (int i = 0; i < maze_point_counter; i++) MAZE_BIT_SET(walls, maze_points[i]);
+    //---------------------------------------------------------------------------------
+
+    // STEP 3: Draw lines from every point in a random direction
+    //---------------------------------------------------------------------------------
+    // STEP 3.1: Define an array of 4 directions for convenience, as cell index offsets
+    long long directions[4] = {
+        1,          // East
+        -1,         // West
+        width,      // South
+        -width,     // North
+    };
+
+    // STEP 3.2: Get a random sequence of points indices, to access maze-points randomly indexed
+    // NOTE: Same sequence LoadRandomSequence() would generate (rejecting repeated values) but
+    // repeated values are checked with a bit-array instead of scanning the whole sequence
+    int *point_order = (int *)malloc((maze_point_counter + 1)*sizeof(int));
+    unsigned long long *point_used = (unsigned long long *)calloc((maze_point_counter + 63)/64 + 1, sizeof(unsigned long long));
+    memory += (maze_point_counter + 1)*sizeof(int) + ((maze_point_counter + 63)/64 + 1)*sizeof(unsigned long long);
+    if (memory > peak_memory) peak_memory = memory;
+
+    for (int i = 0; i < maze_point_counter; )
+    {
+        int value = GetMazeRandomValue(rng, 0, maze_point_counter - 1);
+
+        if (!MAZE_BIT_GET(point_used, value))
+        {
+            MAZE_BIT_SET(point_used, value);
+            point_order[i] = value;
+            i++;
+        }
+    }
+
+    free(point_used);
+    memory -= ((maze_point_counter + 63)/64 + 1)*sizeof(unsigned long long);
+
+    // STEP 3.3: Process every random maze point, drawing cells in one random direction,
+    // until we collision with another wall
+    for (int i = 0; i < maze_point_counter; i++)
+    {
+        long long current_dir = directions[GetMazeRandomValue(rng, 0, 3)];
+        size_t next_point = (size_t)((long long)maze_points[point_order[i]] + current_dir);
+
+        while (!MAZE_BIT_GET(walls, next_point))
+        {
+            MAZE_BIT_SET(walls, next_point);
+            next_point = (size_t)((long long)next_point + current_dir);
+        }
+    }
+
+    free(maze_points);
+    free(point_order);
+    memory -= (max_points + 1)*sizeof(unsigned int) + (maze_point_counter + 1)*sizeof(int);
+    //-----------------------------------------------------------------------------------
+
+    // STEP 4: Convert bit-packed grid into maze cells grid
+    //-----------------------------------------------------------------------------------
+    grid = LoadMazeGrid(width, height);
+    memory += cell_count;
+    if (memory > peak_memory) peak_memory = memory;
+
+    if (grid.cells != NULL)
+    {
+        for (size_t i = 0; i < cell_count; i++) grid.cells[i] = MAZE_BIT_GET(walls, i)? MAZE_CELL_WALL : MAZE_CELL_FLOOR;
+    }
+
+    free(walls);
+    //-----------------------------------------------------------------------------------
+
+    if (stats != NULL)
+    {
+        stats->points = maze_point_counter;
+        stats->time = GetMazeTime() - start_time;
+        stats->peak_memory = peak_memory;
+    }
+
+    return grid;
+}
+
+// Generate procedural maze cells grid split in chunks, every chunk generated in parallel using pool
+// NOTE: Every chunk runs the grid-based algorithm with its own random generator, seeded from maze seed
+// and chunk position, drawing lines only inside the chunk. Lines reaching chunk limits are recorded
+// and, once all chunks are done, continued into neighbour chunks until they collision with a wall,
+// in a fixed order; chunks do not add any wall on their limits, so seams never split the maze
+MazeGrid GenMazeGridChunked(int width, int height, int spacing_rows, int spacing_cols, float point_chance, unsigned int seed, int chunk_size, MazeJobPool *pool, MazeGenStats *stats)
+{
+    MazeGrid grid = { 0 };
+
+    if ((width <= 0) || (height <= 0) || (spacing_rows <= 0) || (spacing_cols <= 0)) return grid;
+    if (chunk_size <= 0) chunk_size = MAZE_CHUNK_DEFAULT_SIZE;
+
+    double start_time = GetMazeTime();
+
+    // STEP 1: Generate every chunk in parallel, into final grid
+    //---------------------------------------------------------------------------------
+    grid = LoadMazeGrid(width, height);
+
+    if (grid.cells == NULL) return grid;
+
+    MazeChunkJobData job = { 0 };
+    job.grid = &grid;
+    job.spacing_rows = spacing_rows;
+    job.spacing_cols = spacing_cols;
+    job.point_chance = point_chance;
+    job.seed = seed;
+    job.chunk_size = chunk_size;
+    job.chunks_x = (width + chunk_size - 1)/chunk_size;
+
+    int chunk_count = job.chunks_x*((height + chunk_size - 1)/chunk_size);
+    job.cuts = (MazeChunkCut **)calloc(chunk_count, sizeof(MazeChunkCut *));
+    job.cut_counts = (int *)calloc(chunk_count, sizeof(int));
+    job.point_counts = (int *)calloc(chunk_count, sizeof(int));
+    job.peak_memory = (size_t *)calloc(chunk_count, sizeof(size_t));
+
+    if ((job.cuts == NULL) || (job.cut_counts == NULL) || (job.point_counts == NULL) || (job.peak_memory == NULL))
+    {
+        free(job.cuts);
+        free(job.cut_counts);
+        free(job.point_counts);
+        free(job.peak_memory);
+        UnloadMazeGrid(grid);
+
+        return (MazeGrid){ 0 };
+    }
+
+    RunMazeJobs(pool, GenMazeChunkJob, &job, chunk_count);
+    //---------------------------------------------------------------------------------
+
+    // STEP 2: Stitch chunks seams, continuing cut lines until they collision with a wall
+    // NOTE: Cut lines are processed in chunks order, so result does not depend on jobs order.
+    // Grid border is always a wall, so lines can never leave the grid
+    //---------------------------------------------------------------------------------
+    const int dirs_x[4] = { 1, -1, 0, 0 };
+    const int dirs_y[4] = { 0, 0, 1, -1 };
+    int point_count = 0;
+    size_t jobs_memory = 0;
+
+    for (int i = 0; i < chunk_count; i++)
+    {
+        for (int k = 0; k < job.cut_counts[i]; k++)
+        {
+            MazeChunkCut cut = job.cuts[i][k];
+            unsigned char *cell = &grid.cells[(size_t)cut.y*width + cut.x];
+            long long step = (long long)dirs_y[cut.dir]*width + dirs_x[cut.dir];
+
+            while (*cell != MAZE_CELL_WALL)
+            {
+                *cell = MAZE_CELL_WALL;
+                cell += step;
+            }
+        }
+
+        point_count += job.point_counts[i];
+        jobs_memory += job.peak_memory[i] + job.cut_counts[i]*sizeof(MazeChunkCut);
+        free(job.cuts[i]);
+    }
+    //---------------------------------------------------------------------------------
+
+    if (stats != NULL)
+    {
+        // NOTE: Peak memory considers all chunks jobs memory as if allocated at once (upper bound)
+        stats->points = point_count;
+        stats->time = GetMazeTime() - start_time;
+        stats->peak_memory = (size_t)width*height + (size_t)chunk_count*(sizeof(MazeChunkCut *) + 2*sizeof(int) + sizeof(size_t)) + jobs_memory;
+    }
+
+    free(job.cuts);
+    free(job.cut_counts);
+    free(job.point_counts);
+    free(job.peak_memory);
+
+    return grid;
+}
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Definition
+//----------------------------------------------------------------------------------
+
+// Splitmix64 generator, used for seeding
+static unsigned long long MazeRandomSplitmix64(MazeRandom *rng)
+{
+    unsigned long long z = (rng->seed += 0x9e3779b97f4a7c15ULL);
+    z = (z ^ (z >> 30))*0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27))*0x94d049bb133111ebULL;
+
+    return z ^ (z >> 31);
+}
+
+// Xoshiro128** generator
+static unsigned int MazeRandomXoshiro(MazeRandom *rng)
+{
+    const unsigned int result = ((rng->state[1]*5) << 7 | (rng->state[1]*5) >> 25)*9;
+    const unsigned int t = rng->state[1] << 9;
+
+    rng->state[2] ^= rng->state[0];
+    rng->state[3] ^= rng->state[1];
+    rng->state[1] ^= rng->state[2];
+    rng->state[0] ^= rng->state[3];
+
+    rng->state[2] ^= t;
+
+    rng->state[3] = (rng->state[3] << 11) | (rng->state[3] >> 21);
+
+    return result;
+}
+
+// Generate one maze chunk, jobs pool function
+// NOTE: Job only writes cells inside its chunk, lines reaching chunk limits are recorded as cuts
+static void GenMazeChunkJob(void *data, int index)
+{
+    MazeChunkJobData *job = (MazeChunkJobData *)data;
+    MazeGrid *grid = job->grid;
+
+    int chunk_x = index%job->chunks_x;
+    int chunk_y = index/job->chunks_x;
+    int min_x = chunk_x*job->chunk_size;
+    int min_y = chunk_y*job->chunk_size;
+    int max_x = (min_x + job->chunk_size < grid->width)? min_x + job->chunk_size : grid->width;     // Exclusive
+    int max_y = (min_y + job->chunk_size < grid->height)? min_y + job->chunk_size : grid->height;   // Exclusive
+
+    MazeRandom rng = { 0 };
+    SetMazeRandomSeed(&rng, GetMazeChunkSeed(job->seed, chunk_x, chunk_y));
+
+    // STEP 1: Draw grid border cells inside chunk
+    for (int y = min_y; y < max_y; y++)
+    {
+        for (int x = min_x; x < max_x; x++)
+        {
+            if ((x == 0) || (x == (grid->width - 1)) || (y == 0) || (y == (grid->height - 1))) grid->cells[(size_t)y*grid->width + x] = MAZE_CELL_WALL;
+        }
+    }
+
+    // STEP 2: Set some random points inside chunk, at global row-column distances
+    // NOTE: Candidate points are the same than GenMazeGrid(), so chunks density matches single maze density
+    int first_x = ((min_x + job->spacing_cols - 1)/job->spacing_cols)*job->spacing_cols;
+    int first_y = ((min_y + job->spacing_rows - 1)/job->spacing_rows)*job->spacing_rows;
+    if (first_x == 0) first_x = job->spacing_cols;
+    if (first_y == 0) first_y = job->spacing_rows;
+    int last_x = (max_x < (grid->width - 1))? max_x : grid->width - 1;      // Exclusive
+    int last_y = (max_y < (grid->height - 1))? max_y : grid->height - 1;    // Exclusive
+
+    int max_points = ((last_x > first_x)? (last_x - first_x + job->spacing_cols - 1)/job->spacing_cols : 0)*
+                     ((last_y > first_y)? (last_y - first_y + job->spacing_rows - 1)/job->spacing_rows : 0);
+    int *points = (int *)malloc((max_points + 1)*2*sizeof(int));
+    int point_count = 0;
+
+    if (points == NULL) return;
+
+    for (int y = first_y; y < last_y; y += job->spacing_rows)
+    {
+        for (int x = first_x; x < last_x; x += job->spacing_cols)
+        {
+            if (GetMazeRandomValue(&rng, 0, 100) <= (int)(job->point_chance*100))
+            {
+                points[point_count*2] = x;
+                points[point_count*2 + 1] = y;
+                grid->cells[(size_t)y*grid->width + x] = MAZE_CELL_WALL;
+                point_count++;
+            }
+        }
+    }
+
+    // STEP 3: Draw lines from every point in a random direction, in random points order,
+    // until we collision with another wall or leave the chunk
+    // NOTE: Points order shuffled in-place (Fisher-Yates), no need to match LoadRandomSequence()
+    for (int i = point_count - 1; i > 0; i--)
+    {
+        int k = GetMazeRandomValue(&rng, 0, i);
+        int tmp_x = points[i*2], tmp_y = points[i*2 + 1];
+        points[i*2] = points[k*2];
+        points[i*2 + 1] = points[k*2 + 1];
+        points[k*2] = tmp_x;
+        points[k*2 + 1] = tmp_y;
+    }
+
+    const int dirs_x[4] = { 1, -1, 0, 0 };
+    const int dirs_y[4] = { 0, 0, 1, -1 };
+    MazeChunkCut *cuts = NULL;
+    int cut_count = 0;
+    int cut_capacity = 0;
+
+    for (int i = 0; i < point_count; i++)
+    {
+        int dir = GetMazeRandomValue(&rng, 0, 3);
+        int x = points[i*2] + dirs_x[dir];
+        int y = points[i*2 + 1] + dirs_y[dir];
+
+        while ((x >= min_x) && (x < max_x) && (y >= min_y) && (y < max_y))
+        {
+            unsigned char *cell = &grid->cells[(size_t)y*grid->width + x];
+
+            if (*cell == MAZE_CELL_WALL) break;
+
+            *cell = MAZE_CELL_WALL;
+            x += dirs_x[dir];
+            y += dirs_y[dir];
+        }
+
+        // Line left the chunk, record it to be continued when stitching seams
+        if ((x < min_x) || (x >= max_x) || (y < min_y) || (y >= max_y))
+        {
+            if (cut_count >= cut_capacity)
+            {
+                cut_capacity = (cut_capacity > 0)? cut_capacity*2 : 64;
+                MazeChunkCut *resized = (MazeChunkCut *)realloc(cuts, cut_capacity*sizeof(MazeChunkCut));
+                if (resized == NULL) break;
+                cuts = resized;
+            }
+
+            cuts[cut_count++] = (MazeChunkCut){ x, y, dir };
+        }
+    }
+
+    free(points);
+
+    job->cuts[index] = cuts;
+    job->cut_counts[index] = cut_count;
+    job->point_counts[index] = point_count;
+    job->peak_memory[index] = (max_points + 1)*2*sizeof(int) + cut_capacity*sizeof(MazeChunkCut);
+}
+
+#endif // MAZE_GEN_IMPLEMENTATION
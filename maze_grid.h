@@ -0,0 +1,137 @@
+/*******************************************************************************************
+*
+*   maze_grid - Packed maze cells grid, one byte per cell
+*
+*   Persistent cells storage for the maze, built once from generated maze data and kept
+*   in sync by editor and game logic, so collisions, items pickup and win detection
+*   can be checked without decoding maze image pixels every frame
+*
+*   CONFIGURATION:
+*       #define MAZE_GRID_IMPLEMENTATION
+*           Generates the implementation of the module in the including file,
+*           only one translation unit should define it
+*
+*   NOTE: Module is window-free and does not depend on raylib
+*
+*   Copyright (c) 2024-2025 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#ifndef MAZE_GRID_H
+#define MAZE_GRID_H
+
+#include <stdbool.h>    // Required for: bool
+#include <stddef.h>     // Required for: size_t
+
+// Maze cell types
+// NOTE: Values match the color scheme used by maze image:
+// BLACK = Floor, WHITE = Wall, RED = Item, GREEN = Goal
+typedef enum {
+    MAZE_CELL_FLOOR = 0,    // Walkable cell
+    MAZE_CELL_WALL,         // Not walkable cell
+    MAZE_CELL_ITEM,         // Walkable cell containing an item to pickup
+    MAZE_CELL_GOAL,         // Walkable cell, maze end point
+} MazeCellType;
+
+// Maze grid, cells stored row by row
+typedef struct MazeGrid {
+    int width;              // Grid width in cells
+    int height;             // Grid height in cells
+    unsigned char *cells;   // Cells type data (MazeCellType), width*height bytes
+} MazeGrid;
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+MazeGrid LoadMazeGrid(int width, int height);                       // Load maze grid, all cells initialized as floor
+void UnloadMazeGrid(MazeGrid grid);                                 // Unload maze grid data
+bool SetMazeCell(MazeGrid *grid, int x, int y, int type);           // Set cell type, returns true if cell changed
+unsigned int ComputeMazeGridHash(MazeGrid grid);                    // Compute grid cells hash (FNV-1a), including grid size
+
+#if defined(__cplusplus)
+}
+#endif
+
+// Get cell type, cells out of grid bounds are considered walls
+static inline int GetMazeCell(MazeGrid grid, int x, int y)
+{
+    if ((x < 0) || (x >= grid.width) || (y < 0) || (y >= grid.height)) return MAZE_CELL_WALL;
+
+    return grid.cells[(size_t)y*grid.width + x];
+}
+
+// Check if cell can be walked by player
+static inline bool IsMazeCellWalkable(MazeGrid grid, int x, int y)
+{
+    return (GetMazeCell(grid, x, y) != MAZE_CELL_WALL);
+}
+
+#endif // MAZE_GRID_H
+
+/***********************************************************************************
+*
+*   MAZE_GRID IMPLEMENTATION
+*
+************************************************************************************/
+
+#if defined(MAZE_GRID_IMPLEMENTATION) && !defined(MAZE_GRID_IMPLEMENTATION_DONE)
+#define MAZE_GRID_IMPLEMENTATION_DONE
+
+#include <stdlib.h>     // Required for: calloc(), free()
+
+// Load maze grid, all cells initialized as floor
+MazeGrid LoadMazeGrid(int width, int height)
+{
+    MazeGrid grid = { 0 };
+
+    if ((width <= 0) || (height <= 0)) return grid;
+
+    grid.cells = (unsigned char *)calloc((size_t)width*height, sizeof(unsigned char));
+
+    if (grid.cells != NULL)
+    {
+        grid.width = width;
+        grid.height = height;
+    }
+
+    return grid;
+}
+
+// Unload maze grid data
+void UnloadMazeGrid(MazeGrid grid)
+{
+    free(grid.cells);
+}
+
+// Set cell type, returns true if cell changed
+bool SetMazeCell(MazeGrid *grid, int x, int y, int type)
+{
+    if ((x < 0) || (x >= grid->width) || (y < 0) || (y >= grid->height)) return false;
+
+    unsigned char *cell = &grid->cells[(size_t)y*grid->width + x];
+    if (*cell == (unsigned char)type) return false;
+
+    *cell = (unsigned char)type;
+
+    return true;
+}
+
+// Compute grid cells hash (FNV-1a), including grid size
+// NOTE: Used to check data recorded for a maze (i.e. replays) is used with the same maze
+unsigned int ComputeMazeGridHash(MazeGrid grid)
+{
+    unsigned int hash = 2166136261u;
+
+    hash = (hash ^ (unsigned int)grid.width)*16777619u;
+    hash = (hash ^ (unsigned int)grid.height)*16777619u;
+
+    if (grid.cells != NULL)
+    {
+        for (size_t i = 0; i < (size_t)grid.width*grid.height; i++) hash = (hash ^ grid.cells[i])*16777619u;
+    }
+
+    return hash;
+}
+
+#endif // MAZE_GRID_IMPLEMENTATION
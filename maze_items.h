@@ -0,0 +1,408 @@
+/*******************************************************************************************
+*
+*   maze_items - Maze items storage, using generational handles
+*
+*   Items data is stored as structure-of-arrays, slots are reused through a free list
+*   and referenced with generational handles, so stale handles are detected once an
+*   item has been removed. A cell-to-item hash table provides O(1) lookup by cell,
+*   memory required is proportional to the number of items, not the maze size
+*
+*   CONFIGURATION:
+*       #define MAZE_ITEMS_IMPLEMENTATION
+*           Generates the implementation of the module in the including file,
+*           only one translation unit should define it
+*
+*   DEPENDENCIES:
+*       maze_grid       - Maze cells data, items cells are marked as MAZE_CELL_ITEM
+*
+*   NOTE: Module is window-free and does not depend on raylib
+*
+*   Copyright (c) 2024-2025 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#ifndef MAZE_ITEMS_H
+#define MAZE_ITEMS_H
+
+#include "maze_grid.h"
+
+// Maze item types
+typedef enum {
+    MAZE_ITEM_COIN = 0,     // Common item, low score
+    MAZE_ITEM_GEM,          // Rare item, high score
+    MAZE_ITEM_TYPE_COUNT
+} MazeItemType;
+
+// Maze item state
+typedef enum {
+    MAZE_ITEM_STATE_FREE = 0,   // Slot not used, available for new items
+    MAZE_ITEM_STATE_ACTIVE,     // Item placed in maze, can be picked
+} MazeItemState;
+
+// Maze item handle
+// NOTE: Handle becomes invalid when item is removed, even if its slot gets reused
+typedef struct MazeItemHandle {
+    unsigned int index;         // Item slot index
+    unsigned int generation;    // Item slot generation, 0 is never a valid generation
+} MazeItemHandle;
+
+// Maze items storage (structure-of-arrays)
+typedef struct MazeItems {
+    int width;                  // Maze width in cells, used to compute cell index
+    int count;                  // Number of active items
+    int capacity;               // Number of item slots allocated
+
+    int *cell;                  // Item cell index (y*width + x)
+    unsigned char *type;        // Item type (MazeItemType)
+    unsigned char *state;       // Item state (MazeItemState)
+    unsigned int *generation;   // Item slot generation
+
+    int *free_slots;            // Free slots stack
+    int free_count;             // Free slots available in stack
+    int used_slots;             // Slots used at least once
+
+    int *lookup;                // Cell-to-item hash table (open addressing), stores item slot or -1
+    int lookup_capacity;        // Hash table capacity, always power of two
+} MazeItems;
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+MazeItems LoadMazeItems(int width, int capacity);                               // Load items storage for a maze width, capacity grows as required
+void UnloadMazeItems(MazeItems *items);                                         // Unload items storage
+void ClearMazeItems(MazeItems *items);                                          // Remove all items, invalidating all handles
+int AddMazeItemsFromGrid(MazeItems *items, MazeGrid grid, int type);            // Add items for all grid cells marked as item, returns items added
+
+MazeItemHandle AddMazeItem(MazeItems *items, int x, int y, int type);           // Add item at cell, item type is replaced if cell already contains an item
+bool RemoveMazeItem(MazeItems *items, MazeItemHandle handle);                   // Remove item, returns false if handle is not valid
+MazeItemHandle GetMazeItemAt(const MazeItems *items, int x, int y);             // Get item at cell, returned handle is invalid if no item in cell
+bool IsMazeItemValid(const MazeItems *items, MazeItemHandle handle);            // Check if item handle references an active item
+int GetMazeItemType(const MazeItems *items, MazeItemHandle handle);             // Get item type, -1 if handle is not valid
+int GetMazeItemScore(int type);                                                 // Get score granted by item type pickup
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif // MAZE_ITEMS_H
+
+/***********************************************************************************
+*
+*   MAZE_ITEMS IMPLEMENTATION
+*
+************************************************************************************/
+
+#if defined(MAZE_ITEMS_IMPLEMENTATION) && !defined(MAZE_ITEMS_IMPLEMENTATION_DONE)
+#define MAZE_ITEMS_IMPLEMENTATION_DONE
+
+#include <stdlib.h>     // Required for: malloc(), realloc(), free()
+#include <string.h>     // Required for: memset()
+
+#define MAZE_ITEMS_MIN_CAPACITY     64
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Declaration
+//----------------------------------------------------------------------------------
+static unsigned int HashMazeCell(int cell, int capacity);                   // Hash cell index into lookup table position
+static int FindMazeItemSlot(const MazeItems *items, int cell);              // Find lookup table position for cell (or empty position)
+static bool GrowMazeItems(MazeItems *items);                                // Grow items arrays capacity
+static bool GrowMazeItemsLookup(MazeItems *items);                          // Grow lookup table capacity and rehash items
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+
+// Load items storage for a maze width, capacity grows as required
+MazeItems LoadMazeItems(int width, int capacity)
+{
+    MazeItems items = { 0 };
+
+    items.width = width;
+    items.capacity = (capacity < MAZE_ITEMS_MIN_CAPACITY)? MAZE_ITEMS_MIN_CAPACITY : capacity;
+
+    items.cell = (int *)malloc(items.capacity*sizeof(int));
+    items.type = (unsigned char *)malloc(items.capacity*sizeof(unsigned char));
+    items.state = (unsigned char *)calloc(items.capacity, sizeof(unsigned char));
+    items.generation = (unsigned int *)calloc(items.capacity, sizeof(unsigned int));
+    items.free_slots = (int *)malloc(items.capacity*sizeof(int));
+
+    // Lookup table kept under 50% load
+    items.lookup_capacity = 1;
+    while (items.lookup_capacity < items.capacity*2) items.lookup_capacity *= 2;
+    items.lookup = (int *)malloc(items.lookup_capacity*sizeof(int));
+    if (items.lookup != NULL) memset(items.lookup, 0xff, items.lookup_capacity*sizeof(int));
+
+    return items;
+}
+
+// Unload items storage
+void UnloadMazeItems(MazeItems *items)
+{
+    free(items->cell);
+    free(items->type);
+    free(items->state);
+    free(items->generation);
+    free(items->free_slots);
+    free(items->lookup);
+
+    *items = (MazeItems){ 0 };
+}
+
+// Remove all items, invalidating all handles
+void ClearMazeItems(MazeItems *items)
+{
+    for (int i = 0; i < items->used_slots; i++)
+    {
+        if (items->state[i] == MAZE_ITEM_STATE_ACTIVE) items->generation[i]++;
+        items->state[i] = MAZE_ITEM_STATE_FREE;
+    }
+
+    // NOTE: Slots generation is kept, so old handles stay invalid after slots reuse
+    items->free_count = 0;
+    for (int i = items->used_slots - 1; i >= 0; i--) items->free_slots[items->free_count++] = i;
+
+    items->count = 0;
+    memset(items->lookup, 0xff, items->lookup_capacity*sizeof(int));
+}
+
+// Add items for all grid cells marked as item, returns items added
+int AddMazeItemsFromGrid(MazeItems *items, MazeGrid grid, int type)
+{
+    int added = 0;
+
+    for (int y = 0; y < grid.height; y++)
+    {
+        for (int x = 0; x < grid.width; x++)
+        {
+            if (grid.cells[(size_t)y*grid.width + x] == MAZE_CELL_ITEM)
+            {
+                if (AddMazeItem(items, x, y, type).generation != 0) added++;
+            }
+        }
+    }
+
+    return added;
+}
+
+// Add item at cell, item type is replaced if cell already contains an item
+MazeItemHandle AddMazeItem(MazeItems *items, int x, int y, int type)
+{
+    MazeItemHandle handle = { 0 };
+
+    if ((x < 0) || (x >= items->width) || (y < 0)) return handle;
+
+    int cell = y*items->width + x;
+    int pos = FindMazeItemSlot(items, cell);
+
+    if (items->lookup[pos] != -1)
+    {
+        // Cell already contains an item, just update its type
+        int slot = items->lookup[pos];
+        items->type[slot] = (unsigned char)type;
+
+        handle.index = (unsigned int)slot;
+        handle.generation = items->generation[slot];
+        return handle;
+    }
+
+    // Keep lookup table under 50% load
+    if ((items->count + 1)*2 > items->lookup_capacity)
+    {
+        if (!GrowMazeItemsLookup(items)) return handle;
+        pos = FindMazeItemSlot(items, cell);
+    }
+
+    // Get a free slot, reusing removed items slots first
+    int slot = -1;
+    if (items->free_count > 0) slot = items->free_slots[--items->free_count];
+    else
+    {
+        if ((items->used_slots == items->capacity) && !GrowMazeItems(items)) return handle;
+        slot = items->used_slots++;
+    }
+
+    items->cell[slot] = cell;
+    items->type[slot] = (unsigned char)type;
+    items->state[slot] = MAZE_ITEM_STATE_ACTIVE;
+    if (items->generation[slot] == 0) items->generation[slot] = 1;
+    items->lookup[pos] = slot;
+    items->count++;
+
+    handle.index = (unsigned int)slot;
+    handle.generation = items->generation[slot];
+
+    return handle;
+}
+
+// Remove item, returns false if handle is not valid
+bool RemoveMazeItem(MazeItems *items, MazeItemHandle handle)
+{
+    if (!IsMazeItemValid(items, handle)) return false;
+
+    int slot = (int)handle.index;
+    int pos = FindMazeItemSlot(items, items->cell[slot]);
+
+    // Remove from lookup table using backward shift deletion,
+    // following entries in the probe sequence are moved to fill the gap
+    int mask = items->lookup_capacity - 1;
+    int next = (pos + 1) & mask;
+
+    while (items->lookup[next] != -1)
+    {
+        int ideal = (int)HashMazeCell(items->cell[items->lookup[next]], items->lookup_capacity);
+
+        // Move entry if its ideal position is not in the (pos, next] cyclic range
+        if (((next - ideal) & mask) >= ((next - pos) & mask))
+        {
+            items->lookup[pos] = items->lookup[next];
+            pos = next;
+        }
+
+        next = (next + 1) & mask;
+    }
+
+    items->lookup[pos] = -1;
+
+    // Release slot, generation increased to invalidate existing handles
+    items->state[slot] = MAZE_ITEM_STATE_FREE;
+    items->generation[slot]++;
+    if (items->generation[slot] == 0) items->generation[slot] = 1;
+    items->free_slots[items->free_count++] = slot;
+    items->count--;
+
+    return true;
+}
+
+// Get item at cell, returned handle is invalid if no item in cell
+MazeItemHandle GetMazeItemAt(const MazeItems *items, int x, int y)
+{
+    MazeItemHandle handle = { 0 };
+
+    if ((items->count == 0) || (x < 0) || (x >= items->width) || (y < 0)) return handle;
+
+    int slot = items->lookup[FindMazeItemSlot(items, y*items->width + x)];
+
+    if (slot != -1)
+    {
+        handle.index = (unsigned int)slot;
+        handle.generation = items->generation[slot];
+    }
+
+    return handle;
+}
+
+// Check if item handle references an active item
+bool IsMazeItemValid(const MazeItems *items, MazeItemHandle handle)
+{
+    if ((handle.generation == 0) || (handle.index >= (unsigned int)items->used_slots)) return false;
+
+    return ((items->state[handle.index] == MAZE_ITEM_STATE_ACTIVE) &&
+            (items->generation[handle.index] == handle.generation));
+}
+
+// Get item type, -1 if handle is not valid
+int GetMazeItemType(const MazeItems *items, MazeItemHandle handle)
+{
+    if (!IsMazeItemValid(items, handle)) return -1;
+
+    return items->type[handle.index];
+}
+
+// Get score granted by item type pickup
+int GetMazeItemScore(int type)
+{
+    int score = 0;
+
+    switch (type)
+    {
+        case MAZE_ITEM_COIN: score = 10; break;
+        case MAZE_ITEM_GEM: score = 50; break;
+        default: break;
+    }
+
+    return score;
+}
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Definition
+//----------------------------------------------------------------------------------
+
+// Hash cell index into lookup table position
+static unsigned int HashMazeCell(int cell, int capacity)
+{
+    // NOTE: Integer bits mixing, so neighbour cells spread over the whole table
+    unsigned int hash = (unsigned int)cell;
+    hash ^= hash >> 16;
+    hash *= 0x7feb352du;
+    hash ^= hash >> 15;
+    hash *= 0x846ca68bu;
+    hash ^= hash >> 16;
+
+    return hash & (unsigned int)(capacity - 1);
+}
+
+// Find lookup table position for cell (or empty position)
+static int FindMazeItemSlot(const MazeItems *items, int cell)
+{
+    int mask = items->lookup_capacity - 1;
+    int pos = (int)HashMazeCell(cell, items->lookup_capacity);
+
+    while ((items->lookup[pos] != -1) && (items->cell[items->lookup[pos]] != cell)) pos = (pos + 1) & mask;
+
+    return pos;
+}
+
+// Grow items arrays capacity
+static bool GrowMazeItems(MazeItems *items)
+{
+    int capacity = items->capacity*2;
+
+    int *cell = (int *)realloc(items->cell, capacity*sizeof(int));
+    if (cell != NULL) items->cell = cell;
+    unsigned char *type = (unsigned char *)realloc(items->type, capacity*sizeof(unsigned char));
+    if (type != NULL) items->type = type;
+    unsigned char *state = (unsigned char *)realloc(items->state, capacity*sizeof(unsigned char));
+    if (state != NULL) items->state = state;
+    unsigned int *generation = (unsigned int *)realloc(items->generation, capacity*sizeof(unsigned int));
+    if (generation != NULL) items->generation = generation;
+    int *free_slots = (int *)realloc(items->free_slots, capacity*sizeof(int));
+    if (free_slots != NULL) items->free_slots = free_slots;
+
+    if ((cell == NULL) || (type == NULL) || (state == NULL) || (generation == NULL) || (free_slots == NULL)) return false;
+
+    memset(items->state + items->capacity, 0, (capacity - items->capacity)*sizeof(unsigned char));
+    memset(items->generation + items->capacity, 0, (capacity - items->capacity)*sizeof(unsigned int));
+    items->capacity = capacity;
+
+    return true;
+}
+
+// Grow lookup table capacity and rehash items
+static bool GrowMazeItemsLookup(MazeItems *items)
+{
+    int capacity = items->lookup_capacity*2;
+    int *lookup = (int *)malloc(capacity*sizeof(int));
+
+    if (lookup == NULL) return false;
+
+    memset(lookup, 0xff, capacity*sizeof(int));
+
+    for (int i = 0; i < items->used_slots; i++)
+    {
+        if (items->state[i] == MAZE_ITEM_STATE_ACTIVE)
+        {
+            int pos = (int)HashMazeCell(items->cell[i], capacity);
+            while (lookup[pos] != -1) pos = (pos + 1) & (capacity - 1);
+            lookup[pos] = i;
+        }
+    }
+
+    free(items->lookup);
+    items->lookup = lookup;
+    items->lookup_capacity = capacity;
+
+    return true;
+}
+
+#endif // MAZE_ITEMS_IMPLEMENTATION
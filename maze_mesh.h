@@ -0,0 +1,651 @@
+/*******************************************************************************************
+*
+*   maze_mesh - Chunked 3d maze geometry, greedy-meshed and rebuilt incrementally
+*
+*   Maze is split into square chunks of cells, every chunk is one mesh: floor cells and
+*   wall tops are merged into big rectangles (greedy meshing), wall sides facing walkable
+*   cells are merged into runs along every wall line, so geometry scales with maze shapes
+*   instead of cells count. Edited cells only mark their chunks (and neighbour chunks
+*   sharing the border) dirty, only those meshes are rebuilt
+*
+*   All chunks share one material: biomes atlas texture and a shader repeating atlas tiles
+*   over merged quads (vertex texcoords in cells, tile origin in texcoords2), so changing
+*   biome only sets a shader uniform (atlas biome offset). Material is kept while mesh is
+*   loaded: a new maze only resets chunks, a new atlas only replaces material texture
+*
+*   Mesh coordinates are in cells (1 unit per cell, walls height in cells), maze cell (x, y)
+*   placed at (x, 0, y); meshes are drawn scaled and translated as required
+*
+*   CONFIGURATION:
+*       #define MAZE_MESH_IMPLEMENTATION
+*           Generates the implementation of the module in the including file,
+*           only one translation unit should define it
+*
+*   DEPENDENCIES:
+*       raylib          - Meshes, shaders and materials
+*       maze_grid       - Maze cells data
+*       maze_render     - Biomes atlas tiles
+*       maze_system     - Timing (GetMazeTime())
+*
+*   Copyright (c) 2024-2025 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#ifndef MAZE_MESH_H
+#define MAZE_MESH_H
+
+#include "raylib.h"
+#include "maze_grid.h"
+#include "maze_render.h"
+
+#define MAZE_MESH_MAX_CHUNK_SIZE    32      // Chunk size limit, chunk vertices indexed with 16 bit indices
+
+// Maze mesh statistics
+typedef struct MazeMeshStats {
+    int triangles;              // Triangles of all chunks
+    int quads;                  // Quads of all chunks (merged faces)
+    int rebuilt;                // Chunks rebuilt on last update
+    double time;                // Last update rebuild time in seconds
+} MazeMeshStats;
+
+// Maze chunked mesh
+typedef struct MazeMesh {
+    int width;                  // Maze width in cells
+    int height;                 // Maze height in cells
+    int chunk_size;             // Chunk size in cells
+    int chunks_x;               // Chunks per row
+    int chunks_y;               // Chunks per column
+    float wall_height;          // Walls height, in cells
+
+    Mesh *meshes;               // Chunks meshes
+    unsigned char *dirty;       // Chunks requiring rebuild
+    int *triangles;             // Chunks triangles
+
+    Material material;          // Shared material: atlas texture and tiling shader
+    int biome_loc;              // Shader biome offset location
+    int biome;                  // Current biome
+    MazeAtlas atlas;            // Biomes atlas (texture owned by caller)
+
+    // Build working buffers, one chunk
+    unsigned char *visited;     // Cells already merged
+    int quad_capacity;          // Quads allocated on buffers
+    float *vertices;
+    float *texcoords;
+    float *texcoords2;
+    float *normals;
+
+    MazeMeshStats stats;
+} MazeMesh;
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+MazeMesh LoadMazeMesh(MazeGrid grid, MazeAtlas atlas, int chunk_size, float wall_height); // Load maze mesh, all chunks built on first update
+void UnloadMazeMesh(MazeMesh *mesh);                                // Unload maze mesh chunks and shared material (atlas texture not unloaded)
+void ResetMazeMesh(MazeMesh *mesh, MazeGrid grid);                  // Reset chunks for a new maze (can be sized differently), material kept
+void SetMazeMeshAtlas(MazeMesh *mesh, MazeAtlas atlas);             // Set biomes atlas used by shared material (atlas texture owned by caller)
+void MarkMazeMeshDirty(MazeMesh *mesh, int x, int y, int width, int height); // Mark chunks with cells area (or bordering it) for rebuild
+int UpdateMazeMesh(MazeMesh *mesh, MazeGrid grid);                  // Rebuild dirty chunks, returns chunks rebuilt
+void SetMazeMeshBiome(MazeMesh *mesh, int biome);                   // Set biome used by shared material
+void DrawMazeMesh(MazeMesh mesh, Vector3 position, float scale);    // Draw all chunks, must be called inside BeginMode3D()
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif // MAZE_MESH_H
+
+/***********************************************************************************
+*
+*   MAZE_MESH IMPLEMENTATION
+*
+************************************************************************************/
+
+#if defined(MAZE_MESH_IMPLEMENTATION) && !defined(MAZE_MESH_IMPLEMENTATION_DONE)
+#define MAZE_MESH_IMPLEMENTATION_DONE
+
+#include "maze_system.h"    // Required for: GetMazeTime()
+
+#include <stdlib.h>     // Required for: malloc(), calloc(), free()
+#include <string.h>     // Required for: memcpy()
+
+#if defined(PLATFORM_DESKTOP)
+    #define MAZE_MESH_GLSL_VERSION      330
+#else   // PLATFORM_ANDROID, PLATFORM_WEB
+    #define MAZE_MESH_GLSL_VERSION      100
+#endif
+
+//----------------------------------------------------------------------------------
+// Global Variables Definition
+//----------------------------------------------------------------------------------
+
+// Tiling shader: atlas tile repeated over quad, texcoords in cells (fract() gives tile coordinates),
+// tile origin (biome 0) provided by texcoords2, biome selected by atlas offset uniform
+#if (MAZE_MESH_GLSL_VERSION == 330)
+static const char *maze_mesh_vs =
+    "#version 330\n"
+    "in vec3 vertexPosition;\n"
+    "in vec2 vertexTexCoord;\n"
+    "in vec2 vertexTexCoord2;\n"
+    "in vec3 vertexNormal;\n"
+    "uniform mat4 mvp;\n"
+    "out vec2 fragTexCoord;\n"
+    "out vec2 fragTileOrigin;\n"
+    "out float fragShade;\n"
+    "void main()\n"
+    "{\n"
+    "    fragTexCoord = vertexTexCoord;\n"
+    "    fragTileOrigin = vertexTexCoord2;\n"
+    "    fragShade = 0.7 + 0.3*vertexNormal.y + 0.1*vertexNormal.x;\n"
+    "    gl_Position = mvp*vec4(vertexPosition, 1.0);\n"
+    "}\n";
+static const char *maze_mesh_fs =
+    "#version 330\n"
+    "in vec2 fragTexCoord;\n"
+    "in vec2 fragTileOrigin;\n"
+    "in float fragShade;\n"
+    "uniform sampler2D texture0;\n"
+    "uniform vec4 colDiffuse;\n"
+    "uniform vec4 atlasTile;\n"     // xy: biome offset, zw: tile size (texture coordinates)
+    "out vec4 finalColor;\n"
+    "void main()\n"
+    "{\n"
+    "    vec4 texel = texture(texture0, fragTileOrigin + atlasTile.xy + fract(fragTexCoord)*atlasTile.zw);\n"
+    "    finalColor = vec4(texel.rgb*fragShade, texel.a)*colDiffuse;\n"
+    "}\n";
+#else
+static const char *maze_mesh_vs =
+    "#version 100\n"
+    "attribute vec3 vertexPosition;\n"
+    "attribute vec2 vertexTexCoord;\n"
+    "attribute vec2 vertexTexCoord2;\n"
+    "attribute vec3 vertexNormal;\n"
+    "uniform mat4 mvp;\n"
+    "varying vec2 fragTexCoord;\n"
+    "varying vec2 fragTileOrigin;\n"
+    "varying float fragShade;\n"
+    "void main()\n"
+    "{\n"
+    "    fragTexCoord = vertexTexCoord;\n"
+    "    fragTileOrigin = vertexTexCoord2;\n"
+    "    fragShade = 0.7 + 0.3*vertexNormal.y + 0.1*vertexNormal.x;\n"
+    "    gl_Position = mvp*vec4(vertexPosition, 1.0);\n"
+    "}\n";
+static const char *maze_mesh_fs =
+    "#version 100\n"
+    "precision mediump float;\n"
+    "varying vec2 fragTexCoord;\n"
+    "varying vec2 fragTileOrigin;\n"
+    "varying float fragShade;\n"
+    "uniform sampler2D texture0;\n"
+    "uniform vec4 colDiffuse;\n"
+    "uniform vec4 atlasTile;\n"
+    "void main()\n"
+    "{\n"
+    "    vec4 texel = texture2D(texture0, fragTileOrigin + atlasTile.xy + fract(fragTexCoord)*atlasTile.zw);\n"
+    "    gl_FragColor = vec4(texel.rgb*fragShade, texel.a)*colDiffuse;\n"
+    "}\n";
+#endif
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Declaration
+//----------------------------------------------------------------------------------
+static bool LoadMazeMeshChunks(MazeMesh *mesh, MazeGrid grid);    // Load chunks data for maze size, all chunks dirty
+static void UnloadMazeMeshChunks(MazeMesh *mesh);                   // Unload chunks meshes and data
+static Mesh GenMazeChunkMesh(MazeMesh *mesh, MazeGrid grid, int chunk_x, int chunk_y); // Generate chunk mesh (CPU data)
+static int AddMazeMeshQuad(MazeMesh *mesh, int quad, const Vector3 *corners, Vector2 size, Vector3 normal, int tile); // Add quad to build buffers, returns quads count
+static Vector2 GetMazeMeshTileOrigin(MazeAtlas atlas, int tile);   // Get biome 0 tile origin, texture coordinates
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+
+// Load maze mesh, all chunks built on first update
+// NOTE: Chunk size clamped to MAZE_MESH_MAX_CHUNK_SIZE
+MazeMesh LoadMazeMesh(MazeGrid grid, MazeAtlas atlas, int chunk_size, float wall_height)
+{
+    MazeMesh mesh = { 0 };
+
+    if ((grid.width <= 0) || (grid.height <= 0) || (chunk_size <= 0)) return mesh;
+    if (chunk_size > MAZE_MESH_MAX_CHUNK_SIZE) chunk_size = MAZE_MESH_MAX_CHUNK_SIZE;
+
+    mesh.chunk_size = chunk_size;
+    mesh.wall_height = wall_height;
+    mesh.atlas = atlas;
+
+    // NOTE: Every cell adds at most 5 quads (wall top and 4 sides)
+    mesh.quad_capacity = chunk_size*chunk_size*5;
+    mesh.visited = (unsigned char *)malloc(chunk_size*chunk_size);
+    mesh.vertices = (float *)malloc(mesh.quad_capacity*4*3*sizeof(float));
+    mesh.texcoords = (float *)malloc(mesh.quad_capacity*4*2*sizeof(float));
+    mesh.texcoords2 = (float *)malloc(mesh.quad_capacity*4*2*sizeof(float));
+    mesh.normals = (float *)malloc(mesh.quad_capacity*4*3*sizeof(float));
+
+    if (!LoadMazeMeshChunks(&mesh, grid) || (mesh.visited == NULL) ||
+        (mesh.vertices == NULL) || (mesh.texcoords == NULL) || (mesh.texcoords2 == NULL) || (mesh.normals == NULL))
+    {
+        UnloadMazeMesh(&mesh);
+        return mesh;
+    }
+
+    mesh.material = LoadMaterialDefault();
+    mesh.material.shader = LoadShaderFromMemory(maze_mesh_vs, maze_mesh_fs);
+    mesh.material.maps[MATERIAL_MAP_ALBEDO].texture = atlas.texture;
+    mesh.biome_loc = GetShaderLocation(mesh.material.shader, "atlasTile");
+    mesh.biome = -1;
+    SetMazeMeshBiome(&mesh, 0);
+
+    return mesh;
+}
+
+// Unload maze mesh chunks and shared material (atlas texture not unloaded)
+void UnloadMazeMesh(MazeMesh *mesh)
+{
+    UnloadMazeMeshChunks(mesh);
+
+    // NOTE: UnloadMaterial() would also unload atlas texture, shared with 2d renderer
+    if (mesh->material.maps != NULL)
+    {
+        UnloadShader(mesh->material.shader);
+        MemFree(mesh->material.maps);
+    }
+
+    free(mesh->visited);
+    free(mesh->vertices);
+    free(mesh->texcoords);
+    free(mesh->texcoords2);
+    free(mesh->normals);
+
+    *mesh = (MazeMesh){ 0 };
+}
+
+// Reset chunks for a new maze (can be sized differently), material kept
+// NOTE: All chunks built on next update
+void ResetMazeMesh(MazeMesh *mesh, MazeGrid grid)
+{
+    if (mesh->material.maps == NULL) return;
+
+    UnloadMazeMeshChunks(mesh);
+    LoadMazeMeshChunks(mesh, grid);
+}
+
+// Set biomes atlas used by shared material (atlas texture owned by caller)
+// NOTE: Chunks tile origins depend on atlas size, chunks only rebuilt if size changed
+void SetMazeMeshAtlas(MazeMesh *mesh, MazeAtlas atlas)
+{
+    if (mesh->material.maps == NULL) return;
+
+    bool resized = (atlas.texture.width != mesh->atlas.texture.width) || (atlas.texture.height != mesh->atlas.texture.height) ||
+                   (atlas.tile_size != mesh->atlas.tile_size);
+
+    mesh->atlas = atlas;
+    mesh->material.maps[MATERIAL_MAP_ALBEDO].texture = atlas.texture;
+
+    if (resized && (mesh->dirty != NULL)) memset(mesh->dirty, 1, mesh->chunks_x*mesh->chunks_y);
+
+    // Biome offset uniform set again for new atlas size
+    int biome = mesh->biome;
+    mesh->biome = -1;
+    SetMazeMeshBiome(mesh, (biome < 0)? 0 : biome);
+}
+
+// Mark chunks with cells area (or bordering it) for rebuild
+// NOTE: Chunks own wall sides of their wall cells, sides depend on neighbour cells,
+// so area is expanded one cell
+void MarkMazeMeshDirty(MazeMesh *mesh, int x, int y, int width, int height)
+{
+    if (mesh->dirty == NULL) return;
+
+    int min_x = (x - 1)/mesh->chunk_size;
+    int min_y = (y - 1)/mesh->chunk_size;
+    int max_x = (x + width)/mesh->chunk_size;
+    int max_y = (y + height)/mesh->chunk_size;
+
+    if (min_x < 0) min_x = 0;
+    if (min_y < 0) min_y = 0;
+    if (max_x > (mesh->chunks_x - 1)) max_x = mesh->chunks_x - 1;
+    if (max_y > (mesh->chunks_y - 1)) max_y = mesh->chunks_y - 1;
+
+    for (int cy = min_y; cy <= max_y; cy++)
+    {
+        for (int cx = min_x; cx <= max_x; cx++) mesh->dirty[cy*mesh->chunks_x + cx] = 1;
+    }
+}
+
+// Rebuild dirty chunks, returns chunks rebuilt
+int UpdateMazeMesh(MazeMesh *mesh, MazeGrid grid)
+{
+    if ((mesh->meshes == NULL) || (grid.width != mesh->width) || (grid.height != mesh->height)) return 0;
+
+    double start_time = GetMazeTime();
+    int rebuilt = 0;
+
+    for (int cy = 0; cy < mesh->chunks_y; cy++)
+    {
+        for (int cx = 0; cx < mesh->chunks_x; cx++)
+        {
+            int chunk = cy*mesh->chunks_x + cx;
+
+            if (!mesh->dirty[chunk]) continue;
+
+            if (mesh->meshes[chunk].vertexCount > 0) UnloadMesh(mesh->meshes[chunk]);
+
+            mesh->meshes[chunk] = GenMazeChunkMesh(mesh, grid, cx, cy);
+            if (mesh->meshes[chunk].vertexCount > 0) UploadMesh(&mesh->meshes[chunk], false);
+
+            mesh->stats.triangles += mesh->meshes[chunk].triangleCount - mesh->triangles[chunk];
+            mesh->triangles[chunk] = mesh->meshes[chunk].triangleCount;
+            mesh->dirty[chunk] = 0;
+            rebuilt++;
+        }
+    }
+
+    if (rebuilt > 0)
+    {
+        mesh->stats.quads = mesh->stats.triangles/2;
+        mesh->stats.rebuilt = rebuilt;
+        mesh->stats.time = GetMazeTime() - start_time;
+    }
+
+    return rebuilt;
+}
+
+// Set biome used by shared material
+void SetMazeMeshBiome(MazeMesh *mesh, int biome)
+{
+    if ((mesh->material.maps == NULL) || (biome == mesh->biome)) return;
+    if ((biome < 0) || (biome >= mesh->atlas.biome_count)) return;
+
+    // NOTE: Atlas biomes stacked vertically, same tiles layout for all biomes
+    float tile_u = (float)mesh->atlas.tile_size/mesh->atlas.texture.width;
+    float tile_v = (float)mesh->atlas.tile_size/mesh->atlas.texture.height;
+    float atlas_tile[4] = { 0.0f, biome*MAZE_ATLAS_BIOME_ROWS*tile_v, tile_u, tile_v };
+
+    SetShaderValue(mesh->material.shader, mesh->biome_loc, atlas_tile, SHADER_UNIFORM_VEC4);
+    mesh->biome = biome;
+}
+
+// Draw all chunks, must be called inside BeginMode3D()
+void DrawMazeMesh(MazeMesh mesh, Vector3 position, float scale)
+{
+    if (mesh.meshes == NULL) return;
+
+    Matrix transform = { 0 };
+    transform.m0 = scale;
+    transform.m5 = scale;
+    transform.m10 = scale;
+    transform.m12 = position.x;
+    transform.m13 = position.y;
+    transform.m14 = position.z;
+    transform.m15 = 1.0f;
+
+    for (int i = 0; i < (mesh.chunks_x*mesh.chunks_y); i++)
+    {
+        if (mesh.meshes[i].vertexCount > 0) DrawMesh(mesh.meshes[i], mesh.material, transform);
+    }
+}
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Definition
+//----------------------------------------------------------------------------------
+
+// Load chunks data for maze size, all chunks dirty
+static bool LoadMazeMeshChunks(MazeMesh *mesh, MazeGrid grid)
+{
+    if ((grid.width <= 0) || (grid.height <= 0)) return false;
+
+    mesh->width = grid.width;
+    mesh->height = grid.height;
+    mesh->chunks_x = (grid.width + mesh->chunk_size - 1)/mesh->chunk_size;
+    mesh->chunks_y = (grid.height + mesh->chunk_size - 1)/mesh->chunk_size;
+
+    int chunk_count = mesh->chunks_x*mesh->chunks_y;
+    mesh->meshes = (Mesh *)calloc(chunk_count, sizeof(Mesh));
+    mesh->dirty = (unsigned char *)malloc(chunk_count);
+    mesh->triangles = (int *)calloc(chunk_count, sizeof(int));
+
+    if ((mesh->meshes == NULL) || (mesh->dirty == NULL) || (mesh->triangles == NULL))
+    {
+        UnloadMazeMeshChunks(mesh);
+        return false;
+    }
+
+    memset(mesh->dirty, 1, chunk_count);
+
+    return true;
+}
+
+// Unload chunks meshes and data
+static void UnloadMazeMeshChunks(MazeMesh *mesh)
+{
+    if (mesh->meshes != NULL)
+    {
+        for (int i = 0; i < (mesh->chunks_x*mesh->chunks_y); i++)
+        {
+            if (mesh->meshes[i].vertexCount > 0) UnloadMesh(mesh->meshes[i]);
+        }
+    }
+
+    free(mesh->meshes);
+    free(mesh->dirty);
+    free(mesh->triangles);
+
+    mesh->meshes = NULL;
+    mesh->dirty = NULL;
+    mesh->triangles = NULL;
+    mesh->width = 0;
+    mesh->height = 0;
+    mesh->chunks_x = 0;
+    mesh->chunks_y = 0;
+    mesh->stats = (MazeMeshStats){ 0 };
+}
+
+// Generate chunk mesh (CPU data)
+// NOTE: Floor and wall tops: greedy rectangles (grow run along row, then grow rows while the
+// full run matches). Wall sides: runs of wall cells with walkable neighbour on same side,
+// cells out of maze are considered walls (no sides on maze borders)
+static Mesh GenMazeChunkMesh(MazeMesh *mesh, MazeGrid grid, int chunk_x, int chunk_y)
+{
+    Mesh result = { 0 };
+    int size = mesh->chunk_size;
+    int x0 = chunk_x*size;
+    int y0 = chunk_y*size;
+    int width = (x0 + size <= grid.width)? size : grid.width - x0;
+    int height = (y0 + size <= grid.height)? size : grid.height - y0;
+    float h = mesh->wall_height;
+    int quads = 0;
+
+    // Floor and wall tops
+    memset(mesh->visited, 0, size*size);
+
+    for (int y = 0; y < height; y++)
+    {
+        for (int x = 0; x < width; x++)
+        {
+            if (mesh->visited[y*size + x]) continue;
+
+            bool wall = (GetMazeCell(grid, x0 + x, y0 + y) == MAZE_CELL_WALL);
+            int run = 1;
+
+            while (((x + run) < width) && !mesh->visited[y*size + x + run] &&
+                   ((GetMazeCell(grid, x0 + x + run, y0 + y) == MAZE_CELL_WALL) == wall)) run++;
+
+            int rows = 1;
+            bool match = true;
+
+            while (((y + rows) < height) && match)
+            {
+                for (int i = 0; (i < run) && match; i++)
+                {
+                    match = !mesh->visited[(y + rows)*size + x + i] &&
+                            ((GetMazeCell(grid, x0 + x + i, y0 + y + rows) == MAZE_CELL_WALL) == wall);
+                }
+
+                if (match) rows++;
+            }
+
+            for (int r = 0; r < rows; r++) memset(&mesh->visited[(y + r)*size + x], 1, run);
+
+            float left = (float)(x0 + x);
+            float top = (float)(y0 + y);
+            float level = wall? h : 0.0f;
+            Vector3 corners[4] = {
+                { left, level, top }, { left, level, top + rows }, { left + run, level, top + rows }, { left + run, level, top }
+            };
+
+            // NOTE: Wall tops use wall tile joined on all sides, so merged tops look continuous
+            quads = AddMazeMeshQuad(mesh, quads, corners, (Vector2){ (float)run, (float)rows }, (Vector3){ 0.0f, 1.0f, 0.0f },
+                wall? (MAZE_ATLAS_TILE_WALL + 15) : MAZE_ATLAS_TILE_FLOOR);
+        }
+    }
+
+    // Wall sides, north and south faces: runs along rows
+    for (int side = 0; side < 2; side++)
+    {
+        int dy = (side == 0)? -1 : 1;
+
+        for (int y = 0; y < height; y++)
+        {
+            for (int x = 0; x < width; )
+            {
+                int run = 0;
+
+                while (((x + run) < width) && (GetMazeCell(grid, x0 + x + run, y0 + y) == MAZE_CELL_WALL) &&
+                       IsMazeCellWalkable(grid, x0 + x + run, y0 + y + dy) && ((y0 + y + dy) >= 0) && ((y0 + y + dy) < grid.height)) run++;
+
+                if (run == 0) { x++; continue; }
+
+                float left = (float)(x0 + x);
+                float right = left + run;
+                float z = (float)(y0 + y + side);
+
+                // NOTE: Corners ordered top-left, bottom-left, bottom-right, top-right seen from face front
+                if (side == 0)
+                {
+                    Vector3 corners[4] = { { right, h, z }, { right, 0.0f, z }, { left, 0.0f, z }, { left, h, z } };
+                    quads = AddMazeMeshQuad(mesh, quads, corners, (Vector2){ (float)run, h }, (Vector3){ 0.0f, 0.0f, -1.0f }, MAZE_ATLAS_TILE_SIDE_A);
+                }
+                else
+                {
+                    Vector3 corners[4] = { { left, h, z }, { left, 0.0f, z }, { right, 0.0f, z }, { right, h, z } };
+                    quads = AddMazeMeshQuad(mesh, quads, corners, (Vector2){ (float)run, h }, (Vector3){ 0.0f, 0.0f, 1.0f }, MAZE_ATLAS_TILE_SIDE_A);
+                }
+
+                x += run;
+            }
+        }
+    }
+
+    // Wall sides, west and east faces: runs along columns
+    for (int side = 0; side < 2; side++)
+    {
+        int dx = (side == 0)? -1 : 1;
+
+        for (int x = 0; x < width; x++)
+        {
+            for (int y = 0; y < height; )
+            {
+                int run = 0;
+
+                while (((y + run) < height) && (GetMazeCell(grid, x0 + x, y0 + y + run) == MAZE_CELL_WALL) &&
+                       IsMazeCellWalkable(grid, x0 + x + dx, y0 + y + run) && ((x0 + x + dx) >= 0) && ((x0 + x + dx) < grid.width)) run++;
+
+                if (run == 0) { y++; continue; }
+
+                float top = (float)(y0 + y);
+                float bottom = top + run;
+                float plane = (float)(x0 + x + side);
+
+                if (side == 0)
+                {
+                    Vector3 corners[4] = { { plane, h, top }, { plane, 0.0f, top }, { plane, 0.0f, bottom }, { plane, h, bottom } };
+                    quads = AddMazeMeshQuad(mesh, quads, corners, (Vector2){ (float)run, h }, (Vector3){ -1.0f, 0.0f, 0.0f }, MAZE_ATLAS_TILE_SIDE_A);
+                }
+                else
+                {
+                    Vector3 corners[4] = { { plane, h, bottom }, { plane, 0.0f, bottom }, { plane, 0.0f, top }, { plane, h, top } };
+                    quads = AddMazeMeshQuad(mesh, quads, corners, (Vector2){ (float)run, h }, (Vector3){ 1.0f, 0.0f, 0.0f }, MAZE_ATLAS_TILE_SIDE_A);
+                }
+
+                y += run;
+            }
+        }
+    }
+
+    if (quads == 0) return result;
+
+    // Mesh data copied from build buffers, indices for two triangles per quad
+    int vertex_count = quads*4;
+    result.vertexCount = vertex_count;
+    result.triangleCount = quads*2;
+    result.vertices = (float *)MemAlloc(vertex_count*3*sizeof(float));
+    result.texcoords = (float *)MemAlloc(vertex_count*2*sizeof(float));
+    result.texcoords2 = (float *)MemAlloc(vertex_count*2*sizeof(float));
+    result.normals = (float *)MemAlloc(vertex_count*3*sizeof(float));
+    result.indices = (unsigned short *)MemAlloc(quads*6*sizeof(unsigned short));
+
+    memcpy(result.vertices, mesh->vertices, vertex_count*3*sizeof(float));
+    memcpy(result.texcoords, mesh->texcoords, vertex_count*2*sizeof(float));
+    memcpy(result.texcoords2, mesh->texcoords2, vertex_count*2*sizeof(float));
+    memcpy(result.normals, mesh->normals, vertex_count*3*sizeof(float));
+
+    for (int q = 0; q < quads; q++)
+    {
+        unsigned short base = (unsigned short)(q*4);
+        unsigned short *index = &result.indices[q*6];
+        index[0] = base;
+        index[1] = base + 1;
+        index[2] = base + 2;
+        index[3] = base;
+        index[4] = base + 2;
+        index[5] = base + 3;
+    }
+
+    return result;
+}
+
+// Add quad to build buffers, returns quads count
+// NOTE: Texture coordinates in cells, tile repeated by shader every cell
+static int AddMazeMeshQuad(MazeMesh *mesh, int quad, const Vector3 *corners, Vector2 size, Vector3 normal, int tile)
+{
+    if (quad >= mesh->quad_capacity) return quad;
+
+    Vector2 origin = GetMazeMeshTileOrigin(mesh->atlas, tile);
+    const Vector2 coords[4] = { { 0.0f, 0.0f }, { 0.0f, size.y }, { size.x, size.y }, { size.x, 0.0f } };
+
+    for (int i = 0; i < 4; i++)
+    {
+        int v = quad*4 + i;
+
+        mesh->vertices[v*3 + 0] = corners[i].x;
+        mesh->vertices[v*3 + 1] = corners[i].y;
+        mesh->vertices[v*3 + 2] = corners[i].z;
+        mesh->texcoords[v*2 + 0] = coords[i].x;
+        mesh->texcoords[v*2 + 1] = coords[i].y;
+        mesh->texcoords2[v*2 + 0] = origin.x;
+        mesh->texcoords2[v*2 + 1] = origin.y;
+        mesh->normals[v*3 + 0] = normal.x;
+        mesh->normals[v*3 + 1] = normal.y;
+        mesh->normals[v*3 + 2] = normal.z;
+    }
+
+    return quad + 1;
+}
+
+// Get biome 0 tile origin, texture coordinates
+static Vector2 GetMazeMeshTileOrigin(MazeAtlas atlas, int tile)
+{
+    Rectangle rec = GetMazeAtlasTileRec(atlas, 0, tile);
+    Vector2 origin = { 0 };
+
+    if ((atlas.texture.width > 0) && (atlas.texture.height > 0))
+    {
+        origin.x = rec.x/atlas.texture.width;
+        origin.y = rec.y/atlas.texture.height;
+    }
+
+    return origin;
+}
+
+#endif // MAZE_MESH_IMPLEMENTATION
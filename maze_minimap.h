@@ -0,0 +1,314 @@
+/*******************************************************************************************
+*
+*   maze_minimap - Maze overview minimap with fog-of-war, updated incrementally
+*
+*   Minimap is kept in a render texture at reduced resolution (one pixel per block of
+*   cells, blocks sized to fit minimap size) and an explored cells bit-array. Only pixels
+*   with cells newly revealed by the player or changed (editor, items pickup) are drawn
+*   into the render texture, so minimap cost depends on cells changed, not maze size
+*
+*   Every pixel color summarizes its explored cells: walls and floor mixed by walkable cells
+*   proportion, items and goal highlighted; pixels without explored cells show fog
+*
+*   CONFIGURATION:
+*       #define MAZE_MINIMAP_IMPLEMENTATION
+*           Generates the implementation of the module in the including file,
+*           only one translation unit should define it
+*
+*   DEPENDENCIES:
+*       raylib          - Render texture and drawing
+*       maze_grid       - Maze cells data
+*       maze_system     - Timing (GetMazeTime())
+*
+*   Copyright (c) 2024-2025 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#ifndef MAZE_MINIMAP_H
+#define MAZE_MINIMAP_H
+
+#include "raylib.h"
+#include "maze_grid.h"
+
+// Maze minimap statistics, last update
+typedef struct MazeMinimapStats {
+    int explored;               // Cells explored
+    int revealed;               // Cells revealed on last update
+    int drawn;                  // Pixels drawn on last update
+    double time;                // Last update time in seconds
+} MazeMinimapStats;
+
+// Maze minimap
+typedef struct MazeMinimap {
+    int width;                  // Maze width in cells
+    int height;                 // Maze height in cells
+    int block;                  // Cells per minimap pixel (both directions)
+    int map_width;              // Minimap width in pixels
+    int map_height;             // Minimap height in pixels
+    RenderTexture2D target;     // Minimap pixels, persistent
+
+    int row_words;              // Explored bit-array words per row (rows aligned to 64 bits)
+    unsigned long long *explored; // Explored cells bit-array
+
+    int *pending;               // Pixels to draw on next update
+    int pending_count;          // Pixels to draw count
+    unsigned char *queued;      // Pixels already queued, per pixel
+    bool cleared;               // Render texture cleared to fog
+
+    MazeMinimapStats stats;
+} MazeMinimap;
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+MazeMinimap LoadMazeMinimap(MazeGrid grid, int max_size);           // Load minimap, biggest side up to max_size pixels, nothing explored
+void UnloadMazeMinimap(MazeMinimap *minimap);                       // Unload minimap render texture and data
+int RevealMazeMinimap(MazeMinimap *minimap, int x, int y, int radius); // Explore cells around a cell, returns cells newly revealed
+void MarkMazeMinimapArea(MazeMinimap *minimap, int x, int y, int width, int height); // Mark cells area changed, drawn again if explored
+int UpdateMazeMinimap(MazeMinimap *minimap, MazeGrid grid);         // Draw pending pixels into render texture, returns pixels drawn
+void DrawMazeMinimap(MazeMinimap minimap, Rectangle bounds, Vector2 player, Color player_color); // Draw minimap and player marker (player in cells)
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif // MAZE_MINIMAP_H
+
+/***********************************************************************************
+*
+*   MAZE_MINIMAP IMPLEMENTATION
+*
+************************************************************************************/
+
+#if defined(MAZE_MINIMAP_IMPLEMENTATION) && !defined(MAZE_MINIMAP_IMPLEMENTATION_DONE)
+#define MAZE_MINIMAP_IMPLEMENTATION_DONE
+
+#include "maze_system.h"    // Required for: GetMazeTime()
+
+#include <stdlib.h>     // Required for: calloc(), malloc(), free()
+
+#define MAZE_MINIMAP_FOG        (Color){ 24, 24, 28, 255 }      // Not explored
+#define MAZE_MINIMAP_WALL       (Color){ 70, 70, 80, 255 }      // Explored walls
+#define MAZE_MINIMAP_FLOOR      (Color){ 200, 200, 190, 255 }   // Explored floor
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Declaration
+//----------------------------------------------------------------------------------
+static void QueueMazeMinimapPixel(MazeMinimap *minimap, int pixel_x, int pixel_y); // Queue pixel for drawing, once
+static Color GetMazeMinimapPixelColor(const MazeMinimap *minimap, MazeGrid grid, int pixel_x, int pixel_y); // Get pixel color from its explored cells
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+
+// Load minimap, biggest side up to max_size pixels, nothing explored
+MazeMinimap LoadMazeMinimap(MazeGrid grid, int max_size)
+{
+    MazeMinimap minimap = { 0 };
+
+    if ((grid.width <= 0) || (grid.height <= 0) || (max_size <= 0)) return minimap;
+
+    int size = (grid.width > grid.height)? grid.width : grid.height;
+
+    minimap.width = grid.width;
+    minimap.height = grid.height;
+    minimap.block = (size + max_size - 1)/max_size;
+    minimap.map_width = (grid.width + minimap.block - 1)/minimap.block;
+    minimap.map_height = (grid.height + minimap.block - 1)/minimap.block;
+    minimap.row_words = (grid.width + 63)/64;
+
+    int pixel_count = minimap.map_width*minimap.map_height;
+    minimap.explored = (unsigned long long *)calloc((size_t)minimap.row_words*grid.height, sizeof(unsigned long long));
+    minimap.pending = (int *)malloc(pixel_count*sizeof(int));
+    minimap.queued = (unsigned char *)calloc(pixel_count, 1);
+
+    if ((minimap.explored == NULL) || (minimap.pending == NULL) || (minimap.queued == NULL))
+    {
+        UnloadMazeMinimap(&minimap);
+        return minimap;
+    }
+
+    minimap.target = LoadRenderTexture(minimap.map_width, minimap.map_height);
+
+    return minimap;
+}
+
+// Unload minimap render texture and data
+void UnloadMazeMinimap(MazeMinimap *minimap)
+{
+    if (minimap->target.id > 0) UnloadRenderTexture(minimap->target);
+
+    free(minimap->explored);
+    free(minimap->pending);
+    free(minimap->queued);
+
+    *minimap = (MazeMinimap){ 0 };
+}
+
+// Explore cells around a cell, returns cells newly revealed
+// NOTE: Cells revealed inside a circle, walls do not block sight
+int RevealMazeMinimap(MazeMinimap *minimap, int x, int y, int radius)
+{
+    if (minimap->explored == NULL) return 0;
+
+    int revealed = 0;
+
+    for (int cy = y - radius; cy <= y + radius; cy++)
+    {
+        if ((cy < 0) || (cy >= minimap->height)) continue;
+
+        for (int cx = x - radius; cx <= x + radius; cx++)
+        {
+            if ((cx < 0) || (cx >= minimap->width)) continue;
+            if (((cx - x)*(cx - x) + (cy - y)*(cy - y)) > radius*radius) continue;
+
+            unsigned long long *word = &minimap->explored[cy*minimap->row_words + cx/64];
+            unsigned long long bit = 1ULL << (cx%64);
+
+            if (*word & bit) continue;
+
+            *word |= bit;
+            revealed++;
+            QueueMazeMinimapPixel(minimap, cx/minimap->block, cy/minimap->block);
+        }
+    }
+
+    minimap->stats.explored += revealed;
+    minimap->stats.revealed += revealed;
+
+    return revealed;
+}
+
+// Mark cells area changed, drawn again if explored
+void MarkMazeMinimapArea(MazeMinimap *minimap, int x, int y, int width, int height)
+{
+    if (minimap->explored == NULL) return;
+
+    int min_x = (x < 0)? 0 : x/minimap->block;
+    int min_y = (y < 0)? 0 : y/minimap->block;
+    int max_x = (x + width - 1)/minimap->block;
+    int max_y = (y + height - 1)/minimap->block;
+
+    if (max_x >= minimap->map_width) max_x = minimap->map_width - 1;
+    if (max_y >= minimap->map_height) max_y = minimap->map_height - 1;
+
+    for (int py = min_y; py <= max_y; py++)
+    {
+        for (int px = min_x; px <= max_x; px++) QueueMazeMinimapPixel(minimap, px, py);
+    }
+}
+
+// Draw pending pixels into render texture, returns pixels drawn
+// NOTE: Render texture only bound if any pixel changed, pixels batched together
+int UpdateMazeMinimap(MazeMinimap *minimap, MazeGrid grid)
+{
+    minimap->stats.drawn = 0;
+
+    if ((minimap->target.id == 0) || (grid.width != minimap->width) || (grid.height != minimap->height)) return 0;
+    if (minimap->cleared && (minimap->pending_count == 0))
+    {
+        minimap->stats.revealed = 0;
+        minimap->stats.time = 0.0;
+        return 0;
+    }
+
+    double start_time = GetMazeTime();
+
+    BeginTextureMode(minimap->target);
+
+    if (!minimap->cleared)
+    {
+        ClearBackground(MAZE_MINIMAP_FOG);
+        minimap->cleared = true;
+    }
+
+    for (int i = 0; i < minimap->pending_count; i++)
+    {
+        int pixel = minimap->pending[i];
+        int pixel_x = pixel%minimap->map_width;
+        int pixel_y = pixel/minimap->map_width;
+
+        DrawPixel(pixel_x, pixel_y, GetMazeMinimapPixelColor(minimap, grid, pixel_x, pixel_y));
+        minimap->queued[pixel] = 0;
+    }
+
+    EndTextureMode();
+
+    minimap->stats.drawn = minimap->pending_count;
+    minimap->stats.revealed = 0;
+    minimap->stats.time = GetMazeTime() - start_time;
+    minimap->pending_count = 0;
+
+    return minimap->stats.drawn;
+}
+
+// Draw minimap and player marker (player in cells)
+void DrawMazeMinimap(MazeMinimap minimap, Rectangle bounds, Vector2 player, Color player_color)
+{
+    if (minimap.target.id == 0) return;
+
+    // NOTE: Render texture is vertically flipped (OpenGL coordinates)
+    Rectangle source = { 0.0f, 0.0f, (float)minimap.map_width, -(float)minimap.map_height };
+
+    DrawTexturePro(minimap.target.texture, source, bounds, (Vector2){ 0.0f, 0.0f }, 0.0f, WHITE);
+    DrawRectangleLines((int)bounds.x - 1, (int)bounds.y - 1, (int)bounds.width + 2, (int)bounds.height + 2, LIGHTGRAY);
+
+    float scale_x = bounds.width/minimap.width;
+    float scale_y = bounds.height/minimap.height;
+    DrawRectangle((int)(bounds.x + player.x*scale_x) - 2, (int)(bounds.y + player.y*scale_y) - 2, 4, 4, player_color);
+}
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Definition
+//----------------------------------------------------------------------------------
+
+// Queue pixel for drawing, once
+static void QueueMazeMinimapPixel(MazeMinimap *minimap, int pixel_x, int pixel_y)
+{
+    int pixel = pixel_y*minimap->map_width + pixel_x;
+
+    if (minimap->queued[pixel]) return;
+
+    minimap->queued[pixel] = 1;
+    minimap->pending[minimap->pending_count++] = pixel;
+}
+
+// Get pixel color from its explored cells
+static Color GetMazeMinimapPixelColor(const MazeMinimap *minimap, MazeGrid grid, int pixel_x, int pixel_y)
+{
+    int explored = 0;
+    int walkable = 0;
+    bool item = false;
+    bool goal = false;
+
+    int min_x = pixel_x*minimap->block;
+    int min_y = pixel_y*minimap->block;
+    int max_x = (min_x + minimap->block < grid.width)? min_x + minimap->block : grid.width;
+    int max_y = (min_y + minimap->block < grid.height)? min_y + minimap->block : grid.height;
+
+    for (int y = min_y; y < max_y; y++)
+    {
+        const unsigned long long *row = &minimap->explored[y*minimap->row_words];
+
+        for (int x = min_x; x < max_x; x++)
+        {
+            if (!(row[x/64] & (1ULL << (x%64)))) continue;
+
+            int cell = grid.cells[y*grid.width + x];
+
+            explored++;
+            if (cell != MAZE_CELL_WALL) walkable++;
+            if (cell == MAZE_CELL_ITEM) item = true;
+            else if (cell == MAZE_CELL_GOAL) goal = true;
+        }
+    }
+
+    if (explored == 0) return MAZE_MINIMAP_FOG;
+    if (goal) return GREEN;
+    if (item) return GOLD;
+
+    return ColorLerp(MAZE_MINIMAP_WALL, MAZE_MINIMAP_FLOOR, (float)walkable/explored);
+}
+
+#endif // MAZE_MINIMAP_IMPLEMENTATION
@@ -0,0 +1,552 @@
+/*******************************************************************************************
+*
+*   maze_path - Maze solvability validation and shortest path search
+*
+*   Walkable cells are kept in a bit-packed copy of the maze (1 bit per cell, rows aligned
+*   to 64 bits), updated on every cell edit. Reachability is checked with a bit-parallel
+*   flood fill, 64 cells per operation, and shortest paths are found with A* (manhattan
+*   heuristic, two-buckets open list), only once goal is known to be reachable. Edits only invalidate current path when they
+*   can change the result (blocking a path cell, opening a cell that could connect two
+*   areas or changing path ends), so most editor strokes do not require any search
+*
+*   CONFIGURATION:
+*       #define MAZE_PATH_IMPLEMENTATION
+*           Generates the implementation of the module in the including file,
+*           only one translation unit should define it
+*
+*   DEPENDENCIES:
+*       maze_grid       - Maze cells data, walls are not walkable
+*       maze_system     - Timing (GetMazeTime())
+*
+*   NOTE: Module is window-free and does not depend on raylib
+*
+*   Copyright (c) 2024-2025 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#ifndef MAZE_PATH_H
+#define MAZE_PATH_H
+
+#include "maze_grid.h"
+#include "maze_system.h"
+
+// Maze path search statistics, last search
+typedef struct MazePathStats {
+    int visited;            // Number of cells visited
+    double time;            // Search time in seconds
+    int searches;           // Number of searches run since path loading
+} MazePathStats;
+
+// Maze path between two cells, kept valid while maze is edited
+typedef struct MazePath {
+    int width;                      // Maze width in cells
+    int height;                     // Maze height in cells
+    int row_words;                  // Bit-arrays words per row (rows aligned to 64 bits)
+    unsigned long long *walkable;   // Walkable cells bit-array, kept in sync with cell edits
+
+    int start;                      // Path start cell index
+    int goal;                       // Path goal cell index
+    bool reachable;                 // Goal can be reached from start
+    bool needs_update;              // Path must be searched again (UpdateMazePath())
+
+    int *cells;                     // Path cells indices, from start to goal (both included)
+    int length;                     // Path cells count (0 if not reachable)
+    unsigned long long *on_path;    // Path cells bit-array
+
+    // Search working buffers, allocated on first search and reused
+    unsigned long long *visited;    // Visited cells bit-array
+    unsigned long long *closed;     // Expanded cells bit-array (A*)
+    unsigned int *cost;             // Cells cost from start (A*)
+    unsigned char *parent;          // Cells parent direction (A*)
+    unsigned int *open[2];          // Open cells lists, current and next f cost (A*)
+    int open_count[2];
+    int open_capacity[2];
+
+    MazePathStats stats;
+} MazePath;
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+MazePath LoadMazePath(MazeGrid grid);                               // Load maze path data from maze grid walkable cells
+void UnloadMazePath(MazePath *path);                                // Unload maze path data
+void SetMazePathEnds(MazePath *path, int start_x, int start_y, int goal_x, int goal_y); // Set path start and goal cells
+void UpdateMazePathCell(MazePath *path, MazeGrid grid, int x, int y); // Update path data after a cell edit (invalidates path if required)
+void UpdateMazePathArea(MazePath *path, MazeGrid grid, int x, int y, int width, int height); // Update path data after a cells area edit (invalidates path once if required)
+bool UpdateMazePath(MazePath *path);                                // Search path again if invalidated, returns true if searched
+bool IsMazeCellReachable(MazePath *path, int from_x, int from_y, int to_x, int to_y); // Check if a cell can be reached from another (flood fill)
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif // MAZE_PATH_H
+
+/***********************************************************************************
+*
+*   MAZE_PATH IMPLEMENTATION
+*
+************************************************************************************/
+
+#if defined(MAZE_PATH_IMPLEMENTATION) && !defined(MAZE_PATH_IMPLEMENTATION_DONE)
+#define MAZE_PATH_IMPLEMENTATION_DONE
+
+#include <stdlib.h>     // Required for: malloc(), calloc(), realloc(), free(), abs()
+#include <string.h>     // Required for: memset()
+
+// Bit-arrays access (1 bit per cell), rows aligned to 64 bits
+#define MAZE_PATH_BIT_WORD(path, x, y)  ((size_t)(y)*(path)->row_words + ((x) >> 6))
+#define MAZE_PATH_BIT_GET(bits, path, x, y)     (((bits)[MAZE_PATH_BIT_WORD(path, x, y)] >> ((x) & 63)) & 1ULL)
+#define MAZE_PATH_BIT_SET(bits, path, x, y)     ((bits)[MAZE_PATH_BIT_WORD(path, x, y)] |= (1ULL << ((x) & 63)))
+#define MAZE_PATH_BIT_CLEAR(bits, path, x, y)   ((bits)[MAZE_PATH_BIT_WORD(path, x, y)] &= ~(1ULL << ((x) & 63)))
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Declaration
+//----------------------------------------------------------------------------------
+static bool LoadMazePathBuffers(MazePath *path);                    // Allocate search working buffers, if required
+static bool FillMazePathRow(unsigned long long *row, const unsigned long long *walkable, int words); // Flood fill row walkable runs from row bits, returns true if row changed
+static bool PushMazePathOpen(MazePath *path, int list, unsigned int cell); // Push cell into A* open list
+static bool FindMazePath(MazePath *path);                           // Find shortest path from start to goal (A*)
+static void ClearMazePathCells(MazePath *path);                     // Clear current path cells
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+
+// Load maze path data from maze grid walkable cells
+MazePath LoadMazePath(MazeGrid grid)
+{
+    MazePath path = { 0 };
+
+    if ((grid.width <= 0) || (grid.height <= 0) || (grid.cells == NULL)) return path;
+
+    path.width = grid.width;
+    path.height = grid.height;
+    path.row_words = (grid.width + 63)/64;
+    path.walkable = (unsigned long long *)calloc((size_t)path.row_words*path.height, sizeof(unsigned long long));
+    path.on_path = (unsigned long long *)calloc((size_t)path.row_words*path.height, sizeof(unsigned long long));
+
+    if (path.walkable != NULL)
+    {
+        for (int y = 0; y < grid.height; y++)
+        {
+            for (int x = 0; x < grid.width; x++)
+            {
+                if (grid.cells[(size_t)y*grid.width + x] != MAZE_CELL_WALL) MAZE_PATH_BIT_SET(path.walkable, &path, x, y);
+            }
+        }
+    }
+
+    path.start = -1;
+    path.goal = -1;
+
+    return path;
+}
+
+// Unload maze path data
+void UnloadMazePath(MazePath *path)
+{
+    free(path->walkable);
+    free(path->cells);
+    free(path->on_path);
+    free(path->visited);
+    free(path->closed);
+    free(path->cost);
+    free(path->parent);
+    free(path->open[0]);
+    free(path->open[1]);
+
+    *path = (MazePath){ 0 };
+}
+
+// Set path start and goal cells
+void SetMazePathEnds(MazePath *path, int start_x, int start_y, int goal_x, int goal_y)
+{
+    int start = ((start_x >= 0) && (start_x < path->width) && (start_y >= 0) && (start_y < path->height))? start_y*path->width + start_x : -1;
+    int goal = ((goal_x >= 0) && (goal_x < path->width) && (goal_y >= 0) && (goal_y < path->height))? goal_y*path->width + goal_x : -1;
+
+    if ((start != path->start) || (goal != path->goal))
+    {
+        path->start = start;
+        path->goal = goal;
+        path->needs_update = true;
+    }
+}
+
+// Update path data after a cell edit (invalidates path if required)
+// NOTE: Current result is only invalidated when the edit can change it:
+//  - Cell blocked: only if it was part of current path
+//  - Cell opened: only if it connects two or more walkable cells (otherwise it is a dead end),
+//    it could join start and goal areas or provide a shorter path
+void UpdateMazePathCell(MazePath *path, MazeGrid grid, int x, int y)
+{
+    if ((path->walkable == NULL) || (x < 0) || (x >= path->width) || (y < 0) || (y >= path->height)) return;
+
+    int cell = y*path->width + x;
+    bool walkable = IsMazeCellWalkable(grid, x, y);
+
+    if (walkable == (bool)MAZE_PATH_BIT_GET(path->walkable, path, x, y)) return;
+
+    if (walkable)
+    {
+        MAZE_PATH_BIT_SET(path->walkable, path, x, y);
+
+        int neighbours = 0;
+        if ((x > 0) && MAZE_PATH_BIT_GET(path->walkable, path, x - 1, y)) neighbours++;
+        if ((x < (path->width - 1)) && MAZE_PATH_BIT_GET(path->walkable, path, x + 1, y)) neighbours++;
+        if ((y > 0) && MAZE_PATH_BIT_GET(path->walkable, path, x, y - 1)) neighbours++;
+        if ((y < (path->height - 1)) && MAZE_PATH_BIT_GET(path->walkable, path, x, y + 1)) neighbours++;
+
+        if ((neighbours >= 2) || (cell == path->start) || (cell == path->goal)) path->needs_update = true;
+    }
+    else
+    {
+        MAZE_PATH_BIT_CLEAR(path->walkable, path, x, y);
+
+        if (MAZE_PATH_BIT_GET(path->on_path, path, x, y) || (cell == path->start) || (cell == path->goal)) path->needs_update = true;
+    }
+}
+
+// Update path data after a cells area edit (invalidates path once if required)
+// NOTE: Same checks than UpdateMazePathCell(), opened cells neighbours counted with cells already
+// updated, so the last opened cell of any run connecting two areas finds both sides walkable
+void UpdateMazePathArea(MazePath *path, MazeGrid grid, int x, int y, int width, int height)
+{
+    if (path->walkable == NULL) return;
+
+    int x0 = (x < 0)? 0 : x;
+    int y0 = (y < 0)? 0 : y;
+    int x1 = ((x + width) > path->width)? path->width : x + width;
+    int y1 = ((y + height) > path->height)? path->height : y + height;
+    bool invalidated = false;
+
+    for (int cy = y0; cy < y1; cy++)
+    {
+        for (int cx = x0; cx < x1; cx++)
+        {
+            bool walkable = IsMazeCellWalkable(grid, cx, cy);
+
+            if (walkable == (bool)MAZE_PATH_BIT_GET(path->walkable, path, cx, cy)) continue;
+
+            int cell = cy*path->width + cx;
+
+            if (walkable)
+            {
+                MAZE_PATH_BIT_SET(path->walkable, path, cx, cy);
+
+                if (invalidated) continue;
+
+                int neighbours = 0;
+                if ((cx > 0) && MAZE_PATH_BIT_GET(path->walkable, path, cx - 1, cy)) neighbours++;
+                if ((cx < (path->width - 1)) && MAZE_PATH_BIT_GET(path->walkable, path, cx + 1, cy)) neighbours++;
+                if ((cy > 0) && MAZE_PATH_BIT_GET(path->walkable, path, cx, cy - 1)) neighbours++;
+                if ((cy < (path->height - 1)) && MAZE_PATH_BIT_GET(path->walkable, path, cx, cy + 1)) neighbours++;
+
+                if ((neighbours >= 2) || (cell == path->start) || (cell == path->goal)) invalidated = true;
+            }
+            else
+            {
+                MAZE_PATH_BIT_CLEAR(path->walkable, path, cx, cy);
+
+                if (MAZE_PATH_BIT_GET(path->on_path, path, cx, cy) || (cell == path->start) || (cell == path->goal)) invalidated = true;
+            }
+        }
+    }
+
+    if (invalidated) path->needs_update = true;
+}
+
+// Search path again if invalidated, returns true if searched
+bool UpdateMazePath(MazePath *path)
+{
+    if (!path->needs_update) return false;
+
+    double start_time = GetMazeTime();
+
+    // NOTE: Reachability checked first with bit-parallel flood fill, A* would visit
+    // all cells reachable from start before reporting an unreachable goal
+    bool reachable = (path->walkable != NULL) && (path->start >= 0) && (path->goal >= 0) &&
+        IsMazeCellReachable(path, path->start%path->width, path->start/path->width, path->goal%path->width, path->goal/path->width);
+
+    if (reachable) path->reachable = FindMazePath(path);
+    else
+    {
+        ClearMazePathCells(path);
+        path->reachable = false;
+    }
+
+    path->needs_update = false;
+    path->stats.time = GetMazeTime() - start_time;
+    path->stats.searches++;
+
+    return true;
+}
+
+// Check if a cell can be reached from another, using bit-parallel flood fill
+// NOTE: Reached cells are filled 64 cells at once, sweeping rows down and up
+// until target is reached or a full sweep does not reach any new cell
+bool IsMazeCellReachable(MazePath *path, int from_x, int from_y, int to_x, int to_y)
+{
+    if ((from_x < 0) || (from_x >= path->width) || (from_y < 0) || (from_y >= path->height) ||
+        (to_x < 0) || (to_x >= path->width) || (to_y < 0) || (to_y >= path->height)) return false;
+
+    if (!MAZE_PATH_BIT_GET(path->walkable, path, from_x, from_y) || !MAZE_PATH_BIT_GET(path->walkable, path, to_x, to_y)) return false;
+    if ((from_x == to_x) && (from_y == to_y)) return true;
+    if (!LoadMazePathBuffers(path)) return false;
+
+    const int words = path->row_words;
+    unsigned long long *reached = path->visited;
+    memset(reached, 0, (size_t)words*path->height*sizeof(unsigned long long));
+    MAZE_PATH_BIT_SET(reached, path, from_x, from_y);
+
+    // Rows range containing reached cells, sweeps limited to it
+    int min_y = from_y;
+    int max_y = from_y;
+    bool changed = true;
+
+    FillMazePathRow(&reached[(size_t)from_y*words], &path->walkable[(size_t)from_y*words], words);
+
+    while (changed && !MAZE_PATH_BIT_GET(reached, path, to_x, to_y))
+    {
+        changed = false;
+
+        // Sweep down: every row seeded from row above, then filled horizontally
+        for (int y = (min_y > 0)? min_y : 1; y < path->height; y++)
+        {
+            unsigned long long *row = &reached[(size_t)y*words];
+            const unsigned long long *above = row - words;
+            const unsigned long long *walkable = &path->walkable[(size_t)y*words];
+            bool seeded = false;
+
+            for (int i = 0; i < words; i++)
+            {
+                unsigned long long seed = above[i] & walkable[i] & ~row[i];
+                if (seed) { row[i] |= seed; seeded = true; }
+            }
+
+            if (seeded)
+            {
+                FillMazePathRow(row, walkable, words);
+                changed = true;
+                if (y > max_y) max_y = y;
+            }
+            else if (y > max_y) break;      // Nothing reached below this row yet
+        }
+
+        // Sweep up: every row seeded from row below, then filled horizontally
+        for (int y = ((max_y < (path->height - 1))? max_y : path->height - 2); y >= 0; y--)
+        {
+            unsigned long long *row = &reached[(size_t)y*words];
+            const unsigned long long *below = row + words;
+            const unsigned long long *walkable = &path->walkable[(size_t)y*words];
+            bool seeded = false;
+
+            for (int i = 0; i < words; i++)
+            {
+                unsigned long long seed = below[i] & walkable[i] & ~row[i];
+                if (seed) { row[i] |= seed; seeded = true; }
+            }
+
+            if (seeded)
+            {
+                FillMazePathRow(row, walkable, words);
+                changed = true;
+                if (y < min_y) min_y = y;
+            }
+            else if (y < min_y) break;      // Nothing reached above this row yet
+        }
+    }
+
+    return (bool)MAZE_PATH_BIT_GET(reached, path, to_x, to_y);
+}
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Definition
+//----------------------------------------------------------------------------------
+
+// Allocate search working buffers, if required
+static bool LoadMazePathBuffers(MazePath *path)
+{
+    size_t cell_count = (size_t)path->width*path->height;
+    size_t word_count = (size_t)path->row_words*path->height;
+
+    if (path->visited == NULL) path->visited = (unsigned long long *)malloc(word_count*sizeof(unsigned long long));
+    if (path->closed == NULL) path->closed = (unsigned long long *)malloc(word_count*sizeof(unsigned long long));
+    if (path->cost == NULL) path->cost = (unsigned int *)malloc(cell_count*sizeof(unsigned int));
+    if (path->parent == NULL) path->parent = (unsigned char *)malloc(cell_count*sizeof(unsigned char));
+
+    return ((path->visited != NULL) && (path->closed != NULL) && (path->cost != NULL) && (path->parent != NULL));
+}
+
+// Flood fill row walkable runs from row bits, returns true if row changed
+// NOTE: Fill is done 64 cells at once (occluded fill), carrying across words
+// when a walkable run continues into next word
+static bool FillMazePathRow(unsigned long long *row, const unsigned long long *walkable, int words)
+{
+    bool changed = false;
+    unsigned long long carry = 0;
+
+    // Fill towards higher cells (east)
+    for (int i = 0; i < words; i++)
+    {
+        unsigned long long w = walkable[i];
+        unsigned long long g = (row[i] | carry) & w;
+        unsigned long long p = w;
+
+        g |= p & (g << 1); p &= p << 1;
+        g |= p & (g << 2); p &= p << 2;
+        g |= p & (g << 4); p &= p << 4;
+        g |= p & (g << 8); p &= p << 8;
+        g |= p & (g << 16); p &= p << 16;
+        g |= p & (g << 32);
+
+        if (g != row[i]) { row[i] = g; changed = true; }
+        carry = g >> 63;
+    }
+
+    carry = 0;
+
+    // Fill towards lower cells (west)
+    for (int i = words - 1; i >= 0; i--)
+    {
+        unsigned long long w = walkable[i];
+        unsigned long long g = (row[i] | (carry << 63)) & w;
+        unsigned long long p = w;
+
+        g |= p & (g >> 1); p &= p >> 1;
+        g |= p & (g >> 2); p &= p >> 2;
+        g |= p & (g >> 4); p &= p >> 4;
+        g |= p & (g >> 8); p &= p >> 8;
+        g |= p & (g >> 16); p &= p >> 16;
+        g |= p & (g >> 32);
+
+        if (g != row[i]) { row[i] = g; changed = true; }
+        carry = g & 1;
+    }
+
+    return changed;
+}
+
+// Push cell into A* open list, growing it if required
+static bool PushMazePathOpen(MazePath *path, int list, unsigned int cell)
+{
+    if (path->open_count[list] >= path->open_capacity[list])
+    {
+        int capacity = (path->open_capacity[list] > 0)? path->open_capacity[list]*2 : 1024;
+        unsigned int *open = (unsigned int *)realloc(path->open[list], (size_t)capacity*sizeof(unsigned int));
+
+        if (open == NULL) return false;
+
+        path->open[list] = open;
+        path->open_capacity[list] = capacity;
+    }
+
+    path->open[list][path->open_count[list]++] = cell;
+
+    return true;
+}
+
+// Find shortest path from start to goal (A*), path cells stored from start to goal
+// NOTE: With unit costs and manhattan heuristic, every step keeps f cost or increases it by 2,
+// so open list only needs two buckets (current f and next f) instead of a priority queue.
+// Current bucket is processed as a stack, expanding first the cells closer to goal
+static bool FindMazePath(MazePath *path)
+{
+    ClearMazePathCells(path);
+
+    if ((path->walkable == NULL) || (path->start < 0) || (path->goal < 0)) return false;
+    if (!MAZE_PATH_BIT_GET(path->walkable, path, path->start%path->width, path->start/path->width) ||
+        !MAZE_PATH_BIT_GET(path->walkable, path, path->goal%path->width, path->goal/path->width)) return false;
+    if (!LoadMazePathBuffers(path)) return false;
+
+    size_t word_count = (size_t)path->row_words*path->height;
+    memset(path->visited, 0, word_count*sizeof(unsigned long long));
+    memset(path->closed, 0, word_count*sizeof(unsigned long long));
+
+    const int width = path->width;
+    const int goal_x = path->goal%width;
+    const int goal_y = path->goal/width;
+    int current = 0;
+    bool found = false;
+
+    path->open_count[0] = 0;
+    path->open_count[1] = 0;
+    path->cost[path->start] = 0;
+    MAZE_PATH_BIT_SET(path->visited, path, path->start%width, path->start/width);
+    PushMazePathOpen(path, current, (unsigned int)path->start);
+
+    while ((path->open_count[0] > 0) || (path->open_count[1] > 0))
+    {
+        // Current f cost bucket exhausted, continue with next f cost
+        if (path->open_count[current] == 0) current = !current;
+
+        int cell = (int)path->open[current][--path->open_count[current]];
+        int x = cell%width;
+        int y = cell/width;
+
+        // Skip outdated entries, cell already expanded with a lower cost
+        if (MAZE_PATH_BIT_GET(path->closed, path, x, y)) continue;
+        MAZE_PATH_BIT_SET(path->closed, path, x, y);
+        path->stats.visited++;
+
+        if (cell == path->goal) { found = true; break; }
+
+        unsigned int g = path->cost[cell] + 1;
+
+        for (int dir = 0; dir < 4; dir++)
+        {
+            int nx = x + ((dir == 0)? 1 : (dir == 1)? -1 : 0);
+            int ny = y + ((dir == 2)? 1 : (dir == 3)? -1 : 0);
+
+            if ((nx < 0) || (nx >= width) || (ny < 0) || (ny >= path->height)) continue;
+            if (!MAZE_PATH_BIT_GET(path->walkable, path, nx, ny) || MAZE_PATH_BIT_GET(path->closed, path, nx, ny)) continue;
+
+            int next = ny*width + nx;
+
+            if (!MAZE_PATH_BIT_GET(path->visited, path, nx, ny) || (g < path->cost[next]))
+            {
+                MAZE_PATH_BIT_SET(path->visited, path, nx, ny);
+                path->cost[next] = g;
+                path->parent[next] = (unsigned char)dir;
+
+                // Moving towards goal keeps f cost, moving away increases it
+                bool closer = (abs(nx - goal_x) + abs(ny - goal_y)) < (abs(x - goal_x) + abs(y - goal_y));
+                if (!PushMazePathOpen(path, closer? current : !current, (unsigned int)next)) return false;
+            }
+        }
+    }
+
+    if (!found) return false;
+
+    // Walk parents back from goal, path length is goal cost plus start cell
+    int length = (int)path->cost[path->goal] + 1;
+    int *cells = (int *)realloc(path->cells, length*sizeof(int));
+
+    if (cells == NULL) return false;
+
+    const int offsets[4] = { 1, -1, width, -width };
+    int cell = path->goal;
+
+    path->cells = cells;
+    path->length = length;
+
+    for (int i = length - 1; i >= 0; i--)
+    {
+        path->cells[i] = cell;
+        MAZE_PATH_BIT_SET(path->on_path, path, cell%width, cell/width);
+        if (i > 0) cell -= offsets[path->parent[cell]];
+    }
+
+    return true;
+}
+
+// Clear current path cells
+static void ClearMazePathCells(MazePath *path)
+{
+    for (int i = 0; i < path->length; i++) MAZE_PATH_BIT_CLEAR(path->on_path, path, path->cells[i]%path->width, path->cells[i]/path->width);
+    path->length = 0;
+    path->stats.visited = 0;
+}
+
+#endif // MAZE_PATH_IMPLEMENTATION
@@ -0,0 +1,129 @@
+/*******************************************************************************************
+*
+*   maze_player - Player movement, collisions and cell interaction
+*
+*   Player update logic, independent of input devices and drawing: player is moved with
+*   an input state (game reads keyboard, benchmarks and replays provide scripted input)
+*   checking collisions through a walkable cells callback, so the same movement works
+*   over maze grid or endless maze chunks. Items pickup and goal detection update maze
+*   cells, items storage and dirty regions together
+*
+*   CONFIGURATION:
+*       #define MAZE_PLAYER_IMPLEMENTATION
+*           Generates the implementation of the module in the including file,
+*           only one translation unit should define it
+*
+*   DEPENDENCIES:
+*       maze_grid       - Maze cells data
+*       maze_items      - Items pickup
+*       maze_dirty      - Picked items cells marked as dirty
+*
+*   NOTE: Module is window-free and does not depend on raylib
+*
+*   Copyright (c) 2024-2025 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#ifndef MAZE_PLAYER_H
+#define MAZE_PLAYER_H
+
+#include "maze_grid.h"
+#include "maze_items.h"
+#include "maze_dirty.h"
+
+// Player input state, for current frame
+typedef struct MazePlayerInput {
+    bool up;
+    bool down;
+    bool left;
+    bool right;
+} MazePlayerInput;
+
+// Walkable cell check callback, used for player collisions
+typedef bool (*MazeWalkableFunc)(void *data, int x, int y);
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+// Move player position with input, checking collisions against walkable cells
+// NOTE: Position in world units, maze cell (0, 0) placed at origin, cells of scale size
+void MoveMazePlayer(float *x, float *y, MazePlayerInput input, float speed, float origin_x, float origin_y, float scale, MazeWalkableFunc walkable, void *data);
+
+// Process player standing on cell: item picked (cell set to floor and marked dirty, score increased)
+// and goal detection, returns true if an item was picked (cell changed)
+bool UpdateMazePlayerCell(MazeGrid *grid, MazeItems *items, MazeDirtyRegions *dirty, int x, int y, int *score, bool *won);
+
+bool IsMazeGridCellWalkable(void *grid, int x, int y);              // Walkable cell check callback for maze grid (data: MazeGrid *)
+int GetMazeWorldCell(float position, float origin, float scale);     // Get cell coordinate from world position (floor division)
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif // MAZE_PLAYER_H
+
+/***********************************************************************************
+*
+*   MAZE_PLAYER IMPLEMENTATION
+*
+************************************************************************************/
+
+#if defined(MAZE_PLAYER_IMPLEMENTATION) && !defined(MAZE_PLAYER_IMPLEMENTATION_DONE)
+#define MAZE_PLAYER_IMPLEMENTATION_DONE
+
+#include <math.h>       // Required for: floorf()
+
+// Move player position with input, checking collisions against walkable cells
+// NOTE: Every direction checks the cell the player position moves into, so player
+// slides along walls when moving diagonally
+void MoveMazePlayer(float *x, float *y, MazePlayerInput input, float speed, float origin_x, float origin_y, float scale, MazeWalkableFunc walkable, void *data)
+{
+    int cell_x = GetMazeWorldCell(*x, origin_x, scale);
+    int cell_y = GetMazeWorldCell(*y, origin_y, scale);
+    float move_x = 0.0f;
+    float move_y = 0.0f;
+
+    if (input.up && walkable(data, cell_x, GetMazeWorldCell(*y - speed, origin_y, scale))) move_y = -speed;
+    if (input.down && walkable(data, cell_x, GetMazeWorldCell(*y + speed, origin_y, scale))) move_y = speed;
+    if (input.left && walkable(data, GetMazeWorldCell(*x - speed, origin_x, scale), cell_y)) move_x = -speed;
+    if (input.right && walkable(data, GetMazeWorldCell(*x + speed, origin_x, scale), cell_y)) move_x = speed;
+
+    *x += move_x;
+    *y += move_y;
+}
+
+// Process player standing on cell: item picked (cell set to floor and marked dirty, score increased) and goal detection
+bool UpdateMazePlayerCell(MazeGrid *grid, MazeItems *items, MazeDirtyRegions *dirty, int x, int y, int *score, bool *won)
+{
+    bool picked = false;
+    int cell = GetMazeCell(*grid, x, y);
+
+    if (cell == MAZE_CELL_GOAL) *won = true;
+    else if (cell == MAZE_CELL_ITEM)
+    {
+        // NOTE: Item type lookup by cell, no items list traversal required
+        MazeItemHandle item = GetMazeItemAt(items, x, y);
+        *score += GetMazeItemScore(GetMazeItemType(items, item));
+        RemoveMazeItem(items, item);
+
+        picked = SetMazeCell(grid, x, y, MAZE_CELL_FLOOR);
+        if (dirty != NULL) MarkMazeCellDirty(dirty, x, y);
+    }
+
+    return picked;
+}
+
+// Walkable cell check callback for maze grid
+bool IsMazeGridCellWalkable(void *grid, int x, int y)
+{
+    return IsMazeCellWalkable(*(MazeGrid *)grid, x, y);
+}
+
+// Get cell coordinate from world position (floor division)
+int GetMazeWorldCell(float position, float origin, float scale)
+{
+    return (int)floorf((position - origin)/scale);
+}
+
+#endif // MAZE_PLAYER_IMPLEMENTATION
@@ -0,0 +1,308 @@
+/*******************************************************************************************
+*
+*   maze_pregen - Background maze pre-generation, next maze ready before it is required
+*
+*   Next maze (algorithm, seed and generation parameters) is requested in advance and
+*   generated on a background thread, optionally followed by a prepare callback run on the
+*   same thread (i.e. building maze image), so switching maze only takes the ready result.
+*   One request is kept at most: a new request replaces the pending one, and results not
+*   matching the taken request are discarded
+*
+*   Optionally, mazes are looked up in a maze cache before generating and saved to it once
+*   generated, cache is only used from the generation thread once it is started
+*
+*   CONFIGURATION:
+*       #define MAZE_PREGEN_IMPLEMENTATION
+*           Generates the implementation of the module in the including file,
+*           only one translation unit should define it
+*
+*   DEPENDENCIES:
+*       maze_grid       - Maze cells data
+*       maze_gen        - Random generator state
+*       maze_algo       - Generation algorithms
+*       maze_system     - Background generation thread
+*       maze_cache      - Generated mazes cache (optional)
+*
+*   NOTE: Module is window-free and does not depend on raylib
+*
+*   Copyright (c) 2024-2025 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#ifndef MAZE_PREGEN_H
+#define MAZE_PREGEN_H
+
+#include "maze_grid.h"
+#include "maze_gen.h"
+#include "maze_algo.h"
+#include "maze_system.h"
+#include "maze_cache.h"
+
+// Maze pre-generation request, identifies generated maze
+typedef struct MazePregenRequest {
+    int algorithm;              // Generation algorithm (MazeAlgorithm)
+    unsigned int seed;          // Generation seed
+    int width;                  // Maze width
+    int height;                 // Maze height
+    int spacing_rows;           // Maze points spacing, rows
+    int spacing_cols;           // Maze points spacing, columns
+    float point_chance;         // Maze point chance
+} MazePregenRequest;
+
+// Maze pre-generation result, owned by caller once taken
+typedef struct MazePregenResult {
+    MazePregenRequest request;  // Request generated
+    MazeGrid grid;              // Generated maze cells
+    MazeGenStats stats;         // Generation statistics (only time if loaded from cache)
+    bool cached;                // Maze loaded from cache, not generated
+    void *prepared;             // Prepare callback result (NULL if no callback)
+} MazePregenResult;
+
+typedef void *(*MazePregenPrepareFunc)(MazeGrid grid);              // Prepare generated maze data on background thread
+typedef void (*MazePregenReleaseFunc)(void *prepared);              // Release prepared data of discarded results
+
+// Maze pre-generation state
+typedef struct MazePregen {
+    MazePregenPrepareFunc prepare;  // Prepare callback, run after generation
+    MazePregenReleaseFunc release;  // Release callback, for discarded results
+    MazeCache *cache;               // Generated mazes cache (optional), used by generation thread
+
+    // Background generation, request and result protected by mutex
+    MazeThread *thread;
+    MazeMutex *mutex;
+    MazeCondition *work_ready;
+    MazePregenRequest request;      // Pending request
+    bool requested;                 // Pending request not taken by worker yet
+    bool working;                   // Worker generating a request
+    MazePregenResult result;        // Last generated result
+    bool ready;                     // Result available
+    bool quit;
+
+    int generated;                  // Mazes generated since loading
+    int discarded;                  // Results discarded (not matching taken request)
+} MazePregen;
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+MazePregen LoadMazePregen(MazeCache *cache, MazePregenPrepareFunc prepare, MazePregenReleaseFunc release); // Load maze pre-generation, cache and callbacks optional
+void UnloadMazePregen(MazePregen *pregen);                          // Unload maze pre-generation, stopping generation thread
+void RequestMazePregen(MazePregen *pregen, MazePregenRequest request); // Request maze generation in background, replacing pending request
+bool TakeMazePregen(MazePregen *pregen, MazePregenRequest request, MazePregenResult *result); // Take result if request already generated, false otherwise
+void UnloadMazePregenResult(MazePregen *pregen, MazePregenResult *result); // Unload result not used (grid and prepared data)
+bool IsMazePregenRequestEqual(MazePregenRequest a, MazePregenRequest b); // Check requests generate the same maze
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif // MAZE_PREGEN_H
+
+/***********************************************************************************
+*
+*   MAZE_PREGEN IMPLEMENTATION
+*
+************************************************************************************/
+
+#if defined(MAZE_PREGEN_IMPLEMENTATION) && !defined(MAZE_PREGEN_IMPLEMENTATION_DONE)
+#define MAZE_PREGEN_IMPLEMENTATION_DONE
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Declaration
+//----------------------------------------------------------------------------------
+static void MazePregenWorker(void *data);                           // Background generation thread, processes pending request
+static MazePregenResult GenMazePregenResult(const MazePregen *pregen, MazePregenRequest request); // Generate (or load cached) and prepare maze for request
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+
+// Load maze pre-generation, cache and callbacks optional
+// NOTE: Generation thread started on first request, cache must not be used by other threads after that
+MazePregen LoadMazePregen(MazeCache *cache, MazePregenPrepareFunc prepare, MazePregenReleaseFunc release)
+{
+    MazePregen pregen = { 0 };
+
+    pregen.cache = cache;
+    pregen.prepare = prepare;
+    pregen.release = release;
+    pregen.mutex = LoadMazeMutex();
+    pregen.work_ready = LoadMazeCondition();
+
+    return pregen;
+}
+
+// Unload maze pre-generation, stopping generation thread
+// NOTE: Waits for maze being generated, if any
+void UnloadMazePregen(MazePregen *pregen)
+{
+    if (pregen->thread != NULL)
+    {
+        LockMazeMutex(pregen->mutex);
+        pregen->quit = true;
+        BroadcastMazeCondition(pregen->work_ready);
+        UnlockMazeMutex(pregen->mutex);
+
+        JoinMazeThread(pregen->thread);
+    }
+
+    if (pregen->ready) UnloadMazePregenResult(pregen, &pregen->result);
+
+    UnloadMazeCondition(pregen->work_ready);
+    UnloadMazeMutex(pregen->mutex);
+
+    *pregen = (MazePregen){ 0 };
+}
+
+// Request maze generation in background, replacing pending request
+// NOTE: Nothing requested if same maze is already generated or being generated
+void RequestMazePregen(MazePregen *pregen, MazePregenRequest request)
+{
+    if (pregen->mutex == NULL) return;
+
+#if !defined(MAZE_SYSTEM_NO_THREADS)
+    if (pregen->thread == NULL) pregen->thread = StartMazeThread(MazePregenWorker, pregen);
+#endif
+
+    if (pregen->thread != NULL) LockMazeMutex(pregen->mutex);
+
+    bool generated = (pregen->ready && IsMazePregenRequestEqual(pregen->result.request, request)) ||
+                     ((pregen->working || pregen->requested) && IsMazePregenRequestEqual(pregen->request, request));
+
+    if (!generated)
+    {
+        pregen->request = request;
+        pregen->requested = true;
+
+        if (pregen->thread != NULL) SignalMazeCondition(pregen->work_ready);
+    }
+
+    if (pregen->thread != NULL) UnlockMazeMutex(pregen->mutex);
+}
+
+// Take result if request already generated, false otherwise
+// NOTE: Without generation thread, pending request is generated on this call
+bool TakeMazePregen(MazePregen *pregen, MazePregenRequest request, MazePregenResult *result)
+{
+    if (pregen->mutex == NULL) return false;
+
+    if (pregen->thread == NULL)
+    {
+        if (!pregen->requested) return false;
+
+        if (pregen->ready) UnloadMazePregenResult(pregen, &pregen->result);
+
+        pregen->result = GenMazePregenResult(pregen, pregen->request);
+        pregen->requested = false;
+        pregen->ready = true;
+        pregen->generated++;
+    }
+    else LockMazeMutex(pregen->mutex);
+
+    bool taken = false;
+
+    if (pregen->ready && IsMazePregenRequestEqual(pregen->result.request, request))
+    {
+        *result = pregen->result;
+        pregen->result = (MazePregenResult){ 0 };
+        pregen->ready = false;
+        taken = true;
+    }
+
+    if (pregen->thread != NULL) UnlockMazeMutex(pregen->mutex);
+
+    return taken;
+}
+
+// Unload result not used (grid and prepared data)
+void UnloadMazePregenResult(MazePregen *pregen, MazePregenResult *result)
+{
+    UnloadMazeGrid(result->grid);
+    if ((result->prepared != NULL) && (pregen->release != NULL)) pregen->release(result->prepared);
+
+    *result = (MazePregenResult){ 0 };
+}
+
+// Check requests generate the same maze
+bool IsMazePregenRequestEqual(MazePregenRequest a, MazePregenRequest b)
+{
+    return (a.algorithm == b.algorithm) && (a.seed == b.seed) && (a.width == b.width) && (a.height == b.height) &&
+           (a.spacing_rows == b.spacing_rows) && (a.spacing_cols == b.spacing_cols) && (a.point_chance == b.point_chance);
+}
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Definition
+//----------------------------------------------------------------------------------
+
+// Background generation thread, processes pending request
+// NOTE: Only last request is generated, previous result discarded when replaced
+static void MazePregenWorker(void *data)
+{
+    MazePregen *pregen = (MazePregen *)data;
+
+    LockMazeMutex(pregen->mutex);
+
+    while (true)
+    {
+        while (!pregen->quit && !pregen->requested) WaitMazeCondition(pregen->work_ready, pregen->mutex);
+
+        if (pregen->quit) break;
+
+        MazePregenRequest request = pregen->request;
+        pregen->requested = false;
+        pregen->working = true;
+
+        // Maze generated without holding the lock, main thread keeps running
+        UnlockMazeMutex(pregen->mutex);
+        MazePregenResult result = GenMazePregenResult(pregen, request);
+        LockMazeMutex(pregen->mutex);
+
+        if (pregen->ready)
+        {
+            UnloadMazePregenResult(pregen, &pregen->result);
+            pregen->discarded++;
+        }
+
+        pregen->result = result;
+        pregen->ready = true;
+        pregen->working = false;
+        pregen->generated++;
+    }
+
+    UnlockMazeMutex(pregen->mutex);
+}
+
+// Generate (or load cached) and prepare maze for request
+// NOTE: Maze uses its own random state, seeded same way than the game
+static MazePregenResult GenMazePregenResult(const MazePregen *pregen, MazePregenRequest request)
+{
+    MazePregenResult result = { 0 };
+    MazeCacheKey key = { request.algorithm, request.seed, request.width, request.height, request.spacing_rows, request.spacing_cols, request.point_chance };
+
+    result.request = request;
+
+    if (pregen->cache != NULL)
+    {
+        result.grid = LoadMazeCacheGrid(pregen->cache, key);
+        result.cached = (result.grid.cells != NULL);
+        if (result.cached) result.stats.time = pregen->cache->stats.time;
+    }
+
+    if (!result.cached)
+    {
+        MazeRandom rng = { 0 };
+        SetMazeRandomSeed(&rng, request.seed);
+
+        result.grid = GenMazeGridAlgorithm(request.algorithm, request.width, request.height, request.spacing_rows,
+            request.spacing_cols, request.point_chance, &rng, &result.stats);
+
+        if (pregen->cache != NULL) SaveMazeCacheGrid(pregen->cache, key, result.grid);
+    }
+
+    if ((result.grid.cells != NULL) && (pregen->prepare != NULL)) result.prepared = pregen->prepare(result.grid);
+
+    return result;
+}
+
+#endif // MAZE_PREGEN_IMPLEMENTATION
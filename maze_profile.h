@@ -0,0 +1,350 @@
+/*******************************************************************************************
+*
+*   maze_profile - Frame profiler: phase timers, frame counters and trace export
+*
+*   Every frame is split in phases (timed with Begin/End pairs, same way than drawing modes)
+*   and per-frame counters (estimated draw calls, uploaded bytes, heap allocations). Last frames are
+*   kept in a ring buffer, so they can be displayed (i.e. as an overlay graph) or exported
+*   to a Chrome trace file (chrome://tracing, ui.perfetto.dev) or a CSV file
+*
+*   Draw calls are not measured (raylib flushes its render batch internally), callers add
+*   the draw calls their renderers estimate from batching rules
+*
+*   CONFIGURATION:
+*       #define MAZE_PROFILE_IMPLEMENTATION
+*           Generates the implementation of the module in the including file,
+*           only one translation unit should define it
+*
+*       #define MAZE_PROFILE_TRACK_ALLOCATIONS
+*           Heap allocations (malloc(), calloc(), realloc()) are counted for all code after
+*           this module inclusion in the translation unit, including other maze modules
+*           implementation (include this module first). Allocations of other translation
+*           units and libraries (i.e. raylib textures, meshes and file loading) are not counted
+*
+*   DEPENDENCIES:
+*       maze_system     - Timing (GetMazeTime())
+*
+*   NOTE: Module is window-free and does not depend on raylib
+*
+*   Copyright (c) 2024-2025 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#ifndef MAZE_PROFILE_H
+#define MAZE_PROFILE_H
+
+#include <stdbool.h>    // Required for: bool
+#include <stdlib.h>     // Required for: malloc(), calloc(), realloc() [Before allocations tracking macros]
+
+#include "maze_system.h"
+
+#define MAZE_PROFILE_MAX_PHASES     16      // Maximum phases per frame
+
+// Profiler frame counters
+typedef enum {
+    MAZE_PROFILE_DRAW_CALLS_EST = 0, // Draw calls estimated by renderers (not measured)
+    MAZE_PROFILE_UPLOAD_BYTES,      // Texture bytes uploaded
+    MAZE_PROFILE_ALLOCATIONS,       // Heap allocations of tracking translation unit only (requires MAZE_PROFILE_TRACK_ALLOCATIONS)
+    MAZE_PROFILE_COUNTER_COUNT
+} MazeProfileCounter;
+
+// Profiler frame
+typedef struct MazeProfileFrame {
+    unsigned int index;                             // Frame number
+    double start;                                   // Frame start time, in seconds
+    float time;                                     // Frame time, in milliseconds
+    float phase_start[MAZE_PROFILE_MAX_PHASES];     // Phase first begin, in milliseconds from frame start
+    float phase_time[MAZE_PROFILE_MAX_PHASES];      // Phase time, in milliseconds (all phase begin/end pairs)
+    int counters[MAZE_PROFILE_COUNTER_COUNT];       // Frame counters
+} MazeProfileFrame;
+
+// Frame profiler
+typedef struct MazeProfiler {
+    const char **phase_names;   // Phases names (not copied)
+    int phase_count;            // Number of phases
+
+    MazeProfileFrame *frames;   // Frames ring buffer
+    int capacity;               // Frames ring buffer size
+    int count;                  // Frames completed (up to capacity)
+    int next;                   // Ring buffer position for next completed frame
+
+    MazeProfileFrame current;   // Frame in progress
+    double phase_begin[MAZE_PROFILE_MAX_PHASES]; // Phases begin time, for phases in progress
+    unsigned int allocations;   // Allocations count at frame begin
+    unsigned int frame_count;   // Frames begun
+} MazeProfiler;
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+MazeProfiler LoadMazeProfiler(const char **phase_names, int phase_count, int frames); // Load profiler, keeping last frames
+void UnloadMazeProfiler(MazeProfiler *profiler);                    // Unload profiler
+
+void BeginMazeProfileFrame(MazeProfiler *profiler);                 // Begin profiling frame
+void EndMazeProfileFrame(MazeProfiler *profiler);                   // End profiling frame, frame added to ring buffer
+void BeginMazeProfilePhase(MazeProfiler *profiler, int phase);      // Begin timing phase
+void EndMazeProfilePhase(MazeProfiler *profiler, int phase);        // End timing phase, time added to frame phase time
+void AddMazeProfileCounter(MazeProfiler *profiler, int counter, int value); // Add value to current frame counter
+
+const MazeProfileFrame *GetMazeProfileFrame(const MazeProfiler *profiler, int age); // Get completed frame (0 = last one), NULL if not available
+MazeProfileFrame GetMazeProfileAverage(const MazeProfiler *profiler); // Get average of completed frames
+
+bool ExportMazeProfileTrace(const MazeProfiler *profiler, const char *fileName); // Export completed frames as Chrome trace (JSON)
+bool ExportMazeProfileCSV(const MazeProfiler *profiler, const char *fileName);   // Export completed frames as CSV, one frame per line
+
+unsigned int GetMazeProfileAllocations(void);                       // Get heap allocations counted since program start
+void *TrackMazeProfileAllocation(void *ptr);                        // Count heap allocation, returns same pointer
+
+#if defined(__cplusplus)
+}
+#endif
+
+// Heap allocations tracking, calls replaced for code after this point
+// NOTE: Macros are not expanded recursively, malloc() inside the macro is the library function
+#if defined(MAZE_PROFILE_TRACK_ALLOCATIONS)
+    #define malloc(size) TrackMazeProfileAllocation(malloc(size))
+    #define calloc(count, size) TrackMazeProfileAllocation(calloc(count, size))
+    #define realloc(ptr, size) TrackMazeProfileAllocation(realloc(ptr, size))
+#endif
+
+#endif // MAZE_PROFILE_H
+
+/***********************************************************************************
+*
+*   MAZE_PROFILE IMPLEMENTATION
+*
+************************************************************************************/
+
+#if defined(MAZE_PROFILE_IMPLEMENTATION) && !defined(MAZE_PROFILE_IMPLEMENTATION_DONE)
+#define MAZE_PROFILE_IMPLEMENTATION_DONE
+
+#include <stdio.h>      // Required for: FILE, fopen(), fprintf(), fclose()
+
+//----------------------------------------------------------------------------------
+// Global Variables Definition
+//----------------------------------------------------------------------------------
+static volatile unsigned int maze_profile_allocations = 0;         // Heap allocations counted, all threads
+
+// Counters names and scope notes, used on export
+static const char *maze_profile_counter_names[MAZE_PROFILE_COUNTER_COUNT] = { "draw_calls_est", "upload_bytes", "allocations_tu" };
+static const char *maze_profile_counter_notes[MAZE_PROFILE_COUNTER_COUNT] = {
+    "Draw calls estimated by maze renderers from batching rules, not measured",
+    "Texture bytes uploaded",
+    "Heap allocations counted only in the translation unit tracking them (maze modules), raylib allocations not counted"
+};
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+
+// Load profiler, keeping last frames
+MazeProfiler LoadMazeProfiler(const char **phase_names, int phase_count, int frames)
+{
+    MazeProfiler profiler = { 0 };
+
+    if ((phase_count <= 0) || (phase_count > MAZE_PROFILE_MAX_PHASES) || (frames <= 0)) return profiler;
+
+    profiler.frames = (MazeProfileFrame *)calloc(frames, sizeof(MazeProfileFrame));
+
+    if (profiler.frames != NULL)
+    {
+        profiler.phase_names = phase_names;
+        profiler.phase_count = phase_count;
+        profiler.capacity = frames;
+    }
+
+    return profiler;
+}
+
+// Unload profiler
+void UnloadMazeProfiler(MazeProfiler *profiler)
+{
+    free(profiler->frames);
+
+    *profiler = (MazeProfiler){ 0 };
+}
+
+// Begin profiling frame
+void BeginMazeProfileFrame(MazeProfiler *profiler)
+{
+    profiler->current = (MazeProfileFrame){ 0 };
+    profiler->current.index = profiler->frame_count++;
+    profiler->current.start = GetMazeTime();
+    profiler->allocations = GetMazeProfileAllocations();
+
+    for (int i = 0; i < MAZE_PROFILE_MAX_PHASES; i++) profiler->current.phase_start[i] = -1.0f;
+}
+
+// End profiling frame, frame added to ring buffer
+void EndMazeProfileFrame(MazeProfiler *profiler)
+{
+    if (profiler->frames == NULL) return;
+
+    profiler->current.time = (float)((GetMazeTime() - profiler->current.start)*1000.0);
+    profiler->current.counters[MAZE_PROFILE_ALLOCATIONS] = (int)(GetMazeProfileAllocations() - profiler->allocations);
+
+    profiler->frames[profiler->next] = profiler->current;
+    profiler->next = (profiler->next + 1)%profiler->capacity;
+    if (profiler->count < profiler->capacity) profiler->count++;
+}
+
+// Begin timing phase
+void BeginMazeProfilePhase(MazeProfiler *profiler, int phase)
+{
+    if ((phase < 0) || (phase >= profiler->phase_count)) return;
+
+    double time = GetMazeTime();
+
+    profiler->phase_begin[phase] = time;
+    if (profiler->current.phase_start[phase] < 0.0f) profiler->current.phase_start[phase] = (float)((time - profiler->current.start)*1000.0);
+}
+
+// End timing phase, time added to frame phase time
+void EndMazeProfilePhase(MazeProfiler *profiler, int phase)
+{
+    if ((phase < 0) || (phase >= profiler->phase_count)) return;
+
+    profiler->current.phase_time[phase] += (float)((GetMazeTime() - profiler->phase_begin[phase])*1000.0);
+}
+
+// Add value to current frame counter
+void AddMazeProfileCounter(MazeProfiler *profiler, int counter, int value)
+{
+    if ((counter >= 0) && (counter < MAZE_PROFILE_COUNTER_COUNT)) profiler->current.counters[counter] += value;
+}
+
+// Get completed frame (0 = last one), NULL if not available
+const MazeProfileFrame *GetMazeProfileFrame(const MazeProfiler *profiler, int age)
+{
+    if ((age < 0) || (age >= profiler->count)) return NULL;
+
+    return &profiler->frames[(profiler->next - 1 - age + profiler->capacity)%profiler->capacity];
+}
+
+// Get average of completed frames
+MazeProfileFrame GetMazeProfileAverage(const MazeProfiler *profiler)
+{
+    MazeProfileFrame average = { 0 };
+    double phase_time[MAZE_PROFILE_MAX_PHASES] = { 0 };
+    double counters[MAZE_PROFILE_COUNTER_COUNT] = { 0 };
+    double time = 0.0;
+
+    if (profiler->count == 0) return average;
+
+    for (int i = 0; i < profiler->count; i++)
+    {
+        const MazeProfileFrame *frame = &profiler->frames[i];
+
+        time += frame->time;
+        for (int p = 0; p < profiler->phase_count; p++) phase_time[p] += frame->phase_time[p];
+        for (int c = 0; c < MAZE_PROFILE_COUNTER_COUNT; c++) counters[c] += frame->counters[c];
+    }
+
+    average.index = GetMazeProfileFrame(profiler, 0)->index;
+    average.time = (float)(time/profiler->count);
+    for (int p = 0; p < profiler->phase_count; p++) average.phase_time[p] = (float)(phase_time[p]/profiler->count);
+    for (int c = 0; c < MAZE_PROFILE_COUNTER_COUNT; c++) average.counters[c] = (int)(counters[c]/profiler->count + 0.5);
+
+    return average;
+}
+
+// Export completed frames as Chrome trace (JSON)
+// NOTE: Phases exported as complete events ("X"), counters as counter events ("C"), time in microseconds,
+// counters scope notes exported as trace metadata ("otherData")
+bool ExportMazeProfileTrace(const MazeProfiler *profiler, const char *fileName)
+{
+    FILE *file = fopen(fileName, "wt");
+
+    if (file == NULL) return false;
+
+    const MazeProfileFrame *first = GetMazeProfileFrame(profiler, profiler->count - 1);
+    double origin = (first != NULL)? first->start : 0.0;
+    bool separator = false;
+
+    fprintf(file, "{\"traceEvents\":[\n");
+
+    for (int age = profiler->count - 1; age >= 0; age--)
+    {
+        const MazeProfileFrame *frame = GetMazeProfileFrame(profiler, age);
+        double start = (frame->start - origin)*1000000.0;
+
+        fprintf(file, "%s{\"name\":\"frame\",\"cat\":\"frame\",\"ph\":\"X\",\"pid\":1,\"tid\":1,\"ts\":%.3f,\"dur\":%.3f,\"args\":{\"index\":%u}}",
+            separator? ",\n" : "", start, frame->time*1000.0, frame->index);
+        separator = true;
+
+        for (int p = 0; p < profiler->phase_count; p++)
+        {
+            if (frame->phase_start[p] < 0.0f) continue;
+
+            // NOTE: Phases begun multiple times in a frame are exported as a single event
+            fprintf(file, ",\n{\"name\":\"%s\",\"cat\":\"phase\",\"ph\":\"X\",\"pid\":1,\"tid\":1,\"ts\":%.3f,\"dur\":%.3f}",
+                profiler->phase_names[p], start + frame->phase_start[p]*1000.0, frame->phase_time[p]*1000.0);
+        }
+
+        for (int c = 0; c < MAZE_PROFILE_COUNTER_COUNT; c++)
+        {
+            fprintf(file, ",\n{\"name\":\"%s\",\"ph\":\"C\",\"pid\":1,\"ts\":%.3f,\"args\":{\"value\":%i}}",
+                maze_profile_counter_names[c], start, frame->counters[c]);
+        }
+    }
+
+    fprintf(file, "\n],\"displayTimeUnit\":\"ms\",\"otherData\":{");
+    for (int c = 0; c < MAZE_PROFILE_COUNTER_COUNT; c++) fprintf(file, "%s\"%s\":\"%s\"", (c > 0)? "," : "", maze_profile_counter_names[c], maze_profile_counter_notes[c]);
+    fprintf(file, "}}\n");
+
+    return (fclose(file) == 0);
+}
+
+// Export completed frames as CSV, one frame per line
+bool ExportMazeProfileCSV(const MazeProfiler *profiler, const char *fileName)
+{
+    FILE *file = fopen(fileName, "wt");
+
+    if (file == NULL) return false;
+
+    fprintf(file, "frame,frame_ms");
+    for (int p = 0; p < profiler->phase_count; p++) fprintf(file, ",%s_ms", profiler->phase_names[p]);
+    for (int c = 0; c < MAZE_PROFILE_COUNTER_COUNT; c++) fprintf(file, ",%s", maze_profile_counter_names[c]);
+    fprintf(file, "\n");
+
+    for (int age = profiler->count - 1; age >= 0; age--)
+    {
+        const MazeProfileFrame *frame = GetMazeProfileFrame(profiler, age);
+
+        fprintf(file, "%u,%.4f", frame->index, frame->time);
+        for (int p = 0; p < profiler->phase_count; p++) fprintf(file, ",%.4f", frame->phase_time[p]);
+        for (int c = 0; c < MAZE_PROFILE_COUNTER_COUNT; c++) fprintf(file, ",%i", frame->counters[c]);
+        fprintf(file, "\n");
+    }
+
+    return (fclose(file) == 0);
+}
+
+// Get heap allocations counted since program start
+unsigned int GetMazeProfileAllocations(void)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return __atomic_load_n(&maze_profile_allocations, __ATOMIC_RELAXED);
+#else
+    return maze_profile_allocations;
+#endif
+}
+
+// Count heap allocation, returns same pointer
+// NOTE: Allocations can happen on any thread (i.e. endless maze generation), counter updated atomically
+void *TrackMazeProfileAllocation(void *ptr)
+{
+    if (ptr != NULL)
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        __atomic_fetch_add(&maze_profile_allocations, 1, __ATOMIC_RELAXED);
+#else
+        maze_profile_allocations++;
+#endif
+    }
+
+    return ptr;
+}
+
+#endif // MAZE_PROFILE_IMPLEMENTATION
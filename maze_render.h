@@ -0,0 +1,700 @@
+/*******************************************************************************************
+*
+*   maze_render - View-culled, batched maze tiles renderer
+*
+*   Maze tiles are drawn only for the cells visible through the 2d camera, reading cell
+*   tiles from maze tiles map (no image pixels decoding) and emitting all tiles as a single
+*   quads stream with the biomes atlas bound once
+*
+*   Biomes atlas packs all biome textures into one texture at load time, one block of tiles
+*   per biome (same layout for all biomes), so changing biome only changes a texture
+*   coordinates offset. Every source biome texture provides a wall and a floor quad,
+*   16 wall tiles are generated from wall quad for all wall neighbours combinations
+*   (autotiling): wall borders are removed on sides joined to other walls
+*
+*   Maze tiles map keeps the atlas tile of every cell, computed on generation and updated
+*   only for edited cells (and their neighbours), no neighbour checks happen on drawing
+*
+*   Zoomed out views use a level of detail based on cells size on screen: below a tile size
+*   (cells too small for atlas tiles) the maze overview is drawn as a single quad, so drawing
+*   cost does not depend on cells visible. Both levels are cross-faded over a cells size range,
+*   no popping while zooming
+*
+*   Maze overview texture keeps cells packed at 2 bits per cell (4 cells per byte, same rows
+*   layout than maze files), so maze files cells are uploaded as they are and a 16384x16384
+*   maze takes 64 MB of VRAM (1 GB as RGBA texture). Overview shader looks up cell types colors
+*   (palette); texels are not colors, so no mipmaps: minification is filtered in shader,
+*   averaging 4 palette lookups spread over the pixel footprint. Overview shader can also draw
+*   one byte per cell textures holding cell types (tilemap cells), no overview texture required
+*
+*   CONFIGURATION:
+*       #define MAZE_RENDER_IMPLEMENTATION
+*           Generates the implementation of the module in the including file,
+*           only one translation unit should define it
+*
+*   DEPENDENCIES:
+*       raylib, rlgl    - Textures, shaders, camera and render batch access
+*       maze_grid       - Maze cells data
+*       maze_file       - Maze cells packing (overview texture)
+*
+*   Copyright (c) 2024-2025 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#ifndef MAZE_RENDER_H
+#define MAZE_RENDER_H
+
+#include "raylib.h"
+#include "maze_grid.h"
+
+#define MAZE_ATLAS_COLUMNS          16      // Biomes atlas tiles per row
+#define MAZE_ATLAS_BIOME_ROWS       2       // Biomes atlas tiles rows per biome
+
+// Biomes atlas tiles, index in biome tiles block (column + row*MAZE_ATLAS_COLUMNS)
+// NOTE: Wall tiles 0..15 are indexed by wall neighbours mask
+typedef enum {
+    MAZE_ATLAS_TILE_WALL = 0,               // Wall without wall neighbours, first of 16 wall tiles
+    MAZE_ATLAS_TILE_FLOOR = 16,             // Floor
+    MAZE_ATLAS_TILE_SIDE_A,                 // Source texture top-left quad (walls side)
+    MAZE_ATLAS_TILE_SIDE_B,                 // Source texture top-right quad (walls side)
+    MAZE_ATLAS_TILE_COUNT
+} MazeAtlasTile;
+
+// Wall neighbours mask bits
+typedef enum {
+    MAZE_WALL_NORTH = 1,
+    MAZE_WALL_EAST = 2,
+    MAZE_WALL_SOUTH = 4,
+    MAZE_WALL_WEST = 8
+} MazeWallNeighbour;
+
+// Biomes atlas, all biomes tiles packed into one texture
+typedef struct MazeAtlas {
+    Texture2D texture;          // Packed atlas texture
+    int tile_size;              // Tile size in pixels
+    int biome_count;            // Number of biomes packed
+    unsigned char tiles[32];    // Cell tile lookup table, indexed by (wall << 4) | wall neighbours mask
+} MazeAtlas;
+
+// Maze tiles map, atlas tile of every maze cell
+typedef struct MazeTiles {
+    int width;                  // Map width in cells
+    int height;                 // Map height in cells
+    unsigned char *tiles;       // Cells atlas tile (MazeAtlasTile)
+} MazeTiles;
+
+// Maze cells range visible on screen, limits inclusive
+typedef struct MazeViewRange {
+    int min_x;
+    int min_y;
+    int max_x;
+    int max_y;
+} MazeViewRange;
+
+// Maze overview, cells drawn with cell types colors (palette) from packed cells texture
+typedef struct MazeOverview {
+    int width;                  // Maze width in cells
+    int height;                 // Maze height in cells
+    Texture2D texture;          // Packed cells texture, 4 cells per byte (PIXELFORMAT_UNCOMPRESSED_GRAYSCALE)
+    Color palette[4];           // Cell types colors (MazeCellType)
+
+    Shader shader;              // Overview shader, cell types colors looked up per pixel
+    int size_loc;               // Shader location: maze size in cells
+    int texture_size_loc;       // Shader location: cells texture size in texels
+    int layout_loc;             // Shader location: cells per texel and cell type bits shift
+    int palette_loc;            // Shader location: cell types colors
+    int spread_loc;             // Shader location: samples offset from pixel center (cells)
+
+    unsigned char *staging;     // Packed area upload buffer
+    int staging_size;           // Upload buffer size in bytes
+} MazeOverview;
+
+// Maze rendering statistics, per frame
+typedef struct MazeRenderStats {
+    int visible_tiles;      // Number of tiles emitted
+    int draw_calls;         // Number of draw calls required by emitted tiles
+} MazeRenderStats;
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+// Get maze cells visible on screen for provided camera, maze drawn at position with scale (cell size)
+// NOTE: Returned range is empty (min > max) if maze is out of view
+MazeViewRange GetMazeViewRange(MazeGrid grid, Camera2D camera, Vector2 position, float scale);
+
+// Biomes atlas loading, source textures quads: bottom-left: wall, bottom-right: floor, top: walls side
+MazeAtlas LoadMazeAtlas(const char **fileNames, int count, int tile_size); // Load biomes atlas packing all biome textures
+Image GenImageMazeAtlas(const char **fileNames, int count, int tile_size); // Generate biomes atlas image (CPU only, can run on any thread)
+MazeAtlas LoadMazeAtlasFromImage(Image image, int count, int tile_size); // Load biomes atlas from atlas image (texture upload)
+void UnloadMazeAtlas(MazeAtlas *atlas);                             // Unload biomes atlas texture
+Rectangle GetMazeAtlasTileRec(MazeAtlas atlas, int biome, int tile); // Get biome tile rectangle in atlas texture (pixels)
+
+// Maze tiles map, cells tiles computed using atlas lookup table
+MazeTiles LoadMazeTiles(MazeGrid grid, MazeAtlas atlas);            // Load maze tiles map, all cells tiles computed
+void UnloadMazeTiles(MazeTiles *tiles);                             // Unload maze tiles map
+void UpdateMazeTiles(MazeTiles *tiles, MazeGrid grid, MazeAtlas atlas, int x, int y, int width, int height); // Update cells area tiles (and area neighbours)
+
+// Draw maze visible tiles using biome tiles from atlas
+// NOTE: Must be called inside BeginMode2D(camera)
+MazeRenderStats DrawMazeTiles(MazeTiles tiles, MazeAtlas atlas, int biome, Camera2D camera, Vector2 position, float scale);
+
+// Maze level of detail, packed cells overview used for zoomed out views
+MazeOverview LoadMazeOverview(const Color *palette);                // Load overview shader (no cells texture), palette: one color per MazeCellType
+void UnloadMazeOverview(MazeOverview *overview);                    // Unload overview cells texture, shader and upload buffer
+void ResetMazeOverview(MazeOverview *overview, int width, int height, const unsigned char *packed); // Reset cells texture for maze size, packed rows (maze file layout) can be NULL
+int UpdateMazeOverview(MazeOverview *overview, MazeGrid grid, int x, int y, int width, int height); // Update cells area from grid, returns bytes uploaded
+float GetMazeLodBlend(Camera2D camera, float scale, float fade_start, float fade_end); // Get overview blend for cells size on screen: 0.0f tiles only, 1.0f overview only
+int DrawMazeOverview(MazeOverview overview, Camera2D camera, Vector2 position, float scale, float blend); // Draw overview faded in by blend (one quad), returns draw calls
+int DrawMazeOverviewTexture(MazeOverview overview, Texture2D cells, int type_shift, Camera2D camera, Vector2 position, float scale, float blend); // Draw overview from one byte per cell texture (cell type bits at type_shift)
+MazeRenderStats DrawMazeLod(MazeTiles tiles, MazeAtlas atlas, int biome, MazeOverview overview, Camera2D camera, Vector2 position, float scale, float blend); // Draw maze tiles and/or overview for blend
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif // MAZE_RENDER_H
+
+/***********************************************************************************
+*
+*   MAZE_RENDER IMPLEMENTATION
+*
+************************************************************************************/
+
+#if defined(MAZE_RENDER_IMPLEMENTATION) && !defined(MAZE_RENDER_IMPLEMENTATION_DONE)
+#define MAZE_RENDER_IMPLEMENTATION_DONE
+
+#include "rlgl.h"       // Required for: rlBegin(), rlVertex2f(), rlCheckRenderBatchLimit(), rlLoadTexture(), rlUpdateTexture()...
+#include "maze_file.h"  // Required for: PackMazeCellsRows()
+
+#include <stdlib.h>     // Required for: malloc(), realloc(), free()
+#include <math.h>       // Required for: floorf()
+
+#if defined(PLATFORM_DESKTOP)
+    #define MAZE_RENDER_GLSL_VERSION    330
+#else   // PLATFORM_ANDROID, PLATFORM_WEB
+    #define MAZE_RENDER_GLSL_VERSION    100
+#endif
+
+//----------------------------------------------------------------------------------
+// Global Variables Definition
+//----------------------------------------------------------------------------------
+
+// Overview shader (raylib default vertex shader): quad texcoords cover maze cells, cell byte read
+// at texel center, cell type bits selected by cell position in texel (cellsLayout.x cells per texel,
+// 2 bits each from bit cellsLayout.y), 4 samples averaged when cells are smaller than pixels
+// NOTE: Palette colors selected without dynamic indexing (not supported by GLSL 100)
+#if (MAZE_RENDER_GLSL_VERSION == 330)
+static const char *maze_overview_fs =
+    "#version 330\n"
+    "in vec2 fragTexCoord;\n"
+    "in vec4 fragColor;\n"
+    "uniform sampler2D texture0;\n"     // Cells texture
+    "uniform vec4 colDiffuse;\n"
+    "uniform vec2 mazeSize;\n"          // Maze size in cells
+    "uniform vec2 textureSize;\n"       // Cells texture size in texels
+    "uniform vec2 cellsLayout;\n"       // x: cells per texel, y: cell type bits shift
+    "uniform vec4 palette[4];\n"        // Cell types colors
+    "uniform float spread;\n"           // Samples offset from pixel center (cells)
+    "out vec4 finalColor;\n"
+    "vec4 GetCellColor(vec2 position)\n"
+    "{\n"
+    "    vec2 cell = clamp(floor(position), vec2(0.0), mazeSize - 1.0);\n"
+    "    float column = floor(cell.x/cellsLayout.x);\n"
+    "    float value = floor(texture(texture0, (vec2(column, cell.y) + 0.5)/textureSize).r*255.0 + 0.5);\n"
+    "    float type = mod(floor(value/exp2(cellsLayout.y + 2.0*(cell.x - column*cellsLayout.x))), 4.0);\n"
+    "    return (type < 0.5)? palette[0] : (type < 1.5)? palette[1] : (type < 2.5)? palette[2] : palette[3];\n"
+    "}\n"
+    "void main()\n"
+    "{\n"
+    "    vec2 cell = fragTexCoord*textureSize*vec2(cellsLayout.x, 1.0);\n"
+    "    vec4 color = 0.25*(GetCellColor(cell + vec2(-spread, -spread)) + GetCellColor(cell + vec2(spread, -spread)) +\n"
+    "        GetCellColor(cell + vec2(-spread, spread)) + GetCellColor(cell + vec2(spread, spread)));\n"
+    "    finalColor = color*colDiffuse*fragColor;\n"
+    "}\n";
+#else
+static const char *maze_overview_fs =
+    "#version 100\n"
+    "#ifdef GL_FRAGMENT_PRECISION_HIGH\n"     // Cells coordinates on big mazes require high precision
+    "precision highp float;\n"
+    "#else\n"
+    "precision mediump float;\n"
+    "#endif\n"
+    "varying vec2 fragTexCoord;\n"
+    "varying vec4 fragColor;\n"
+    "uniform sampler2D texture0;\n"
+    "uniform vec4 colDiffuse;\n"
+    "uniform vec2 mazeSize;\n"
+    "uniform vec2 textureSize;\n"
+    "uniform vec2 cellsLayout;\n"
+    "uniform vec4 palette[4];\n"
+    "uniform float spread;\n"
+    "vec4 GetCellColor(vec2 position)\n"
+    "{\n"
+    "    vec2 cell = clamp(floor(position), vec2(0.0), mazeSize - 1.0);\n"
+    "    float column = floor(cell.x/cellsLayout.x);\n"
+    "    float value = floor(texture2D(texture0, (vec2(column, cell.y) + 0.5)/textureSize).r*255.0 + 0.5);\n"
+    "    float type = mod(floor(value/exp2(cellsLayout.y + 2.0*(cell.x - column*cellsLayout.x))), 4.0);\n"
+    "    return (type < 0.5)? palette[0] : (type < 1.5)? palette[1] : (type < 2.5)? palette[2] : palette[3];\n"
+    "}\n"
+    "void main()\n"
+    "{\n"
+    "    vec2 cell = fragTexCoord*textureSize*vec2(cellsLayout.x, 1.0);\n"
+    "    vec4 color = 0.25*(GetCellColor(cell + vec2(-spread, -spread)) + GetCellColor(cell + vec2(spread, -spread)) +\n"
+    "        GetCellColor(cell + vec2(-spread, spread)) + GetCellColor(cell + vec2(spread, spread)));\n"
+    "    gl_FragColor = color*colDiffuse*fragColor;\n"
+    "}\n";
+#endif
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Declaration
+//----------------------------------------------------------------------------------
+static void GenMazeAtlasWallTile(Image *atlas, Image wall, int x, int y, int mask); // Draw wall tile for neighbours mask, joined sides borders removed
+static int DrawMazeOverviewCells(MazeOverview overview, Texture2D cells, int cells_per_texel, int type_shift, int width, int height,
+    Camera2D camera, Vector2 position, float scale, float blend); // Draw cells texture with overview shader (one quad), returns draw calls
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+
+// Load biomes atlas packing all biome textures
+MazeAtlas LoadMazeAtlas(const char **fileNames, int count, int tile_size)
+{
+    Image packed = GenImageMazeAtlas(fileNames, count, tile_size);
+    MazeAtlas atlas = LoadMazeAtlasFromImage(packed, count, tile_size);
+
+    UnloadImage(packed);
+
+    return atlas;
+}
+
+// Generate biomes atlas image (CPU only, can run on any thread)
+// NOTE: Biome tiles are resized to tile_size, biomes not loaded (or fileNames NULL) get
+// placeholder tiles: flat color walls and floor, same atlas layout
+Image GenImageMazeAtlas(const char **fileNames, int count, int tile_size)
+{
+    MazeAtlas atlas = { 0 };
+    atlas.tile_size = tile_size;
+    atlas.biome_count = count;
+
+    Image packed = GenImageColor(MAZE_ATLAS_COLUMNS*tile_size, count*MAZE_ATLAS_BIOME_ROWS*tile_size, BLANK);
+    Rectangle tile = { 0, 0, (float)tile_size, (float)tile_size };
+
+    for (int b = 0; b < count; b++)
+    {
+        Image source = (fileNames != NULL)? LoadImage(fileNames[b]) : (Image){ 0 };
+
+        if (!IsImageValid(source))
+        {
+            if (fileNames != NULL) TraceLog(LOG_WARNING, "MAZE: [%s] Biome texture could not be loaded", fileNames[b]);
+
+            // Placeholder source: walls (bottom-left) and walls side (top) light, floor (bottom-right) dark
+            source = GenImageColor(2*tile_size, 2*tile_size, LIGHTGRAY);
+            ImageDrawRectangle(&source, tile_size, tile_size, tile_size, tile_size, DARKGRAY);
+            ImageDrawRectangleLines(&source, (Rectangle){ 0, (float)tile_size, (float)tile_size, (float)tile_size }, tile_size/8, GRAY);
+        }
+
+        float half_width = source.width/2.0f;
+        float half_height = source.height/2.0f;
+
+        // Wall quad resized to tile size, used as base of all wall tiles
+        Image wall = GenImageColor(tile_size, tile_size, BLANK);
+        ImageDraw(&wall, source, (Rectangle){ 0, half_height, half_width, half_height }, tile, WHITE);
+
+        for (int mask = 0; mask < 16; mask++)
+        {
+            Rectangle rec = GetMazeAtlasTileRec(atlas, b, MAZE_ATLAS_TILE_WALL + mask);
+            GenMazeAtlasWallTile(&packed, wall, (int)rec.x, (int)rec.y, mask);
+        }
+
+        ImageDraw(&packed, source, (Rectangle){ half_width, half_height, half_width, half_height }, GetMazeAtlasTileRec(atlas, b, MAZE_ATLAS_TILE_FLOOR), WHITE);
+        ImageDraw(&packed, source, (Rectangle){ 0, 0, half_width, half_height }, GetMazeAtlasTileRec(atlas, b, MAZE_ATLAS_TILE_SIDE_A), WHITE);
+        ImageDraw(&packed, source, (Rectangle){ half_width, 0, half_width, half_height }, GetMazeAtlasTileRec(atlas, b, MAZE_ATLAS_TILE_SIDE_B), WHITE);
+
+        UnloadImage(wall);
+        UnloadImage(source);
+    }
+
+    return packed;
+}
+
+// Load biomes atlas from atlas image (texture upload)
+MazeAtlas LoadMazeAtlasFromImage(Image image, int count, int tile_size)
+{
+    MazeAtlas atlas = { 0 };
+    atlas.tile_size = tile_size;
+    atlas.biome_count = count;
+
+    // Cells tile lookup table: floor cells always floor tile, wall cells tile by wall neighbours
+    for (int mask = 0; mask < 16; mask++)
+    {
+        atlas.tiles[mask] = MAZE_ATLAS_TILE_FLOOR;
+        atlas.tiles[16 + mask] = (unsigned char)(MAZE_ATLAS_TILE_WALL + mask);
+    }
+
+    atlas.texture = LoadTextureFromImage(image);
+
+    return atlas;
+}
+
+// Unload biomes atlas texture
+void UnloadMazeAtlas(MazeAtlas *atlas)
+{
+    UnloadTexture(atlas->texture);
+    *atlas = (MazeAtlas){ 0 };
+}
+
+// Get biome tile rectangle in atlas texture (pixels)
+Rectangle GetMazeAtlasTileRec(MazeAtlas atlas, int biome, int tile)
+{
+    Rectangle rec = { 0 };
+    rec.x = (float)((tile%MAZE_ATLAS_COLUMNS)*atlas.tile_size);
+    rec.y = (float)((biome*MAZE_ATLAS_BIOME_ROWS + tile/MAZE_ATLAS_COLUMNS)*atlas.tile_size);
+    rec.width = (float)atlas.tile_size;
+    rec.height = (float)atlas.tile_size;
+
+    return rec;
+}
+
+// Load maze tiles map, all cells tiles computed
+MazeTiles LoadMazeTiles(MazeGrid grid, MazeAtlas atlas)
+{
+    MazeTiles tiles = { 0 };
+    tiles.tiles = (unsigned char *)malloc((size_t)grid.width*grid.height);
+
+    if (tiles.tiles != NULL)
+    {
+        tiles.width = grid.width;
+        tiles.height = grid.height;
+        UpdateMazeTiles(&tiles, grid, atlas, 0, 0, grid.width, grid.height);
+    }
+
+    return tiles;
+}
+
+// Unload maze tiles map
+void UnloadMazeTiles(MazeTiles *tiles)
+{
+    free(tiles->tiles);
+    *tiles = (MazeTiles){ 0 };
+}
+
+// Update cells area tiles (and area neighbours)
+// NOTE: Cells out of maze are considered walls, so maze border walls join out of maze
+void UpdateMazeTiles(MazeTiles *tiles, MazeGrid grid, MazeAtlas atlas, int x, int y, int width, int height)
+{
+    if ((tiles->tiles == NULL) || (tiles->width != grid.width) || (tiles->height != grid.height)) return;
+
+    // Neighbour cells tiles depend on area cells, area expanded by one cell and clamped
+    int min_x = (x > 0)? x - 1 : 0;
+    int min_y = (y > 0)? y - 1 : 0;
+    int max_x = (x + width < grid.width)? x + width : grid.width - 1;
+    int max_y = (y + height < grid.height)? y + height : grid.height - 1;
+
+    for (int cy = min_y; cy <= max_y; cy++)
+    {
+        const unsigned char *row = &grid.cells[(size_t)cy*grid.width];
+        const unsigned char *up = (cy > 0)? row - grid.width : NULL;
+        const unsigned char *down = (cy < (grid.height - 1))? row + grid.width : NULL;
+        unsigned char *out = &tiles->tiles[(size_t)cy*grid.width];
+
+        for (int cx = min_x; cx <= max_x; cx++)
+        {
+            int mask = 0;
+            if ((up == NULL) || (up[cx] == MAZE_CELL_WALL)) mask |= MAZE_WALL_NORTH;
+            if ((cx == (grid.width - 1)) || (row[cx + 1] == MAZE_CELL_WALL)) mask |= MAZE_WALL_EAST;
+            if ((down == NULL) || (down[cx] == MAZE_CELL_WALL)) mask |= MAZE_WALL_SOUTH;
+            if ((cx == 0) || (row[cx - 1] == MAZE_CELL_WALL)) mask |= MAZE_WALL_WEST;
+
+            out[cx] = atlas.tiles[((row[cx] == MAZE_CELL_WALL) << 4) | mask];
+        }
+    }
+}
+
+// Get maze cells visible on screen for provided camera, maze drawn at position with scale (cell size)
+MazeViewRange GetMazeViewRange(MazeGrid grid, Camera2D camera, Vector2 position, float scale)
+{
+    // Screen corners transformed into world space, considering camera rotation
+    Vector2 corners[4] = {
+        GetScreenToWorld2D((Vector2){ 0, 0 }, camera),
+        GetScreenToWorld2D((Vector2){ (float)GetScreenWidth(), 0 }, camera),
+        GetScreenToWorld2D((Vector2){ 0, (float)GetScreenHeight() }, camera),
+        GetScreenToWorld2D((Vector2){ (float)GetScreenWidth(), (float)GetScreenHeight() }, camera),
+    };
+
+    Vector2 min = corners[0];
+    Vector2 max = corners[0];
+
+    for (int i = 1; i < 4; i++)
+    {
+        if (corners[i].x < min.x) min.x = corners[i].x;
+        if (corners[i].y < min.y) min.y = corners[i].y;
+        if (corners[i].x > max.x) max.x = corners[i].x;
+        if (corners[i].y > max.y) max.y = corners[i].y;
+    }
+
+    MazeViewRange range = { 0 };
+    range.min_x = (int)floorf((min.x - position.x)/scale);
+    range.min_y = (int)floorf((min.y - position.y)/scale);
+    range.max_x = (int)floorf((max.x - position.x)/scale);
+    range.max_y = (int)floorf((max.y - position.y)/scale);
+
+    // Clamp range to grid limits
+    if (range.min_x < 0) range.min_x = 0;
+    if (range.min_y < 0) range.min_y = 0;
+    if (range.max_x > (grid.width - 1)) range.max_x = grid.width - 1;
+    if (range.max_y > (grid.height - 1)) range.max_y = grid.height - 1;
+
+    return range;
+}
+
+// Draw maze visible tiles using biome tiles from atlas
+MazeRenderStats DrawMazeTiles(MazeTiles tiles, MazeAtlas atlas, int biome, Camera2D camera, Vector2 position, float scale)
+{
+    MazeRenderStats stats = { 0 };
+    MazeViewRange range = GetMazeViewRange((MazeGrid){ tiles.width, tiles.height, NULL }, camera, position, scale);
+
+    if ((range.min_x > range.max_x) || (range.min_y > range.max_y) || (atlas.texture.id == 0)) return stats;
+    if ((biome < 0) || (biome >= atlas.biome_count)) biome = 0;
+
+    // Atlas tiles texture coordinates, computed once per frame,
+    // biome only changes texture coordinates vertical offset
+    float tile_u = (float)atlas.tile_size/atlas.texture.width;
+    float tile_v = (float)atlas.tile_size/atlas.texture.height;
+    float biome_v = biome*MAZE_ATLAS_BIOME_ROWS*tile_v;
+    Vector2 coords[MAZE_ATLAS_TILE_COUNT] = { 0 };
+
+    for (int t = 0; t < MAZE_ATLAS_TILE_COUNT; t++)
+    {
+        coords[t].x = (t%MAZE_ATLAS_COLUMNS)*tile_u;
+        coords[t].y = biome_v + (t/MAZE_ATLAS_COLUMNS)*tile_v;
+    }
+
+    // NOTE: All tiles share the same texture, so they go into the same render batch draw,
+    // a new draw call is only required when batch vertex buffer gets full
+    rlSetTexture(atlas.texture.id);
+    rlBegin(RL_QUADS);
+
+        rlColor4ub(255, 255, 255, 255);
+        rlNormal3f(0.0f, 0.0f, 1.0f);
+
+        stats.draw_calls = 1;
+
+        for (int y = range.min_y; y <= range.max_y; y++)
+        {
+            const unsigned char *row = &tiles.tiles[(size_t)y*tiles.width];
+            float top = position.y + y*scale;
+            float bottom = top + scale;
+
+            for (int x = range.min_x; x <= range.max_x; x++)
+            {
+                Vector2 uv = coords[row[x]];
+                float left = position.x + x*scale;
+                float right = left + scale;
+
+                if (rlCheckRenderBatchLimit(4)) stats.draw_calls++;
+
+                rlTexCoord2f(uv.x, uv.y);
+                rlVertex2f(left, top);
+                rlTexCoord2f(uv.x, uv.y + tile_v);
+                rlVertex2f(left, bottom);
+                rlTexCoord2f(uv.x + tile_u, uv.y + tile_v);
+                rlVertex2f(right, bottom);
+                rlTexCoord2f(uv.x + tile_u, uv.y);
+                rlVertex2f(right, top);
+            }
+        }
+
+    rlEnd();
+    rlSetTexture(0);
+
+    stats.visible_tiles = (range.max_x - range.min_x + 1)*(range.max_y - range.min_y + 1);
+
+    return stats;
+}
+
+// Load overview shader (no cells texture), palette: one color per MazeCellType
+MazeOverview LoadMazeOverview(const Color *palette)
+{
+    MazeOverview overview = { 0 };
+
+    for (int i = 0; (palette != NULL) && (i < 4); i++) overview.palette[i] = palette[i];
+
+    overview.shader = LoadShaderFromMemory(NULL, maze_overview_fs);
+    overview.size_loc = GetShaderLocation(overview.shader, "mazeSize");
+    overview.texture_size_loc = GetShaderLocation(overview.shader, "textureSize");
+    overview.layout_loc = GetShaderLocation(overview.shader, "cellsLayout");
+    overview.palette_loc = GetShaderLocation(overview.shader, "palette");
+    overview.spread_loc = GetShaderLocation(overview.shader, "spread");
+
+    return overview;
+}
+
+// Unload overview cells texture, shader and upload buffer
+void UnloadMazeOverview(MazeOverview *overview)
+{
+    if (overview->texture.id > 0) UnloadTexture(overview->texture);
+    if (overview->shader.id > 0) UnloadShader(overview->shader);
+    free(overview->staging);
+
+    *overview = (MazeOverview){ 0 };
+}
+
+// Reset cells texture for maze size, packed rows (maze file layout) can be NULL
+// NOTE: Packed rows uploaded as they are, texture left empty if not provided (cells uploaded by updates),
+// texture unloaded for an empty size
+void ResetMazeOverview(MazeOverview *overview, int width, int height, const unsigned char *packed)
+{
+    if (overview->shader.id == 0) return;
+
+    if (overview->texture.id > 0) UnloadTexture(overview->texture);
+    overview->texture = (Texture2D){ 0 };
+    overview->width = 0;
+    overview->height = 0;
+
+    if ((width <= 0) || (height <= 0)) return;
+
+    overview->width = width;
+    overview->height = height;
+    overview->texture.id = rlLoadTexture(packed, (width + 3)/4, height, PIXELFORMAT_UNCOMPRESSED_GRAYSCALE, 1);
+    overview->texture.width = (width + 3)/4;
+    overview->texture.height = height;
+    overview->texture.mipmaps = 1;
+    overview->texture.format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE;
+}
+
+// Update cells area from grid, returns bytes uploaded
+// NOTE: Area widened to whole texels (4 cells), area rows packed into upload buffer, grown as required
+int UpdateMazeOverview(MazeOverview *overview, MazeGrid grid, int x, int y, int width, int height)
+{
+    if ((overview->texture.id == 0) || (grid.width != overview->width) || (grid.height != overview->height) ||
+        (width <= 0) || (height <= 0)) return 0;
+
+    int texels = (x%4 + width + 3)/4;
+    int size = texels*height;
+
+    if (size > overview->staging_size)
+    {
+        unsigned char *staging = (unsigned char *)realloc(overview->staging, size);
+        if (staging == NULL) return 0;
+
+        overview->staging = staging;
+        overview->staging_size = size;
+    }
+
+    if (PackMazeCellsRows(grid, x, y, width, height, overview->staging) != size) return 0;
+
+    rlUpdateTexture(overview->texture.id, x/4, y, texels, height, overview->texture.format, overview->staging);
+
+    return size;
+}
+
+// Get overview blend for cells size on screen: 0.0f tiles only, 1.0f overview only
+// NOTE: Cells size from fade_start (tiles only) down to fade_end (overview only) eased with smoothstep
+float GetMazeLodBlend(Camera2D camera, float scale, float fade_start, float fade_end)
+{
+    float cell_size = scale*camera.zoom;
+
+    if (cell_size >= fade_start) return 0.0f;
+    if (cell_size <= fade_end) return 1.0f;
+
+    float t = (fade_start - cell_size)/(fade_start - fade_end);
+
+    return t*t*(3.0f - 2.0f*t);
+}
+
+// Draw maze tiles and/or overview for blend
+// NOTE: Overview drawn as one quad over tiles, faded in by blend, tiles not drawn once fully covered
+MazeRenderStats DrawMazeLod(MazeTiles tiles, MazeAtlas atlas, int biome, MazeOverview overview, Camera2D camera, Vector2 position, float scale, float blend)
+{
+    MazeRenderStats stats = { 0 };
+
+    if ((blend < 1.0f) || (overview.texture.id == 0)) stats = DrawMazeTiles(tiles, atlas, biome, camera, position, scale);
+
+    stats.draw_calls += DrawMazeOverview(overview, camera, position, scale, blend);
+
+    return stats;
+}
+
+// Draw overview faded in by blend (one quad), returns draw calls
+// NOTE: Camera only used for cells size on screen (minification filter)
+int DrawMazeOverview(MazeOverview overview, Camera2D camera, Vector2 position, float scale, float blend)
+{
+    return DrawMazeOverviewCells(overview, overview.texture, 4, 0, overview.width, overview.height, camera, position, scale, blend);
+}
+
+// Draw overview from one byte per cell texture (cell type bits at type_shift)
+// NOTE: Used to draw overview from another renderer cells texture (i.e. tilemap), no overview cells texture required
+int DrawMazeOverviewTexture(MazeOverview overview, Texture2D cells, int type_shift, Camera2D camera, Vector2 position, float scale, float blend)
+{
+    return DrawMazeOverviewCells(overview, cells, 1, type_shift, cells.width, cells.height, camera, position, scale, blend);
+}
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Definition
+//----------------------------------------------------------------------------------
+
+// Draw wall tile for neighbours mask, joined sides borders removed
+// NOTE: Borders replaced by wall tile center pixels, corners only if both sides are joined
+static void GenMazeAtlasWallTile(Image *atlas, Image wall, int x, int y, int mask)
+{
+    float size = (float)wall.width;
+    float band = size/4.0f;     // Wall border width, covering source textures frame
+    float inner = size - 2.0f*band;
+    Rectangle center = { band, band, band, band };
+
+    ImageDraw(atlas, wall, (Rectangle){ 0, 0, size, size }, (Rectangle){ (float)x, (float)y, size, size }, WHITE);
+
+    if (mask & MAZE_WALL_NORTH) ImageDraw(atlas, wall, (Rectangle){ band, band, inner, band }, (Rectangle){ x + band, (float)y, inner, band }, WHITE);
+    if (mask & MAZE_WALL_SOUTH) ImageDraw(atlas, wall, (Rectangle){ band, band, inner, band }, (Rectangle){ x + band, y + size - band, inner, band }, WHITE);
+    if (mask & MAZE_WALL_WEST) ImageDraw(atlas, wall, (Rectangle){ band, band, band, inner }, (Rectangle){ (float)x, y + band, band, inner }, WHITE);
+    if (mask & MAZE_WALL_EAST) ImageDraw(atlas, wall, (Rectangle){ band, band, band, inner }, (Rectangle){ x + size - band, y + band, band, inner }, WHITE);
+
+    if ((mask & MAZE_WALL_NORTH) && (mask & MAZE_WALL_WEST)) ImageDraw(atlas, wall, center, (Rectangle){ (float)x, (float)y, band, band }, WHITE);
+    if ((mask & MAZE_WALL_NORTH) && (mask & MAZE_WALL_EAST)) ImageDraw(atlas, wall, center, (Rectangle){ x + size - band, (float)y, band, band }, WHITE);
+    if ((mask & MAZE_WALL_SOUTH) && (mask & MAZE_WALL_WEST)) ImageDraw(atlas, wall, center, (Rectangle){ (float)x, y + size - band, band, band }, WHITE);
+    if ((mask & MAZE_WALL_SOUTH) && (mask & MAZE_WALL_EAST)) ImageDraw(atlas, wall, center, (Rectangle){ x + size - band, y + size - band, band, band }, WHITE);
+}
+
+// Draw cells texture with overview shader (one quad), returns draw calls
+// NOTE: Quad source covers maze cells in texels, cells texture can be wider (last texel partially used)
+static int DrawMazeOverviewCells(MazeOverview overview, Texture2D cells, int cells_per_texel, int type_shift, int width, int height,
+    Camera2D camera, Vector2 position, float scale, float blend)
+{
+    if ((blend <= 0.0f) || (cells.id == 0) || (overview.shader.id == 0) || (width <= 0) || (height <= 0)) return 0;
+
+    float cells_per_pixel = 1.0f/(scale*camera.zoom);
+    float spread = (cells_per_pixel > 1.0f)? 0.25f*cells_per_pixel : 0.0f;
+    float maze_size[2] = { (float)width, (float)height };
+    float texture_size[2] = { (float)cells.width, (float)cells.height };
+    float layout[2] = { (float)cells_per_texel, (float)type_shift };
+    float colors[4][4] = { 0 };
+
+    for (int i = 0; i < 4; i++)
+    {
+        colors[i][0] = overview.palette[i].r/255.0f;
+        colors[i][1] = overview.palette[i].g/255.0f;
+        colors[i][2] = overview.palette[i].b/255.0f;
+        colors[i][3] = overview.palette[i].a/255.0f;
+    }
+
+    // NOTE: Shader mode flushes previous draws, uniforms set before the quad is batched
+    BeginShaderMode(overview.shader);
+
+        SetShaderValue(overview.shader, overview.size_loc, maze_size, SHADER_UNIFORM_VEC2);
+        SetShaderValue(overview.shader, overview.texture_size_loc, texture_size, SHADER_UNIFORM_VEC2);
+        SetShaderValue(overview.shader, overview.layout_loc, layout, SHADER_UNIFORM_VEC2);
+        SetShaderValueV(overview.shader, overview.palette_loc, colors, SHADER_UNIFORM_VEC4, 4);
+        SetShaderValue(overview.shader, overview.spread_loc, &spread, SHADER_UNIFORM_FLOAT);
+
+        Rectangle source = { 0.0f, 0.0f, (float)width/cells_per_texel, (float)height };
+        Rectangle dest = { position.x, position.y, width*scale, height*scale };
+
+        DrawTexturePro(cells, source, dest, (Vector2){ 0.0f, 0.0f }, 0.0f, Fade(WHITE, blend));
+
+    EndShaderMode();
+
+    return 1;
+}
+
+#endif // MAZE_RENDER_IMPLEMENTATION
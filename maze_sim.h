@@ -0,0 +1,457 @@
+/*******************************************************************************************
+*
+*   maze_sim - Fixed timestep game simulation, input recording and replay
+*
+*   Game update (player movement, collisions, items pickup and win detection) runs in
+*   fixed ticks (MAZE_SIM_TICK_RATE per second), independent of rendering frame rate:
+*   every frame runs the ticks due for the frame time, so game speed does not depend on
+*   target FPS, and headless runs can execute ticks as fast as possible
+*
+*   Simulation result only depends on starting state and per-tick input, so a session
+*   is recorded as an input log (input runs, 2 bytes per run) and can be replayed later,
+*   reproducing same final state for the same maze
+*
+*   CONFIGURATION:
+*       #define MAZE_SIM_IMPLEMENTATION
+*           Generates the implementation of the module in the including file,
+*           only one translation unit should define it
+*
+*   DEPENDENCIES:
+*       maze_grid       - Maze cells data, replays maze check
+*       maze_items      - Items pickup
+*       maze_dirty      - Picked items cells marked as dirty
+*       maze_player     - Player movement and cell interaction
+*
+*   NOTE: Module is window-free and does not depend on raylib
+*
+*   Copyright (c) 2024-2025 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#ifndef MAZE_SIM_H
+#define MAZE_SIM_H
+
+#include "maze_grid.h"
+#include "maze_items.h"
+#include "maze_dirty.h"
+#include "maze_player.h"
+
+#define MAZE_SIM_TICK_RATE          60      // Simulation ticks per second
+#define MAZE_SIM_MAX_FRAME_TICKS    8       // Maximum ticks per frame, long frames are not caught up
+#define MAZE_SIM_REPLAY_VERSION     1
+
+// Maze simulation state
+typedef struct MazeSimState {
+    float player_x;             // Player position, world units
+    float player_y;
+    int score;                  // Player score
+    bool won;                   // Player reached the end
+    unsigned int tick;          // Ticks simulated
+} MazeSimState;
+
+// Maze simulation
+typedef struct MazeSim {
+    MazeSimState state;         // Simulation state
+
+    float origin_x;             // Maze cell (0, 0) world position
+    float origin_y;
+    float scale;                // Maze cell size, world units
+    float speed;                // Player speed, world units per tick
+
+    MazeWalkableFunc walkable;  // Walkable cells check, used for collisions
+    void *walkable_data;        // Walkable cells check data
+    MazeGrid *grid;             // Maze cells, items pickup and win detection (NULL to disable)
+    MazeItems *items;           // Maze items
+    MazeDirtyRegions *dirty;    // Maze cells changed by simulation (can be NULL)
+
+    double accumulator;         // Frame time not simulated yet, in seconds
+} MazeSim;
+
+// Input log, input stored as runs of ticks with same input
+// NOTE: Run stored as (ticks << 4) | input bits, up to 4095 ticks per run
+typedef struct MazeInputLog {
+    unsigned short *runs;       // Input runs
+    int count;                  // Input runs used
+    int capacity;               // Input runs allocated
+    unsigned int ticks;         // Ticks recorded
+} MazeInputLog;
+
+// Maze replay, recorded session
+typedef struct MazeReplay {
+    unsigned int maze_hash;     // Maze cells hash at session start (ComputeMazeGridHash())
+    float origin_x;             // Simulation parameters
+    float origin_y;
+    float scale;
+    float speed;
+    MazeSimState start;         // State at session start
+    MazeSimState end;           // State at session end
+    MazeInputLog log;           // Session input
+} MazeReplay;
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+// Simulation
+void ResetMazeSim(MazeSim *sim, float player_x, float player_y);  // Reset simulation state, player placed at position
+int GetMazeSimTicks(MazeSim *sim, float frame_time);                // Get ticks to run for frame time (accumulated)
+bool StepMazeSim(MazeSim *sim, MazePlayerInput input);              // Run one simulation tick, returns true if maze cells changed (item picked)
+
+// Input recording and replay
+void RecordMazeInput(MazeInputLog *log, MazePlayerInput input);     // Record one tick input
+void UnloadMazeInputLog(MazeInputLog *log);                         // Unload input log data
+void StartMazeRecording(MazeReplay *replay, const MazeSim *sim);    // Start recording a session from current simulation state
+void StopMazeRecording(MazeReplay *replay, const MazeSim *sim);     // Stop recording session, simulation state saved as end state
+bool SaveMazeReplay(const char *fileName, MazeReplay replay);       // Save replay file
+MazeReplay LoadMazeReplay(const char *fileName);                    // Load replay file (check log.ticks/log.runs for success)
+void UnloadMazeReplay(MazeReplay *replay);                          // Unload replay data
+bool PlayMazeReplay(MazeSim *sim, MazeReplay replay);               // Run replay ticks from replay start state, returns true if end state matches
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif // MAZE_SIM_H
+
+/***********************************************************************************
+*
+*   MAZE_SIM IMPLEMENTATION
+*
+************************************************************************************/
+
+#if defined(MAZE_SIM_IMPLEMENTATION) && !defined(MAZE_SIM_IMPLEMENTATION_DONE)
+#define MAZE_SIM_IMPLEMENTATION_DONE
+
+#include <stdio.h>      // Required for: FILE, fopen(), fwrite(), fread(), fclose()
+#include <stdlib.h>     // Required for: malloc(), realloc(), free()
+#include <string.h>     // Required for: memcpy(), memcmp()
+
+#define MAZE_SIM_REPLAY_HEADER_SIZE     76
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Declaration
+//----------------------------------------------------------------------------------
+static unsigned int GetMazeInputBits(MazePlayerInput input);        // Get input as bits (up, down, left, right)
+static MazePlayerInput GetMazeInputFromBits(unsigned int bits);     // Get input from bits
+static bool IsMazeSimStateEqual(MazeSimState a, MazeSimState b);    // Check if simulation states are the same (exactly)
+static void WriteMazeSimState(unsigned char *data, MazeSimState state); // Write simulation state (20 bytes)
+static MazeSimState ReadMazeSimState(const unsigned char *data);    // Read simulation state (20 bytes)
+static void WriteMazeSimU32(unsigned char *data, unsigned int value); // Write little endian 32 bit value
+static unsigned int ReadMazeSimU32(const unsigned char *data);      // Read little endian 32 bit value
+static void WriteMazeSimFloat(unsigned char *data, float value);    // Write float (as 32 bit value)
+static float ReadMazeSimFloat(const unsigned char *data);           // Read float (as 32 bit value)
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+
+// Reset simulation state, player placed at position
+void ResetMazeSim(MazeSim *sim, float player_x, float player_y)
+{
+    sim->state = (MazeSimState){ player_x, player_y, 0, false, 0 };
+    sim->accumulator = 0.0;
+}
+
+// Get ticks to run for frame time (accumulated)
+// NOTE: Remaining frame time is kept for next frames, ticks limited to MAZE_SIM_MAX_FRAME_TICKS
+// so a long frame (i.e. window dragged) does not run a burst of ticks
+int GetMazeSimTicks(MazeSim *sim, float frame_time)
+{
+    const double tick_time = 1.0/MAZE_SIM_TICK_RATE;
+
+    sim->accumulator += frame_time;
+    int ticks = (int)(sim->accumulator/tick_time);
+
+    if (ticks > MAZE_SIM_MAX_FRAME_TICKS)
+    {
+        ticks = MAZE_SIM_MAX_FRAME_TICKS;
+        sim->accumulator = 0.0;
+    }
+    else sim->accumulator -= ticks*tick_time;
+
+    return ticks;
+}
+
+// Run one simulation tick, returns true if maze cells changed (item picked)
+// NOTE: Player moves a fixed distance per tick, no frame time involved, so same input
+// always gives same positions
+bool StepMazeSim(MazeSim *sim, MazePlayerInput input)
+{
+    bool picked = false;
+
+    if (!sim->state.won)
+    {
+        MoveMazePlayer(&sim->state.player_x, &sim->state.player_y, input, sim->speed, sim->origin_x, sim->origin_y, sim->scale, sim->walkable, sim->walkable_data);
+
+        if ((sim->grid != NULL) && (sim->items != NULL))
+        {
+            int cell_x = GetMazeWorldCell(sim->state.player_x, sim->origin_x, sim->scale);
+            int cell_y = GetMazeWorldCell(sim->state.player_y, sim->origin_y, sim->scale);
+
+            picked = UpdateMazePlayerCell(sim->grid, sim->items, sim->dirty, cell_x, cell_y, &sim->state.score, &sim->state.won);
+        }
+    }
+
+    sim->state.tick++;
+
+    return picked;
+}
+
+// Record one tick input
+void RecordMazeInput(MazeInputLog *log, MazePlayerInput input)
+{
+    unsigned int bits = GetMazeInputBits(input);
+
+    if ((log->count > 0) && ((log->runs[log->count - 1] & 0x0f) == bits) && ((log->runs[log->count - 1] >> 4) < 0x0fff))
+    {
+        log->runs[log->count - 1] += (1 << 4);
+    }
+    else
+    {
+        if (log->count >= log->capacity)
+        {
+            int capacity = (log->capacity > 0)? log->capacity*2 : 256;
+            unsigned short *runs = (unsigned short *)realloc(log->runs, capacity*sizeof(unsigned short));
+
+            if (runs == NULL) return;
+
+            log->runs = runs;
+            log->capacity = capacity;
+        }
+
+        log->runs[log->count++] = (unsigned short)((1 << 4) | bits);
+    }
+
+    log->ticks++;
+}
+
+// Unload input log data
+void UnloadMazeInputLog(MazeInputLog *log)
+{
+    free(log->runs);
+
+    *log = (MazeInputLog){ 0 };
+}
+
+// Start recording a session from current simulation state
+// NOTE: Maze cells hash is stored, replay must be run on the same maze
+void StartMazeRecording(MazeReplay *replay, const MazeSim *sim)
+{
+    UnloadMazeInputLog(&replay->log);
+
+    replay->maze_hash = (sim->grid != NULL)? ComputeMazeGridHash(*sim->grid) : 0;
+    replay->origin_x = sim->origin_x;
+    replay->origin_y = sim->origin_y;
+    replay->scale = sim->scale;
+    replay->speed = sim->speed;
+    replay->start = sim->state;
+    replay->end = sim->state;
+}
+
+// Stop recording session, simulation state saved as end state
+void StopMazeRecording(MazeReplay *replay, const MazeSim *sim)
+{
+    replay->end = sim->state;
+}
+
+// Save replay file
+// NOTE: Header (76 bytes, little endian) followed by input runs (2 bytes each)
+bool SaveMazeReplay(const char *fileName, MazeReplay replay)
+{
+    FILE *file = fopen(fileName, "wb");
+
+    if (file == NULL) return false;
+
+    unsigned char header[MAZE_SIM_REPLAY_HEADER_SIZE] = { 0 };
+
+    memcpy(header, "MZRP", 4);
+    WriteMazeSimU32(header + 4, MAZE_SIM_REPLAY_VERSION);
+    WriteMazeSimU32(header + 8, replay.maze_hash);
+    WriteMazeSimFloat(header + 12, replay.origin_x);
+    WriteMazeSimFloat(header + 16, replay.origin_y);
+    WriteMazeSimFloat(header + 20, replay.scale);
+    WriteMazeSimFloat(header + 24, replay.speed);
+    WriteMazeSimState(header + 28, replay.start);
+    WriteMazeSimState(header + 48, replay.end);
+    WriteMazeSimU32(header + 68, replay.log.ticks);
+    WriteMazeSimU32(header + 72, (unsigned int)replay.log.count);
+
+    bool success = (fwrite(header, 1, MAZE_SIM_REPLAY_HEADER_SIZE, file) == MAZE_SIM_REPLAY_HEADER_SIZE);
+
+    for (int i = 0; success && (i < replay.log.count); i++)
+    {
+        unsigned char run[2] = { replay.log.runs[i] & 0xff, (replay.log.runs[i] >> 8) & 0xff };
+        success = (fwrite(run, 1, 2, file) == 2);
+    }
+
+    if (fclose(file) != 0) success = false;
+
+    return success;
+}
+
+// Load replay file (check log.ticks/log.runs for success)
+// NOTE: Input runs are checked to match recorded ticks
+MazeReplay LoadMazeReplay(const char *fileName)
+{
+    MazeReplay replay = { 0 };
+    FILE *file = fopen(fileName, "rb");
+
+    if (file == NULL) return replay;
+
+    unsigned char header[MAZE_SIM_REPLAY_HEADER_SIZE] = { 0 };
+
+    if ((fread(header, 1, MAZE_SIM_REPLAY_HEADER_SIZE, file) == MAZE_SIM_REPLAY_HEADER_SIZE) &&
+        (memcmp(header, "MZRP", 4) == 0) && (ReadMazeSimU32(header + 4) == MAZE_SIM_REPLAY_VERSION))
+    {
+        unsigned int ticks = ReadMazeSimU32(header + 68);
+        unsigned int count = ReadMazeSimU32(header + 72);
+        unsigned char *data = ((count > 0) && (count <= 0x7fffffff))? (unsigned char *)malloc((size_t)count*2) : NULL;
+        unsigned short *runs = (data != NULL)? (unsigned short *)malloc((size_t)count*sizeof(unsigned short)) : NULL;
+        unsigned long long run_ticks = 0;
+
+        if ((runs != NULL) && (fread(data, 1, (size_t)count*2, file) == (size_t)count*2))
+        {
+            for (unsigned int i = 0; i < count; i++)
+            {
+                runs[i] = (unsigned short)(data[i*2] | (data[i*2 + 1] << 8));
+                run_ticks += (runs[i] >> 4);
+            }
+        }
+
+        if ((runs != NULL) && (run_ticks == ticks))
+        {
+            replay.maze_hash = ReadMazeSimU32(header + 8);
+            replay.origin_x = ReadMazeSimFloat(header + 12);
+            replay.origin_y = ReadMazeSimFloat(header + 16);
+            replay.scale = ReadMazeSimFloat(header + 20);
+            replay.speed = ReadMazeSimFloat(header + 24);
+            replay.start = ReadMazeSimState(header + 28);
+            replay.end = ReadMazeSimState(header + 48);
+            replay.log = (MazeInputLog){ runs, (int)count, (int)count, ticks };
+        }
+        else free(runs);
+
+        free(data);
+    }
+
+    fclose(file);
+
+    return replay;
+}
+
+// Unload replay data
+void UnloadMazeReplay(MazeReplay *replay)
+{
+    UnloadMazeInputLog(&replay->log);
+
+    *replay = (MazeReplay){ 0 };
+}
+
+// Run replay ticks from replay start state, returns true if end state matches
+// NOTE: Simulation maze data (grid, items) must be in the same state than at session start
+bool PlayMazeReplay(MazeSim *sim, MazeReplay replay)
+{
+    sim->origin_x = replay.origin_x;
+    sim->origin_y = replay.origin_y;
+    sim->scale = replay.scale;
+    sim->speed = replay.speed;
+    sim->state = replay.start;
+    sim->accumulator = 0.0;
+
+    for (int i = 0; i < replay.log.count; i++)
+    {
+        MazePlayerInput input = GetMazeInputFromBits(replay.log.runs[i] & 0x0f);
+
+        for (int t = (replay.log.runs[i] >> 4); t > 0; t--) StepMazeSim(sim, input);
+    }
+
+    return IsMazeSimStateEqual(sim->state, replay.end);
+}
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Definition
+//----------------------------------------------------------------------------------
+
+// Get input as bits (up, down, left, right)
+static unsigned int GetMazeInputBits(MazePlayerInput input)
+{
+    return (input.up? 0x01 : 0) | (input.down? 0x02 : 0) | (input.left? 0x04 : 0) | (input.right? 0x08 : 0);
+}
+
+// Get input from bits
+static MazePlayerInput GetMazeInputFromBits(unsigned int bits)
+{
+    MazePlayerInput input = { 0 };
+
+    input.up = (bits & 0x01);
+    input.down = (bits & 0x02);
+    input.left = (bits & 0x04);
+    input.right = (bits & 0x08);
+
+    return input;
+}
+
+// Check if simulation states are the same (exactly)
+static bool IsMazeSimStateEqual(MazeSimState a, MazeSimState b)
+{
+    return (a.player_x == b.player_x) && (a.player_y == b.player_y) && (a.score == b.score) && (a.won == b.won) && (a.tick == b.tick);
+}
+
+// Write simulation state (20 bytes)
+static void WriteMazeSimState(unsigned char *data, MazeSimState state)
+{
+    WriteMazeSimFloat(data, state.player_x);
+    WriteMazeSimFloat(data + 4, state.player_y);
+    WriteMazeSimU32(data + 8, (unsigned int)state.score);
+    WriteMazeSimU32(data + 12, state.won? 1 : 0);
+    WriteMazeSimU32(data + 16, state.tick);
+}
+
+// Read simulation state (20 bytes)
+static MazeSimState ReadMazeSimState(const unsigned char *data)
+{
+    MazeSimState state = { 0 };
+
+    state.player_x = ReadMazeSimFloat(data);
+    state.player_y = ReadMazeSimFloat(data + 4);
+    state.score = (int)ReadMazeSimU32(data + 8);
+    state.won = (ReadMazeSimU32(data + 12) != 0);
+    state.tick = ReadMazeSimU32(data + 16);
+
+    return state;
+}
+
+// Write little endian 32 bit value
+static void WriteMazeSimU32(unsigned char *data, unsigned int value)
+{
+    data[0] = value & 0xff;
+    data[1] = (value >> 8) & 0xff;
+    data[2] = (value >> 16) & 0xff;
+    data[3] = (value >> 24) & 0xff;
+}
+
+// Read little endian 32 bit value
+static unsigned int ReadMazeSimU32(const unsigned char *data)
+{
+    return (unsigned int)data[0] | ((unsigned int)data[1] << 8) | ((unsigned int)data[2] << 16) | ((unsigned int)data[3] << 24);
+}
+
+// Write float (as 32 bit value)
+static void WriteMazeSimFloat(unsigned char *data, float value)
+{
+    unsigned int bits = 0;
+    memcpy(&bits, &value, sizeof(bits));
+    WriteMazeSimU32(data, bits);
+}
+
+// Read float (as 32 bit value)
+static float ReadMazeSimFloat(const unsigned char *data)
+{
+    unsigned int bits = ReadMazeSimU32(data);
+    float value = 0.0f;
+    memcpy(&value, &bits, sizeof(value));
+
+    return value;
+}
+
+#endif // MAZE_SIM_IMPLEMENTATION
@@ -0,0 +1,546 @@
+/*******************************************************************************************
+*
+*   maze_stream - Endless maze world, streamed in chunks around the camera
+*
+*   World is split in square chunks, every chunk generated from world seed and chunk
+*   coordinates, so the same chunk is always generated the same way. Chunks around the
+*   camera view (plus a prefetch margin) are requested every frame and generated on a
+*   background thread; main thread only creates chunk textures, a few per frame, so
+*   crossing chunks limits does not hitch the game loop. Resident chunks are limited,
+*   least recently used chunks are evicted, unloading their cells and texture together
+*
+*   Chunks are generated with the grid-based algorithm, including a border wall, and
+*   every shared chunk edge gets some doors, placed from the edge position, so both
+*   chunks sharing an edge open the same cells
+*
+*   CONFIGURATION:
+*       #define MAZE_STREAM_IMPLEMENTATION
+*           Generates the implementation of the module in the including file,
+*           only one translation unit should define it
+*
+*   DEPENDENCIES:
+*       raylib          - Chunks textures, camera
+*       maze_grid       - Chunks cells data
+*       maze_gen        - Chunks generation
+*       maze_system     - Background generation thread
+*
+*   Copyright (c) 2024-2025 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#ifndef MAZE_STREAM_H
+#define MAZE_STREAM_H
+
+#include "raylib.h"
+#include "maze_grid.h"
+#include "maze_gen.h"
+#include "maze_system.h"
+
+// Maze stream chunk state
+typedef enum {
+    MAZE_CHUNK_EMPTY = 0,       // Slot not used
+    MAZE_CHUNK_PENDING,         // Chunk requested, waiting for generation
+    MAZE_CHUNK_GENERATED,       // Chunk cells generated, texture not created yet
+    MAZE_CHUNK_LOADED,          // Chunk cells and texture available
+} MazeChunkState;
+
+// Maze stream chunk, cells and texture are loaded and unloaded together
+typedef struct MazeChunk {
+    int chunk_x;                // Chunk coordinates, in chunks
+    int chunk_y;
+    int state;                  // Chunk state (MazeChunkState)
+    unsigned int last_used;     // Last frame the chunk was required, used for eviction
+    MazeGrid grid;              // Chunk cells
+    Texture2D texture;          // Chunk texture (1 byte per cell, grayscale)
+} MazeChunk;
+
+// Maze stream generation request, processed by background thread
+typedef struct MazeChunkRequest {
+    int slot;
+    int chunk_x;
+    int chunk_y;
+    MazeGrid grid;
+} MazeChunkRequest;
+
+// Maze stream statistics
+typedef struct MazeStreamStats {
+    int resident;               // Chunks with cells in memory
+    int pending;                // Chunks waiting for generation
+    int generated;              // Chunks generated since stream loading
+    int evicted;                // Chunks evicted since stream loading
+    int uploads;                // Chunk textures created in last update
+} MazeStreamStats;
+
+// Maze stream, endless maze world
+typedef struct MazeStream {
+    unsigned int seed;          // World seed
+    int chunk_size;             // Chunk size, in cells
+    int spacing_rows;           // Maze points spacing, rows
+    int spacing_cols;           // Maze points spacing, columns
+    float point_chance;         // Maze point chance
+
+    MazeChunk *chunks;          // Chunks slots
+    int capacity;               // Maximum resident chunks
+    unsigned int frame;         // Current update frame
+    int last_slot;              // Last chunk slot accessed, checked first on cells lookup
+
+    // Background generation, requests and results queues protected by mutex
+    MazeThread *thread;
+    MazeMutex *mutex;
+    MazeCondition *work_ready;
+    MazeChunkRequest *requests;     // Chunks waiting for generation (ring buffer)
+    int request_head;
+    int request_count;
+    MazeChunkRequest *results;      // Chunks generated, waiting to be placed in slots
+    int result_count;
+    bool quit;
+
+    MazeStreamStats stats;
+} MazeStream;
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+// Load maze stream, capacity is the maximum number of resident chunks
+MazeStream LoadMazeStream(unsigned int seed, int chunk_size, int spacing_rows, int spacing_cols, float point_chance, int capacity);
+void UnloadMazeStream(MazeStream *stream);                          // Unload maze stream, stopping generation thread
+
+// Update maze stream, requesting chunks visible through camera (plus margin in chunks) and evicting old ones
+// NOTE: Maze cell (0, 0) is placed at world position, cells drawn with scale (cell size)
+void UpdateMazeStream(MazeStream *stream, Camera2D camera, Vector2 position, float scale, int margin);
+
+int GetMazeStreamCell(MazeStream *stream, int x, int y);            // Get world cell type, cells of chunks not generated yet are considered walls
+bool IsMazeStreamCellWalkable(void *stream, int x, int y);          // Walkable cell check callback for endless maze (data: MazeStream *)
+int DrawMazeStream(MazeStream *stream, Camera2D camera, Vector2 position, float scale); // Draw loaded chunks visible through camera, returns chunks drawn
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif // MAZE_STREAM_H
+
+/***********************************************************************************
+*
+*   MAZE_STREAM IMPLEMENTATION
+*
+************************************************************************************/
+
+#if defined(MAZE_STREAM_IMPLEMENTATION) && !defined(MAZE_STREAM_IMPLEMENTATION_DONE)
+#define MAZE_STREAM_IMPLEMENTATION_DONE
+
+#include <stdlib.h>     // Required for: calloc(), malloc(), free()
+#include <math.h>       // Required for: floorf()
+
+#define MAZE_STREAM_UPLOADS_PER_FRAME   2       // Maximum chunk textures created per update
+#define MAZE_STREAM_DOORS_PER_EDGE      2       // Doors opened on every chunk edge
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Declaration
+//----------------------------------------------------------------------------------
+static void MazeStreamWorker(void *data);                           // Background generation thread, processes chunk requests
+static MazeGrid GenMazeStreamChunk(const MazeStream *stream, int chunk_x, int chunk_y); // Generate chunk cells, with doors on its edges
+static void OpenMazeStreamDoors(const MazeStream *stream, MazeGrid *grid, int edge_x, int edge_y, int vertical, int side); // Open doors of a chunk edge
+static int FindMazeStreamChunk(MazeStream *stream, int chunk_x, int chunk_y); // Find chunk slot, -1 if not resident
+static int GetMazeStreamFreeSlot(MazeStream *stream);               // Get free slot, evicting least recently used chunk if required
+static void UnloadMazeStreamChunk(MazeStream *stream, int slot);    // Unload chunk cells and texture, freeing slot
+static void GetMazeStreamView(Camera2D camera, Vector2 position, float scale, int chunk_size, int *min_x, int *min_y, int *max_x, int *max_y); // Get chunks range visible through camera
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+
+// Load maze stream, capacity is the maximum number of resident chunks
+MazeStream LoadMazeStream(unsigned int seed, int chunk_size, int spacing_rows, int spacing_cols, float point_chance, int capacity)
+{
+    MazeStream stream = { 0 };
+
+    if ((chunk_size < 3) || (spacing_rows <= 0) || (spacing_cols <= 0) || (capacity <= 0)) return stream;
+
+    stream.seed = seed;
+    stream.chunk_size = chunk_size;
+    stream.spacing_rows = spacing_rows;
+    stream.spacing_cols = spacing_cols;
+    stream.point_chance = point_chance;
+    stream.capacity = capacity;
+
+    // NOTE: Every slot has one request at most in flight, so queues never exceed capacity
+    stream.chunks = (MazeChunk *)calloc(capacity, sizeof(MazeChunk));
+    stream.requests = (MazeChunkRequest *)calloc(capacity, sizeof(MazeChunkRequest));
+    stream.results = (MazeChunkRequest *)calloc(capacity, sizeof(MazeChunkRequest));
+
+    stream.mutex = LoadMazeMutex();
+    stream.work_ready = LoadMazeCondition();
+
+    return stream;
+}
+
+// Unload maze stream, stopping generation thread
+void UnloadMazeStream(MazeStream *stream)
+{
+    if (stream->thread != NULL)
+    {
+        LockMazeMutex(stream->mutex);
+        stream->quit = true;
+        BroadcastMazeCondition(stream->work_ready);
+        UnlockMazeMutex(stream->mutex);
+
+        JoinMazeThread(stream->thread);
+    }
+
+    for (int i = 0; (stream->chunks != NULL) && (i < stream->capacity); i++) UnloadMazeStreamChunk(stream, i);
+    for (int i = 0; (stream->results != NULL) && (i < stream->result_count); i++) UnloadMazeGrid(stream->results[i].grid);
+
+    UnloadMazeCondition(stream->work_ready);
+    UnloadMazeMutex(stream->mutex);
+
+    free(stream->chunks);
+    free(stream->requests);
+    free(stream->results);
+
+    *stream = (MazeStream){ 0 };
+}
+
+// Update maze stream, requesting chunks visible through camera (plus margin in chunks) and evicting old ones
+void UpdateMazeStream(MazeStream *stream, Camera2D camera, Vector2 position, float scale, int margin)
+{
+    if (stream->chunks == NULL) return;
+
+    stream->frame++;
+    stream->stats.uploads = 0;
+
+#if !defined(MAZE_SYSTEM_NO_THREADS)
+    // Generation thread started on first update, so loading an unused stream is free
+    if (stream->thread == NULL) stream->thread = StartMazeThread(MazeStreamWorker, stream);
+#endif
+
+    // STEP 1: Place generated chunks into their slots
+    //---------------------------------------------------------------------------------
+    if (stream->thread == NULL)
+    {
+        // NOTE: No generation thread available, one request generated per update
+        if (stream->request_count > 0)
+        {
+            MazeChunkRequest request = stream->requests[stream->request_head];
+            stream->request_head = (stream->request_head + 1)%stream->capacity;
+            stream->request_count--;
+
+            request.grid = GenMazeStreamChunk(stream, request.chunk_x, request.chunk_y);
+            stream->results[stream->result_count++] = request;
+        }
+    }
+    else LockMazeMutex(stream->mutex);
+
+    for (int i = 0; i < stream->result_count; i++)
+    {
+        MazeChunk *chunk = &stream->chunks[stream->results[i].slot];
+
+        chunk->grid = stream->results[i].grid;
+        chunk->state = MAZE_CHUNK_GENERATED;
+        stream->stats.generated++;
+    }
+
+    stream->result_count = 0;
+    stream->stats.pending = stream->request_count;
+
+    if (stream->thread != NULL) UnlockMazeMutex(stream->mutex);
+    //---------------------------------------------------------------------------------
+
+    // STEP 2: Request chunks around camera view, create generated chunks textures
+    //---------------------------------------------------------------------------------
+    int min_x = 0, min_y = 0, max_x = 0, max_y = 0;
+    GetMazeStreamView(camera, position, scale, stream->chunk_size, &min_x, &min_y, &max_x, &max_y);
+    min_x -= margin;
+    min_y -= margin;
+    max_x += margin;
+    max_y += margin;
+
+    bool requested = false;
+
+    for (int cy = min_y; cy <= max_y; cy++)
+    {
+        for (int cx = min_x; cx <= max_x; cx++)
+        {
+            int slot = FindMazeStreamChunk(stream, cx, cy);
+
+            if (slot == -1)
+            {
+                // Chunk not resident, request it if a slot can be freed
+                // NOTE: Chunks required this frame are never evicted
+                slot = GetMazeStreamFreeSlot(stream);
+                if (slot == -1) continue;
+
+                stream->chunks[slot].chunk_x = cx;
+                stream->chunks[slot].chunk_y = cy;
+                stream->chunks[slot].state = MAZE_CHUNK_PENDING;
+
+                if (stream->thread != NULL) LockMazeMutex(stream->mutex);
+                stream->requests[(stream->request_head + stream->request_count)%stream->capacity] = (MazeChunkRequest){ slot, cx, cy, { 0 } };
+                stream->request_count++;
+                if (stream->thread != NULL) UnlockMazeMutex(stream->mutex);
+
+                requested = true;
+            }
+
+            MazeChunk *chunk = &stream->chunks[slot];
+            chunk->last_used = stream->frame;
+
+            // Chunk textures creation limited per frame, to avoid spikes when many chunks get generated at once
+            if ((chunk->state == MAZE_CHUNK_GENERATED) && (stream->stats.uploads < MAZE_STREAM_UPLOADS_PER_FRAME))
+            {
+                // NOTE: Chunk texture uses 1 byte per cell (wall = 255, floor = 0)
+                Image image = {
+                    .data = malloc((size_t)chunk->grid.width*chunk->grid.height),
+                    .width = chunk->grid.width,
+                    .height = chunk->grid.height,
+                    .mipmaps = 1,
+                    .format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE
+                };
+
+                if (image.data != NULL)
+                {
+                    unsigned char *pixels = (unsigned char *)image.data;
+                    for (int i = 0; i < image.width*image.height; i++) pixels[i] = (chunk->grid.cells[i] == MAZE_CELL_WALL)? 255 : 0;
+
+                    chunk->texture = LoadTextureFromImage(image);
+                    chunk->state = MAZE_CHUNK_LOADED;
+                    stream->stats.uploads++;
+
+                    free(image.data);
+                }
+            }
+        }
+    }
+
+    if (requested && (stream->thread != NULL))
+    {
+        LockMazeMutex(stream->mutex);
+        SignalMazeCondition(stream->work_ready);
+        UnlockMazeMutex(stream->mutex);
+    }
+    //---------------------------------------------------------------------------------
+
+    stream->stats.resident = 0;
+    for (int i = 0; i < stream->capacity; i++) if (stream->chunks[i].state >= MAZE_CHUNK_GENERATED) stream->stats.resident++;
+}
+
+// Get world cell type, cells of chunks not generated yet are considered walls
+int GetMazeStreamCell(MazeStream *stream, int x, int y)
+{
+    if (stream->chunks == NULL) return MAZE_CELL_WALL;
+
+    // NOTE: Floor division required for negative cell coordinates
+    int cx = (x >= 0)? x/stream->chunk_size : -((-x - 1)/stream->chunk_size) - 1;
+    int cy = (y >= 0)? y/stream->chunk_size : -((-y - 1)/stream->chunk_size) - 1;
+    int slot = FindMazeStreamChunk(stream, cx, cy);
+
+    if ((slot == -1) || (stream->chunks[slot].state < MAZE_CHUNK_GENERATED)) return MAZE_CELL_WALL;
+
+    return GetMazeCell(stream->chunks[slot].grid, x - cx*stream->chunk_size, y - cy*stream->chunk_size);
+}
+
+// Walkable cell check callback for endless maze
+// NOTE: Cells of chunks not generated yet are walls, player waits at chunk limits
+bool IsMazeStreamCellWalkable(void *stream, int x, int y)
+{
+    return (GetMazeStreamCell((MazeStream *)stream, x, y) != MAZE_CELL_WALL);
+}
+
+// Draw loaded chunks visible through camera, returns chunks drawn
+// NOTE: Must be called inside BeginMode2D(camera)
+int DrawMazeStream(MazeStream *stream, Camera2D camera, Vector2 position, float scale)
+{
+    int min_x = 0, min_y = 0, max_x = 0, max_y = 0;
+    int drawn = 0;
+
+    GetMazeStreamView(camera, position, scale, stream->chunk_size, &min_x, &min_y, &max_x, &max_y);
+
+    for (int i = 0; i < stream->capacity; i++)
+    {
+        MazeChunk *chunk = &stream->chunks[i];
+
+        if ((chunk->state != MAZE_CHUNK_LOADED) || (chunk->chunk_x < min_x) || (chunk->chunk_x > max_x) ||
+            (chunk->chunk_y < min_y) || (chunk->chunk_y > max_y)) continue;
+
+        Vector2 chunk_position = {
+            position.x + (float)chunk->chunk_x*stream->chunk_size*scale,
+            position.y + (float)chunk->chunk_y*stream->chunk_size*scale
+        };
+
+        DrawTextureEx(chunk->texture, chunk_position, 0.0f, scale, WHITE);
+        drawn++;
+    }
+
+    return drawn;
+}
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Definition
+//----------------------------------------------------------------------------------
+
+// Background generation thread, processes chunk requests
+static void MazeStreamWorker(void *data)
+{
+    MazeStream *stream = (MazeStream *)data;
+
+    LockMazeMutex(stream->mutex);
+
+    while (true)
+    {
+        while (!stream->quit && (stream->request_count == 0)) WaitMazeCondition(stream->work_ready, stream->mutex);
+
+        if (stream->quit) break;
+
+        MazeChunkRequest request = stream->requests[stream->request_head];
+        stream->request_head = (stream->request_head + 1)%stream->capacity;
+        stream->request_count--;
+
+        // Chunk generated without holding the lock, main thread keeps running
+        UnlockMazeMutex(stream->mutex);
+        request.grid = GenMazeStreamChunk(stream, request.chunk_x, request.chunk_y);
+        LockMazeMutex(stream->mutex);
+
+        stream->results[stream->result_count++] = request;
+    }
+
+    UnlockMazeMutex(stream->mutex);
+}
+
+// Generate chunk cells, with doors on its edges
+static MazeGrid GenMazeStreamChunk(const MazeStream *stream, int chunk_x, int chunk_y)
+{
+    MazeRandom rng = { 0 };
+    SetMazeRandomSeed(&rng, GetMazeChunkSeed(stream->seed, chunk_x, chunk_y));
+
+    MazeGrid grid = GenMazeGrid(stream->chunk_size, stream->chunk_size, stream->spacing_rows, stream->spacing_cols, stream->point_chance, &rng, NULL);
+
+    if (grid.cells != NULL)
+    {
+        // NOTE: Edges identified by the chunk at their west or north side
+        OpenMazeStreamDoors(stream, &grid, chunk_x - 1, chunk_y, 1, 1);     // West edge
+        OpenMazeStreamDoors(stream, &grid, chunk_x, chunk_y, 1, 0);         // East edge
+        OpenMazeStreamDoors(stream, &grid, chunk_x, chunk_y - 1, 0, 1);     // North edge
+        OpenMazeStreamDoors(stream, &grid, chunk_x, chunk_y, 0, 0);         // South edge
+    }
+
+    return grid;
+}
+
+// Open doors of a chunk edge, edge identified by the chunk at its west (vertical) or north side
+// NOTE: Door positions only depend on seed and edge, so both chunks sharing the edge open the same doors.
+// Doors avoid points rows/columns and a corridor is carved inwards until reaching a floor cell
+static void OpenMazeStreamDoors(const MazeStream *stream, MazeGrid *grid, int edge_x, int edge_y, int vertical, int side)
+{
+    int size = stream->chunk_size;
+    int spacing = vertical? stream->spacing_rows : stream->spacing_cols;
+
+    MazeRandom rng = { 0 };
+    SetMazeRandomSeed(&rng, GetMazeChunkSeed(stream->seed ^ (vertical? 0x5bd1e995u : 0x1b873593u), edge_x, edge_y));
+
+    for (int i = 0; i < MAZE_STREAM_DOORS_PER_EDGE; i++)
+    {
+        int along = GetMazeRandomValue(&rng, 1, size - 2);
+        if (((along%spacing) == 0) && (spacing > 1)) along = (along < (size - 2))? along + 1 : along - 1;
+
+        // Cells from chunk edge inwards: side 0 is the west/north chunk (door on its last row/column)
+        for (int depth = 0; depth < (size - 1); depth++)
+        {
+            int across = side? depth : size - 1 - depth;
+            int x = vertical? across : along;
+            int y = vertical? along : across;
+
+            if ((depth > 0) && (GetMazeCell(*grid, x, y) != MAZE_CELL_WALL)) break;
+
+            SetMazeCell(grid, x, y, MAZE_CELL_FLOOR);
+        }
+    }
+}
+
+// Find chunk slot, -1 if not resident
+// NOTE: Resident chunks are few, slots are scanned linearly, checking last accessed slot first
+static int FindMazeStreamChunk(MazeStream *stream, int chunk_x, int chunk_y)
+{
+    MazeChunk *last = &stream->chunks[stream->last_slot];
+
+    if ((last->state != MAZE_CHUNK_EMPTY) && (last->chunk_x == chunk_x) && (last->chunk_y == chunk_y)) return stream->last_slot;
+
+    for (int i = 0; i < stream->capacity; i++)
+    {
+        MazeChunk *chunk = &stream->chunks[i];
+
+        if ((chunk->state != MAZE_CHUNK_EMPTY) && (chunk->chunk_x == chunk_x) && (chunk->chunk_y == chunk_y))
+        {
+            stream->last_slot = i;
+            return i;
+        }
+    }
+
+    return -1;
+}
+
+// Get free slot, evicting least recently used chunk if required
+// NOTE: Chunks pending generation and chunks required in current frame can not be evicted
+static int GetMazeStreamFreeSlot(MazeStream *stream)
+{
+    int lru = -1;
+
+    for (int i = 0; i < stream->capacity; i++)
+    {
+        MazeChunk *chunk = &stream->chunks[i];
+
+        if (chunk->state == MAZE_CHUNK_EMPTY) return i;
+
+        if ((chunk->state != MAZE_CHUNK_PENDING) && (chunk->last_used != stream->frame) &&
+            ((lru == -1) || (chunk->last_used < stream->chunks[lru].last_used))) lru = i;
+    }
+
+    if (lru != -1)
+    {
+        UnloadMazeStreamChunk(stream, lru);
+        stream->stats.evicted++;
+    }
+
+    return lru;
+}
+
+// Unload chunk cells and texture, freeing slot
+static void UnloadMazeStreamChunk(MazeStream *stream, int slot)
+{
+    MazeChunk *chunk = &stream->chunks[slot];
+
+    if (chunk->state == MAZE_CHUNK_LOADED) UnloadTexture(chunk->texture);
+    if (chunk->state >= MAZE_CHUNK_GENERATED) UnloadMazeGrid(chunk->grid);
+
+    *chunk = (MazeChunk){ 0 };
+}
+
+// Get chunks range visible through camera, limits inclusive
+static void GetMazeStreamView(Camera2D camera, Vector2 position, float scale, int chunk_size, int *min_x, int *min_y, int *max_x, int *max_y)
+{
+    Vector2 corners[4] = {
+        GetScreenToWorld2D((Vector2){ 0, 0 }, camera),
+        GetScreenToWorld2D((Vector2){ (float)GetScreenWidth(), 0 }, camera),
+        GetScreenToWorld2D((Vector2){ 0, (float)GetScreenHeight() }, camera),
+        GetScreenToWorld2D((Vector2){ (float)GetScreenWidth(), (float)GetScreenHeight() }, camera),
+    };
+
+    Vector2 min = corners[0];
+    Vector2 max = corners[0];
+
+    for (int i = 1; i < 4; i++)
+    {
+        if (corners[i].x < min.x) min.x = corners[i].x;
+        if (corners[i].y < min.y) min.y = corners[i].y;
+        if (corners[i].x > max.x) max.x = corners[i].x;
+        if (corners[i].y > max.y) max.y = corners[i].y;
+    }
+
+    float chunk_world = chunk_size*scale;
+
+    *min_x = (int)floorf((min.x - position.x)/chunk_world);
+    *min_y = (int)floorf((min.y - position.y)/chunk_world);
+    *max_x = (int)floorf((max.x - position.x)/chunk_world);
+    *max_y = (int)floorf((max.y - position.y)/chunk_world);
+}
+
+#endif // MAZE_STREAM_IMPLEMENTATION
@@ -0,0 +1,513 @@
+/*******************************************************************************************
+*
+*   maze_system - Platform services for maze modules: threads, synchronization, timing
+*
+*   Thin wrapper over the platform threading API (pthreads or Win32) and a jobs pool
+*   running indexed jobs across all cores, used by maze generation and simulation
+*   modules that must also work without a window (tools, benchmarks)
+*
+*   CONFIGURATION:
+*       #define MAZE_SYSTEM_IMPLEMENTATION
+*           Generates the implementation of the module in the including file,
+*           only one translation unit should define it
+*
+*       #define MAZE_SYSTEM_NO_THREADS
+*           Threads are not available (i.e. PLATFORM_WEB without pthreads), started
+*           threads run synchronously and jobs pools run all jobs on caller thread.
+*           Automatically defined for emscripten builds without pthreads support
+*
+*   NOTE: Module is window-free and does not depend on raylib
+*
+*   Copyright (c) 2024-2025 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#ifndef MAZE_SYSTEM_H
+#define MAZE_SYSTEM_H
+
+#if defined(__EMSCRIPTEN__) && !defined(__EMSCRIPTEN_PTHREADS__) && !defined(MAZE_SYSTEM_NO_THREADS)
+    #define MAZE_SYSTEM_NO_THREADS
+#endif
+
+// Opaque platform types
+typedef struct MazeThread MazeThread;
+typedef struct MazeMutex MazeMutex;
+typedef struct MazeCondition MazeCondition;
+typedef struct MazeJobPool MazeJobPool;
+
+typedef void (*MazeThreadFunc)(void *data);             // Thread entry point
+typedef void (*MazeJobFunc)(void *data, int index);     // Job entry point, index in [0..count)
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+// Threads and synchronization
+MazeThread *StartMazeThread(MazeThreadFunc func, void *data);   // Start thread running func(data)
+void JoinMazeThread(MazeThread *thread);                        // Wait for thread to finish and release it
+MazeMutex *LoadMazeMutex(void);                                 // Load mutex
+void UnloadMazeMutex(MazeMutex *mutex);                         // Unload mutex
+void LockMazeMutex(MazeMutex *mutex);                           // Lock mutex
+void UnlockMazeMutex(MazeMutex *mutex);                         // Unlock mutex
+MazeCondition *LoadMazeCondition(void);                         // Load condition variable
+void UnloadMazeCondition(MazeCondition *cond);                  // Unload condition variable
+void WaitMazeCondition(MazeCondition *cond, MazeMutex *mutex);  // Wait for condition, mutex must be locked
+void SignalMazeCondition(MazeCondition *cond);                  // Wake up one thread waiting for condition
+void BroadcastMazeCondition(MazeCondition *cond);               // Wake up all threads waiting for condition
+
+// Jobs pool
+MazeJobPool *LoadMazeJobPool(int threads);                      // Load jobs pool, threads including caller (0 = all cores)
+void UnloadMazeJobPool(MazeJobPool *pool);                      // Unload jobs pool, stopping its threads
+void RunMazeJobs(MazeJobPool *pool, MazeJobFunc func, void *data, int count); // Run func(data, index) for all indices, returns when all jobs done
+int GetMazeJobPoolThreads(const MazeJobPool *pool);             // Get number of threads running jobs (including caller)
+
+// Misc
+int GetMazeCpuCount(void);                                      // Get number of logical processors available
+double GetMazeTime(void);                                       // Get monotonic time in seconds
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif // MAZE_SYSTEM_H
+
+/***********************************************************************************
+*
+*   MAZE_SYSTEM IMPLEMENTATION
+*
+************************************************************************************/
+
+#if defined(MAZE_SYSTEM_IMPLEMENTATION) && !defined(MAZE_SYSTEM_IMPLEMENTATION_DONE)
+#define MAZE_SYSTEM_IMPLEMENTATION_DONE
+
+#include <stdlib.h>     // Required for: malloc(), calloc(), free()
+
+#if defined(_WIN32)
+    // NOTE: Some windows.h symbols collide with raylib ones (Rectangle, CloseWindow, DrawText...)
+    #define WIN32_LEAN_AND_MEAN
+    #define NOGDI
+    #define NOUSER
+    #include <windows.h>
+#else
+    #include <time.h>           // Required for: clock_gettime()
+    #include <unistd.h>         // Required for: sysconf()
+    #if !defined(MAZE_SYSTEM_NO_THREADS)
+        #include <pthread.h>
+    #endif
+#endif
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+struct MazeThread {
+#if defined(MAZE_SYSTEM_NO_THREADS)
+    int unused;
+#elif defined(_WIN32)
+    HANDLE handle;
+#else
+    pthread_t handle;
+#endif
+    MazeThreadFunc func;
+    void *data;
+};
+
+struct MazeMutex {
+#if defined(MAZE_SYSTEM_NO_THREADS)
+    int unused;
+#elif defined(_WIN32)
+    SRWLOCK lock;
+#else
+    pthread_mutex_t lock;
+#endif
+};
+
+struct MazeCondition {
+#if defined(MAZE_SYSTEM_NO_THREADS)
+    int unused;
+#elif defined(_WIN32)
+    CONDITION_VARIABLE cond;
+#else
+    pthread_cond_t cond;
+#endif
+};
+
+struct MazeJobPool {
+    MazeThread **workers;       // Worker threads (caller thread also runs jobs)
+    int worker_count;           // Number of worker threads
+
+    MazeMutex *mutex;           // Pool state access
+    MazeCondition *work_ready;  // Signaled when new jobs are available or pool is stopping
+    MazeCondition *work_done;   // Signaled when all jobs have been completed
+
+    MazeJobFunc func;           // Current jobs function
+    void *data;                 // Current jobs data
+    int count;                  // Current jobs count
+    int next;                   // Next job index to run
+    int done;                   // Jobs completed
+    int quit;                   // Pool stopping flag
+};
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Declaration
+//----------------------------------------------------------------------------------
+#if defined(_WIN32) && !defined(MAZE_SYSTEM_NO_THREADS)
+static DWORD WINAPI MazeThreadEntry(LPVOID arg);                // Thread entry point wrapper
+#elif !defined(MAZE_SYSTEM_NO_THREADS)
+static void *MazeThreadEntry(void *arg);                        // Thread entry point wrapper
+#endif
+#if !defined(MAZE_SYSTEM_NO_THREADS)
+static void MazeJobWorker(void *data);                          // Jobs pool worker thread loop
+#endif
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition: Threads and synchronization
+//----------------------------------------------------------------------------------
+
+// Start thread running func(data)
+// NOTE: With MAZE_SYSTEM_NO_THREADS, func is run synchronously
+MazeThread *StartMazeThread(MazeThreadFunc func, void *data)
+{
+    MazeThread *thread = (MazeThread *)calloc(1, sizeof(MazeThread));
+
+    if (thread == NULL) return NULL;
+
+    thread->func = func;
+    thread->data = data;
+
+#if defined(MAZE_SYSTEM_NO_THREADS)
+    func(data);
+#elif defined(_WIN32)
+    thread->handle = CreateThread(NULL, 0, MazeThreadEntry, thread, 0, NULL);
+    if (thread->handle == NULL) { free(thread); thread = NULL; }
+#else
+    if (pthread_create(&thread->handle, NULL, MazeThreadEntry, thread) != 0) { free(thread); thread = NULL; }
+#endif
+
+    return thread;
+}
+
+// Wait for thread to finish and release it
+void JoinMazeThread(MazeThread *thread)
+{
+    if (thread == NULL) return;
+
+#if defined(_WIN32) && !defined(MAZE_SYSTEM_NO_THREADS)
+    WaitForSingleObject(thread->handle, INFINITE);
+    CloseHandle(thread->handle);
+#elif !defined(MAZE_SYSTEM_NO_THREADS)
+    pthread_join(thread->handle, NULL);
+#endif
+
+    free(thread);
+}
+
+// Load mutex
+MazeMutex *LoadMazeMutex(void)
+{
+    MazeMutex *mutex = (MazeMutex *)calloc(1, sizeof(MazeMutex));
+
+#if defined(_WIN32) && !defined(MAZE_SYSTEM_NO_THREADS)
+    if (mutex != NULL) InitializeSRWLock(&mutex->lock);
+#elif !defined(MAZE_SYSTEM_NO_THREADS)
+    if (mutex != NULL) pthread_mutex_init(&mutex->lock, NULL);
+#endif
+
+    return mutex;
+}
+
+// Unload mutex
+void UnloadMazeMutex(MazeMutex *mutex)
+{
+    if (mutex == NULL) return;
+
+#if !defined(_WIN32) && !defined(MAZE_SYSTEM_NO_THREADS)
+    pthread_mutex_destroy(&mutex->lock);
+#endif
+
+    free(mutex);
+}
+
+// Lock mutex
+void LockMazeMutex(MazeMutex *mutex)
+{
+#if defined(MAZE_SYSTEM_NO_THREADS)
+    (void)mutex;
+#elif defined(_WIN32)
+    AcquireSRWLockExclusive(&mutex->lock);
+#else
+    pthread_mutex_lock(&mutex->lock);
+#endif
+}
+
+// Unlock mutex
+void UnlockMazeMutex(MazeMutex *mutex)
+{
+#if defined(MAZE_SYSTEM_NO_THREADS)
+    (void)mutex;
+#elif defined(_WIN32)
+    ReleaseSRWLockExclusive(&mutex->lock);
+#else
+    pthread_mutex_unlock(&mutex->lock);
+#endif
+}
+
+// Load condition variable
+MazeCondition *LoadMazeCondition(void)
+{
+    MazeCondition *cond = (MazeCondition *)calloc(1, sizeof(MazeCondition));
+
+#if defined(_WIN32) && !defined(MAZE_SYSTEM_NO_THREADS)
+    if (cond != NULL) InitializeConditionVariable(&cond->cond);
+#elif !defined(MAZE_SYSTEM_NO_THREADS)
+    if (cond != NULL) pthread_cond_init(&cond->cond, NULL);
+#endif
+
+    return cond;
+}
+
+// Unload condition variable
+void UnloadMazeCondition(MazeCondition *cond)
+{
+    if (cond == NULL) return;
+
+#if !defined(_WIN32) && !defined(MAZE_SYSTEM_NO_THREADS)
+    pthread_cond_destroy(&cond->cond);
+#endif
+
+    free(cond);
+}
+
+// Wait for condition, mutex must be locked
+// NOTE: Spurious wake ups are possible, condition must be checked in a loop
+void WaitMazeCondition(MazeCondition *cond, MazeMutex *mutex)
+{
+#if defined(MAZE_SYSTEM_NO_THREADS)
+    (void)cond; (void)mutex;
+#elif defined(_WIN32)
+    SleepConditionVariableSRW(&cond->cond, &mutex->lock, INFINITE, 0);
+#else
+    pthread_cond_wait(&cond->cond, &mutex->lock);
+#endif
+}
+
+// Wake up one thread waiting for condition
+void SignalMazeCondition(MazeCondition *cond)
+{
+#if defined(MAZE_SYSTEM_NO_THREADS)
+    (void)cond;
+#elif defined(_WIN32)
+    WakeConditionVariable(&cond->cond);
+#else
+    pthread_cond_signal(&cond->cond);
+#endif
+}
+
+// Wake up all threads waiting for condition
+void BroadcastMazeCondition(MazeCondition *cond)
+{
+#if defined(MAZE_SYSTEM_NO_THREADS)
+    (void)cond;
+#elif defined(_WIN32)
+    WakeAllConditionVariable(&cond->cond);
+#else
+    pthread_cond_broadcast(&cond->cond);
+#endif
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition: Jobs pool
+//----------------------------------------------------------------------------------
+
+// Load jobs pool, threads including caller (0 = all cores)
+MazeJobPool *LoadMazeJobPool(int threads)
+{
+    MazeJobPool *pool = (MazeJobPool *)calloc(1, sizeof(MazeJobPool));
+
+    if (pool == NULL) return NULL;
+
+    if (threads <= 0) threads = GetMazeCpuCount();
+
+    pool->mutex = LoadMazeMutex();
+    pool->work_ready = LoadMazeCondition();
+    pool->work_done = LoadMazeCondition();
+
+#if !defined(MAZE_SYSTEM_NO_THREADS)
+    // NOTE: Caller thread also runs jobs, so one thread less is required
+    if (threads > 1) pool->workers = (MazeThread **)calloc(threads - 1, sizeof(MazeThread *));
+
+    for (int i = 0; (pool->workers != NULL) && (i < (threads - 1)); i++)
+    {
+        pool->workers[i] = StartMazeThread(MazeJobWorker, pool);
+        if (pool->workers[i] == NULL) break;
+        pool->worker_count++;
+    }
+#endif
+
+    return pool;
+}
+
+// Unload jobs pool, stopping its threads
+void UnloadMazeJobPool(MazeJobPool *pool)
+{
+    if (pool == NULL) return;
+
+    LockMazeMutex(pool->mutex);
+    pool->quit = 1;
+    BroadcastMazeCondition(pool->work_ready);
+    UnlockMazeMutex(pool->mutex);
+
+    for (int i = 0; i < pool->worker_count; i++) JoinMazeThread(pool->workers[i]);
+
+    UnloadMazeCondition(pool->work_done);
+    UnloadMazeCondition(pool->work_ready);
+    UnloadMazeMutex(pool->mutex);
+    free(pool->workers);
+    free(pool);
+}
+
+// Run func(data, index) for all indices, returns when all jobs done
+// NOTE: Jobs are picked in index order but can complete in any order,
+// every job should only write its own results to keep output deterministic
+void RunMazeJobs(MazeJobPool *pool, MazeJobFunc func, void *data, int count)
+{
+    if (count <= 0) return;
+
+    if ((pool == NULL) || (pool->worker_count == 0))
+    {
+        for (int i = 0; i < count; i++) func(data, i);
+        return;
+    }
+
+    LockMazeMutex(pool->mutex);
+
+    pool->func = func;
+    pool->data = data;
+    pool->count = count;
+    pool->next = 0;
+    pool->done = 0;
+    BroadcastMazeCondition(pool->work_ready);
+
+    // Caller thread also runs jobs while waiting
+    while (pool->next < pool->count)
+    {
+        int index = pool->next++;
+
+        UnlockMazeMutex(pool->mutex);
+        func(data, index);
+        LockMazeMutex(pool->mutex);
+
+        pool->done++;
+    }
+
+    while (pool->done < pool->count) WaitMazeCondition(pool->work_done, pool->mutex);
+
+    // Reset jobs, so workers don't pick jobs from a finished batch
+    pool->count = 0;
+    pool->next = 0;
+
+    UnlockMazeMutex(pool->mutex);
+}
+
+// Get number of threads running jobs (including caller)
+int GetMazeJobPoolThreads(const MazeJobPool *pool)
+{
+    return (pool != NULL)? pool->worker_count + 1 : 1;
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition: Misc
+//----------------------------------------------------------------------------------
+
+// Get number of logical processors available
+int GetMazeCpuCount(void)
+{
+    int count = 1;
+
+#if defined(MAZE_SYSTEM_NO_THREADS)
+    count = 1;
+#elif defined(_WIN32)
+    SYSTEM_INFO info = { 0 };
+    GetSystemInfo(&info);
+    count = (int)info.dwNumberOfProcessors;
+#else
+    long online = sysconf(_SC_NPROCESSORS_ONLN);
+    if (online > 0) count = (int)online;
+#endif
+
+    return (count > 0)? count : 1;
+}
+
+// Get monotonic time in seconds
+double GetMazeTime(void)
+{
+#if defined(_WIN32)
+    LARGE_INTEGER frequency = { 0 };
+    LARGE_INTEGER counter = { 0 };
+    QueryPerformanceFrequency(&frequency);
+    QueryPerformanceCounter(&counter);
+
+    return (double)counter.QuadPart/(double)frequency.QuadPart;
+#else
+    struct timespec ts = { 0 };
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (double)ts.tv_sec + (double)ts.tv_nsec*1e-9;
+#endif
+}
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Definition
+//----------------------------------------------------------------------------------
+
+#if defined(_WIN32) && !defined(MAZE_SYSTEM_NO_THREADS)
+// Thread entry point wrapper
+static DWORD WINAPI MazeThreadEntry(LPVOID arg)
+{
+    MazeThread *thread = (MazeThread *)arg;
+    thread->func(thread->data);
+
+    return 0;
+}
+#elif !defined(MAZE_SYSTEM_NO_THREADS)
+// Thread entry point wrapper
+static void *MazeThreadEntry(void *arg)
+{
+    MazeThread *thread = (MazeThread *)arg;
+    thread->func(thread->data);
+
+    return NULL;
+}
+#endif
+
+#if !defined(MAZE_SYSTEM_NO_THREADS)
+// Jobs pool worker thread loop
+static void MazeJobWorker(void *data)
+{
+    MazeJobPool *pool = (MazeJobPool *)data;
+
+    LockMazeMutex(pool->mutex);
+
+    while (!pool->quit)
+    {
+        if (pool->next < pool->count)
+        {
+            // NOTE: Job function and data read with mutex locked, they belong to current batch
+            int index = pool->next++;
+            MazeJobFunc func = pool->func;
+            void *job_data = pool->data;
+
+            UnlockMazeMutex(pool->mutex);
+            func(job_data, index);
+            LockMazeMutex(pool->mutex);
+
+            pool->done++;
+            if (pool->done == pool->count) SignalMazeCondition(pool->work_done);
+        }
+        else WaitMazeCondition(pool->work_ready, pool->mutex);
+    }
+
+    UnlockMazeMutex(pool->mutex);
+}
+#endif
+
+#endif // MAZE_SYSTEM_IMPLEMENTATION
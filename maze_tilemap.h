@@ -0,0 +1,376 @@
+/*******************************************************************************************
+*
+*   maze_tilemap - GPU tilemap maze renderer, one quad drawn for all visible cells
+*
+*   Maze cells are uploaded as a one byte per cell texture (PIXELFORMAT_UNCOMPRESSED_GRAYSCALE):
+*   cell atlas tile (autotiling already solved by maze tiles map) and cell type, packed in
+*   one byte. Tilemap shader reads the cell byte under every pixel and samples its tile from
+*   the biomes atlas, so the whole visible maze is drawn as one textured quad and drawing
+*   cost does not depend on cells visible (only on screen pixels covered)
+*
+*   Cells texture is 4 times smaller than a RGBA cells image texture and it is updated per
+*   changed cell: updated areas are compared against the cells bytes copy kept in memory,
+*   only the bounding rectangle of changed bytes is uploaded (a single byte for one cell).
+*   Cell types in cells texture also provide the zoomed out maze overview (maze_render overview
+*   shader, DrawMazeOverviewTexture()), no other maze texture required by tilemap renderer
+*
+*   Tilemap shader is kept while tilemap is loaded, a new maze only re-creates cells texture,
+*   cells can be unloaded (reset for a grid without cells) while tilemap renderer is not used
+*
+*   Cell byte: bits 0..4 atlas tile (MazeAtlasTile), bits 5..6 cell type (MazeCellType)
+*
+*   CONFIGURATION:
+*       #define MAZE_TILEMAP_IMPLEMENTATION
+*           Generates the implementation of the module in the including file,
+*           only one translation unit should define it
+*
+*   DEPENDENCIES:
+*       raylib, rlgl    - Textures, shaders and texture sub-rectangle updates
+*       maze_grid       - Maze cells data (cell types)
+*       maze_render     - Biomes atlas, maze tiles map and view range
+*
+*   Copyright (c) 2024-2025 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#ifndef MAZE_TILEMAP_H
+#define MAZE_TILEMAP_H
+
+#include "raylib.h"
+#include "maze_grid.h"
+#include "maze_render.h"
+
+#define MAZE_TILEMAP_TYPE_SHIFT     5       // Cell byte, cell type bits shift
+
+// Maze tilemap statistics, last update
+typedef struct MazeTilemapStats {
+    int changed;                // Cells bytes changed
+    int uploaded;               // Bytes uploaded to cells texture
+} MazeTilemapStats;
+
+// Maze tilemap
+typedef struct MazeTilemap {
+    int width;                  // Maze width in cells
+    int height;                 // Maze height in cells
+    unsigned char *cells;       // Cells bytes, copy of cells texture data
+    Texture2D texture;          // Cells texture, one byte per cell (PIXELFORMAT_UNCOMPRESSED_GRAYSCALE)
+
+    Shader shader;              // Tilemap shader, cells atlas tiles looked up per pixel
+    int atlas_loc;              // Shader location: biomes atlas texture
+    int size_loc;               // Shader location: maze size in cells
+    int tile_loc;               // Shader location: biome offset and tile size in atlas
+    int colors_loc;             // Shader location: cell types marking colors
+
+    unsigned char *staging;     // Changed bytes upload buffer
+    int staging_size;           // Upload buffer size in bytes
+
+    MazeTilemapStats stats;
+} MazeTilemap;
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+MazeTilemap LoadMazeTilemap(MazeTiles tiles, MazeGrid grid);        // Load maze tilemap, cells texture uploaded from tiles map and grid (no cells: shader only)
+void UnloadMazeTilemap(MazeTilemap *tilemap);                       // Unload maze tilemap texture, shader and cells bytes
+void ResetMazeTilemap(MazeTilemap *tilemap, MazeTiles tiles, MazeGrid grid); // Reset cells texture for a new maze (can be sized differently, no cells: unloaded), shader kept
+int UpdateMazeTilemap(MazeTilemap *tilemap, MazeTiles tiles, MazeGrid grid, int x, int y, int width, int height); // Update cells area (and area neighbours), returns bytes uploaded
+
+// Draw maze tilemap visible cells as one quad, cell_colors (one per MazeCellType, alpha as amount) can be NULL
+// NOTE: Must be called inside BeginMode2D(camera)
+MazeRenderStats DrawMazeTilemap(MazeTilemap tilemap, MazeAtlas atlas, int biome, Camera2D camera, Vector2 position, float scale, const Color *cell_colors);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif // MAZE_TILEMAP_H
+
+/***********************************************************************************
+*
+*   MAZE_TILEMAP IMPLEMENTATION
+*
+************************************************************************************/
+
+#if defined(MAZE_TILEMAP_IMPLEMENTATION) && !defined(MAZE_TILEMAP_IMPLEMENTATION_DONE)
+#define MAZE_TILEMAP_IMPLEMENTATION_DONE
+
+#include "rlgl.h"       // Required for: rlLoadTexture(), rlUpdateTexture()
+
+#include <stdlib.h>     // Required for: malloc(), realloc(), free()
+
+#if defined(PLATFORM_DESKTOP)
+    #define MAZE_TILEMAP_GLSL_VERSION   330
+#else   // PLATFORM_ANDROID, PLATFORM_WEB
+    #define MAZE_TILEMAP_GLSL_VERSION   100
+#endif
+
+//----------------------------------------------------------------------------------
+// Global Variables Definition
+//----------------------------------------------------------------------------------
+
+// Tilemap shader (raylib default vertex shader): quad texcoords cover visible cells of the cells
+// texture, cell byte read at cell center, atlas tile sampled at pixel position inside the cell
+// NOTE: Cell type marking colors selected without dynamic indexing (not supported by GLSL 100)
+#if (MAZE_TILEMAP_GLSL_VERSION == 330)
+static const char *maze_tilemap_fs =
+    "#version 330\n"
+    "in vec2 fragTexCoord;\n"
+    "in vec4 fragColor;\n"
+    "uniform sampler2D texture0;\n"     // Cells texture
+    "uniform sampler2D atlas;\n"        // Biomes atlas
+    "uniform vec4 colDiffuse;\n"
+    "uniform vec2 mazeSize;\n"          // Maze size in cells
+    "uniform vec4 atlasTile;\n"         // xy: biome offset, zw: tile size (texture coordinates)
+    "uniform vec4 cellColors[4];\n"     // Cell types marking colors, alpha: marking amount
+    "out vec4 finalColor;\n"
+    "void main()\n"
+    "{\n"
+    "    vec2 cell = fragTexCoord*mazeSize;\n"
+    "    float value = floor(texture(texture0, (floor(cell) + 0.5)/mazeSize).r*255.0 + 0.5);\n"
+    "    float tile = mod(value, 32.0);\n"
+    "    float type = floor(value/32.0);\n"
+    "    vec2 origin = atlasTile.xy + vec2(mod(tile, 16.0), floor(tile/16.0))*atlasTile.zw;\n"
+    "    vec4 texel = texture(atlas, origin + fract(cell)*atlasTile.zw);\n"
+    "    vec4 mark = (type < 0.5)? cellColors[0] : (type < 1.5)? cellColors[1] : (type < 2.5)? cellColors[2] : cellColors[3];\n"
+    "    finalColor = vec4(mix(texel.rgb, mark.rgb, mark.a), texel.a)*colDiffuse*fragColor;\n"
+    "}\n";
+#else
+static const char *maze_tilemap_fs =
+    "#version 100\n"
+    "#ifdef GL_FRAGMENT_PRECISION_HIGH\n"     // Cells coordinates on big mazes require high precision
+    "precision highp float;\n"
+    "#else\n"
+    "precision mediump float;\n"
+    "#endif\n"
+    "varying vec2 fragTexCoord;\n"
+    "varying vec4 fragColor;\n"
+    "uniform sampler2D texture0;\n"
+    "uniform sampler2D atlas;\n"
+    "uniform vec4 colDiffuse;\n"
+    "uniform vec2 mazeSize;\n"
+    "uniform vec4 atlasTile;\n"
+    "uniform vec4 cellColors[4];\n"
+    "void main()\n"
+    "{\n"
+    "    vec2 cell = fragTexCoord*mazeSize;\n"
+    "    float value = floor(texture2D(texture0, (floor(cell) + 0.5)/mazeSize).r*255.0 + 0.5);\n"
+    "    float tile = mod(value, 32.0);\n"
+    "    float type = floor(value/32.0);\n"
+    "    vec2 origin = atlasTile.xy + vec2(mod(tile, 16.0), floor(tile/16.0))*atlasTile.zw;\n"
+    "    vec4 texel = texture2D(atlas, origin + fract(cell)*atlasTile.zw);\n"
+    "    vec4 mark = (type < 0.5)? cellColors[0] : (type < 1.5)? cellColors[1] : (type < 2.5)? cellColors[2] : cellColors[3];\n"
+    "    gl_FragColor = vec4(mix(texel.rgb, mark.rgb, mark.a), texel.a)*colDiffuse*fragColor;\n"
+    "}\n";
+#endif
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Declaration
+//----------------------------------------------------------------------------------
+static bool LoadMazeTilemapCells(MazeTilemap *tilemap, MazeTiles tiles, MazeGrid grid); // Load cells bytes and texture for maze
+static void UnloadMazeTilemapCells(MazeTilemap *tilemap);           // Unload cells bytes, texture and upload buffer
+static unsigned char GetMazeTilemapCell(MazeTiles tiles, MazeGrid grid, size_t cell); // Get cell byte: atlas tile and cell type
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+
+// Load maze tilemap, cells texture uploaded from tiles map and grid (no cells: shader only)
+MazeTilemap LoadMazeTilemap(MazeTiles tiles, MazeGrid grid)
+{
+    MazeTilemap tilemap = { 0 };
+
+    if (grid.cells != NULL) LoadMazeTilemapCells(&tilemap, tiles, grid);
+
+    tilemap.shader = LoadShaderFromMemory(NULL, maze_tilemap_fs);
+    tilemap.atlas_loc = GetShaderLocation(tilemap.shader, "atlas");
+    tilemap.size_loc = GetShaderLocation(tilemap.shader, "mazeSize");
+    tilemap.tile_loc = GetShaderLocation(tilemap.shader, "atlasTile");
+    tilemap.colors_loc = GetShaderLocation(tilemap.shader, "cellColors");
+
+    return tilemap;
+}
+
+// Unload maze tilemap texture, shader and cells bytes
+void UnloadMazeTilemap(MazeTilemap *tilemap)
+{
+    UnloadMazeTilemapCells(tilemap);
+    if (tilemap->shader.id > 0) UnloadShader(tilemap->shader);
+
+    *tilemap = (MazeTilemap){ 0 };
+}
+
+// Reset cells texture for a new maze (can be sized differently, no cells: unloaded), shader kept
+void ResetMazeTilemap(MazeTilemap *tilemap, MazeTiles tiles, MazeGrid grid)
+{
+    if (tilemap->shader.id == 0) return;
+
+    UnloadMazeTilemapCells(tilemap);
+    LoadMazeTilemapCells(tilemap, tiles, grid);
+}
+
+// Update cells area (and area neighbours), returns bytes uploaded
+// NOTE: Only the bounding rectangle of changed bytes is uploaded, area neighbours included
+// because their atlas tile depends on area cells (walls autotiling)
+int UpdateMazeTilemap(MazeTilemap *tilemap, MazeTiles tiles, MazeGrid grid, int x, int y, int width, int height)
+{
+    tilemap->stats = (MazeTilemapStats){ 0 };
+
+    if ((tilemap->cells == NULL) || (grid.width != tilemap->width) || (grid.height != tilemap->height) ||
+        (tiles.width != tilemap->width) || (tiles.height != tilemap->height)) return 0;
+
+    int min_x = (x > 0)? x - 1 : 0;
+    int min_y = (y > 0)? y - 1 : 0;
+    int max_x = (x + width < tilemap->width)? x + width : tilemap->width - 1;
+    int max_y = (y + height < tilemap->height)? y + height : tilemap->height - 1;
+
+    // Changed bytes bounding rectangle
+    int changed_min_x = max_x + 1;
+    int changed_min_y = max_y + 1;
+    int changed_max_x = -1;
+    int changed_max_y = -1;
+
+    for (int cy = min_y; cy <= max_y; cy++)
+    {
+        for (int cx = min_x; cx <= max_x; cx++)
+        {
+            size_t cell = (size_t)cy*tilemap->width + cx;
+            unsigned char value = GetMazeTilemapCell(tiles, grid, cell);
+
+            if (tilemap->cells[cell] == value) continue;
+
+            tilemap->cells[cell] = value;
+            tilemap->stats.changed++;
+
+            if (cx < changed_min_x) changed_min_x = cx;
+            if (cx > changed_max_x) changed_max_x = cx;
+            if (cy < changed_min_y) changed_min_y = cy;
+            if (cy > changed_max_y) changed_max_y = cy;
+        }
+    }
+
+    if (tilemap->stats.changed == 0) return 0;
+
+    int rect_width = changed_max_x - changed_min_x + 1;
+    int rect_height = changed_max_y - changed_min_y + 1;
+    int size = rect_width*rect_height;
+
+    // Changed rectangle rows packed into upload buffer, grown as required
+    if (size > tilemap->staging_size)
+    {
+        unsigned char *staging = (unsigned char *)realloc(tilemap->staging, size);
+        if (staging == NULL) return 0;
+
+        tilemap->staging = staging;
+        tilemap->staging_size = size;
+    }
+
+    for (int row = 0; row < rect_height; row++)
+    {
+        const unsigned char *cells = &tilemap->cells[(size_t)(changed_min_y + row)*tilemap->width + changed_min_x];
+        for (int i = 0; i < rect_width; i++) tilemap->staging[row*rect_width + i] = cells[i];
+    }
+
+    rlUpdateTexture(tilemap->texture.id, changed_min_x, changed_min_y, rect_width, rect_height, tilemap->texture.format, tilemap->staging);
+    tilemap->stats.uploaded = size;
+
+    return size;
+}
+
+// Draw maze tilemap visible cells as one quad, cell_colors (one per MazeCellType, alpha as amount) can be NULL
+// NOTE: Quad only covers visible cells, atlas bound as second texture for the quad draw
+MazeRenderStats DrawMazeTilemap(MazeTilemap tilemap, MazeAtlas atlas, int biome, Camera2D camera, Vector2 position, float scale, const Color *cell_colors)
+{
+    MazeRenderStats stats = { 0 };
+    MazeViewRange range = GetMazeViewRange((MazeGrid){ tilemap.width, tilemap.height, NULL }, camera, position, scale);
+
+    if ((range.min_x > range.max_x) || (range.min_y > range.max_y) || (tilemap.texture.id == 0) || (atlas.texture.id == 0)) return stats;
+    if ((biome < 0) || (biome >= atlas.biome_count)) biome = 0;
+
+    float tile_u = (float)atlas.tile_size/atlas.texture.width;
+    float tile_v = (float)atlas.tile_size/atlas.texture.height;
+    float atlas_tile[4] = { 0.0f, biome*MAZE_ATLAS_BIOME_ROWS*tile_v, tile_u, tile_v };
+    float maze_size[2] = { (float)tilemap.width, (float)tilemap.height };
+    float colors[4][4] = { 0 };
+
+    for (int i = 0; (cell_colors != NULL) && (i < 4); i++)
+    {
+        colors[i][0] = cell_colors[i].r/255.0f;
+        colors[i][1] = cell_colors[i].g/255.0f;
+        colors[i][2] = cell_colors[i].b/255.0f;
+        colors[i][3] = cell_colors[i].a/255.0f;
+    }
+
+    // NOTE: Shader mode flushes previous draws, uniforms set before the quad is batched
+    BeginShaderMode(tilemap.shader);
+
+        SetShaderValueTexture(tilemap.shader, tilemap.atlas_loc, atlas.texture);
+        SetShaderValue(tilemap.shader, tilemap.size_loc, maze_size, SHADER_UNIFORM_VEC2);
+        SetShaderValue(tilemap.shader, tilemap.tile_loc, atlas_tile, SHADER_UNIFORM_VEC4);
+        SetShaderValueV(tilemap.shader, tilemap.colors_loc, colors, SHADER_UNIFORM_VEC4, 4);
+
+        Rectangle source = { (float)range.min_x, (float)range.min_y, (float)(range.max_x - range.min_x + 1), (float)(range.max_y - range.min_y + 1) };
+        Rectangle dest = { position.x + source.x*scale, position.y + source.y*scale, source.width*scale, source.height*scale };
+
+        DrawTexturePro(tilemap.texture, source, dest, (Vector2){ 0.0f, 0.0f }, 0.0f, WHITE);
+
+    EndShaderMode();
+
+    stats.visible_tiles = (int)(source.width*source.height);
+    stats.draw_calls = 1;
+
+    return stats;
+}
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Definition
+//----------------------------------------------------------------------------------
+
+// Load cells bytes and texture for maze
+static bool LoadMazeTilemapCells(MazeTilemap *tilemap, MazeTiles tiles, MazeGrid grid)
+{
+    if ((grid.cells == NULL) || (tiles.tiles == NULL) || (tiles.width != grid.width) || (tiles.height != grid.height)) return false;
+
+    size_t count = (size_t)grid.width*grid.height;
+    tilemap->cells = (unsigned char *)malloc(count);
+
+    if (tilemap->cells == NULL) return false;
+
+    tilemap->width = grid.width;
+    tilemap->height = grid.height;
+
+    for (size_t i = 0; i < count; i++) tilemap->cells[i] = GetMazeTilemapCell(tiles, grid, i);
+
+    tilemap->texture.id = rlLoadTexture(tilemap->cells, grid.width, grid.height, PIXELFORMAT_UNCOMPRESSED_GRAYSCALE, 1);
+    tilemap->texture.width = grid.width;
+    tilemap->texture.height = grid.height;
+    tilemap->texture.mipmaps = 1;
+    tilemap->texture.format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE;
+
+    return true;
+}
+
+// Unload cells bytes, texture and upload buffer
+static void UnloadMazeTilemapCells(MazeTilemap *tilemap)
+{
+    if (tilemap->texture.id > 0) UnloadTexture(tilemap->texture);
+
+    free(tilemap->cells);
+    free(tilemap->staging);
+
+    tilemap->cells = NULL;
+    tilemap->staging = NULL;
+    tilemap->staging_size = 0;
+    tilemap->texture = (Texture2D){ 0 };
+    tilemap->width = 0;
+    tilemap->height = 0;
+    tilemap->stats = (MazeTilemapStats){ 0 };
+}
+
+// Get cell byte: atlas tile and cell type
+static unsigned char GetMazeTilemapCell(MazeTiles tiles, MazeGrid grid, size_t cell)
+{
+    return (unsigned char)((tiles.tiles[cell] & 0x1f) | ((grid.cells[cell] & 0x03) << MAZE_TILEMAP_TYPE_SHIFT));
+}
+
+#endif // MAZE_TILEMAP_IMPLEMENTATION
@@ -0,0 +1,426 @@
+/*******************************************************************************************
+*
+*   maze_undo - Editor undo/redo history, using sparse cell edits logs
+*
+*   Every edit command (i.e. a mouse stroke, from button press to release) is recorded as a
+*   list of cells run edits (first cell, run length, value before, value after): consecutive
+*   cells of a row with the same values take one edit, so history memory is proportional to
+*   the runs changed, not to the cells changed (a filled rectangle takes one edit per row).
+*   All edits recorded while a command is open are merged into that command. History memory
+*   is limited: edits and commands are kept in fixed-size ring buffers, oldest commands are
+*   evicted when required
+*
+*   Undo/redo applies the command edits through a callback (one call per run), so the caller
+*   keeps all maze data in sync (cells, items, dirty regions, path) and only the edited cells
+*   are updated
+*
+*   Edit values combine cell type and item type, so items painted over are restored with
+*   their type: value = cell type | (item type << 2)
+*
+*   CONFIGURATION:
+*       #define MAZE_UNDO_IMPLEMENTATION
+*           Generates the implementation of the module in the including file,
+*           only one translation unit should define it
+*
+*   DEPENDENCIES:
+*       maze_grid       - Maze cells data
+*       maze_items      - Items type, for edit values
+*       maze_edit       - Edit batch spans, recorded as runs
+*
+*   NOTE: Module is window-free and does not depend on raylib
+*
+*   Copyright (c) 2024-2025 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#ifndef MAZE_UNDO_H
+#define MAZE_UNDO_H
+
+#include "maze_grid.h"
+#include "maze_items.h"
+#include "maze_edit.h"
+
+#define MAZE_UNDO_RUN_MAX           65535   // Cells run edit max length
+
+// Maze cells run edit, consecutive cells of a row with same values
+typedef struct MazeCellEdit {
+    unsigned int cell;          // First cell index (y*width + x)
+    unsigned short length;      // Number of cells
+    unsigned char before;       // Cells value before edit
+    unsigned char after;        // Cells value after edit
+} MazeCellEdit;
+
+// Maze edit command, edits range in edits ring buffer
+typedef struct MazeEditCommand {
+    unsigned long long first;   // First edit position (absolute, not wrapped)
+    unsigned int count;         // Number of edits
+} MazeEditCommand;
+
+// Maze undo history statistics
+typedef struct MazeUndoStats {
+    int commands;               // Commands in history (undo and redo)
+    int edits;                  // Edits in history
+    int evicted;                // Commands evicted since history loading
+    size_t memory;              // Memory used by history buffers
+} MazeUndoStats;
+
+// Maze undo history
+typedef struct MazeUndo {
+    int width;                  // Maze width, cells index to coordinates
+
+    MazeCellEdit *edits;        // Edits ring buffer
+    int edit_capacity;          // Edits ring buffer size
+    unsigned long long edit_begin; // First edit kept (absolute position)
+    unsigned long long edit_end;   // Next edit position (absolute position)
+
+    MazeEditCommand *commands;  // Commands ring buffer
+    int command_capacity;       // Commands ring buffer size
+    unsigned long long command_begin;   // Oldest command kept (absolute position)
+    unsigned long long command_current; // Next command to redo, commands before it can be undone
+    unsigned long long command_end;     // Next command position (absolute position)
+
+    bool open;                  // Command open, edits are recorded into it
+    bool started;               // Open command added to history (first edit recorded)
+    bool overflow;              // Open command bigger than history, not recorded
+
+    MazeUndoStats stats;        // History statistics
+} MazeUndo;
+
+// Cells run edit apply callback, value must be set to row cells (x, y) to (x + length - 1, y)
+typedef void (*MazeEditApplyFunc)(void *data, int x, int y, int length, int value);
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+MazeUndo LoadMazeUndo(int width, size_t memory_limit);              // Load undo history for maze width, limited to memory_limit bytes
+void UnloadMazeUndo(MazeUndo *undo);                                // Unload undo history
+void ClearMazeUndo(MazeUndo *undo, int width);                      // Clear undo history (i.e. maze replaced), new maze width
+
+void BeginMazeEdit(MazeUndo *undo);                                 // Begin edit command, following edits merged into it
+void RecordMazeEdit(MazeUndo *undo, int x, int y, int before, int after); // Record cell edit into open command (ignored if values are the same)
+void RecordMazeEditSpan(MazeUndo *undo, int x, int y, int length, int before, int after); // Record row cells run edit into open command (same values for all cells)
+void RecordMazeEditBatch(MazeUndo *undo, MazeItems *items, const MazeEditBatch *batch); // Record painted edit batch into open command (one edit per span), items storage kept in sync
+void EndMazeEdit(MazeUndo *undo);                                   // End edit command, empty commands are discarded
+
+int UndoMazeEdit(MazeUndo *undo, MazeEditApplyFunc apply, void *data); // Undo last command, returns cells edited
+int RedoMazeEdit(MazeUndo *undo, MazeEditApplyFunc apply, void *data); // Redo last undone command, returns cells edited
+bool CanUndoMazeEdit(const MazeUndo *undo);                         // Check if there is a command to undo
+bool CanRedoMazeEdit(const MazeUndo *undo);                         // Check if there is a command to redo
+
+int GetMazeEditValue(MazeGrid grid, const MazeItems *items, int x, int y); // Get cell edit value (cell type and item type)
+bool SetMazeEditValue(MazeGrid *grid, MazeItems *items, int x, int y, int value); // Set cell edit value, returns true if cell changed
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif // MAZE_UNDO_H
+
+/***********************************************************************************
+*
+*   MAZE_UNDO IMPLEMENTATION
+*
+************************************************************************************/
+
+#if defined(MAZE_UNDO_IMPLEMENTATION) && !defined(MAZE_UNDO_IMPLEMENTATION_DONE)
+#define MAZE_UNDO_IMPLEMENTATION_DONE
+
+#include <stdlib.h>     // Required for: malloc(), free()
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Declaration
+//----------------------------------------------------------------------------------
+static void EvictMazeEditCommand(MazeUndo *undo);                   // Evict oldest command from history
+static void UpdateMazeUndoStats(MazeUndo *undo);                    // Update history statistics
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+
+// Load undo history for maze width, limited to memory_limit bytes
+// NOTE: Memory split between edits (7/8) and commands (1/8) ring buffers
+MazeUndo LoadMazeUndo(int width, size_t memory_limit)
+{
+    MazeUndo undo = { 0 };
+
+    int edit_capacity = (int)((memory_limit/8*7)/sizeof(MazeCellEdit));
+    int command_capacity = (int)((memory_limit/8)/sizeof(MazeEditCommand));
+
+    if ((width <= 0) || (edit_capacity < 1) || (command_capacity < 1)) return undo;
+
+    undo.edits = (MazeCellEdit *)malloc((size_t)edit_capacity*sizeof(MazeCellEdit));
+    undo.commands = (MazeEditCommand *)malloc((size_t)command_capacity*sizeof(MazeEditCommand));
+
+    if ((undo.edits == NULL) || (undo.commands == NULL))
+    {
+        free(undo.edits);
+        free(undo.commands);
+        return (MazeUndo){ 0 };
+    }
+
+    undo.width = width;
+    undo.edit_capacity = edit_capacity;
+    undo.command_capacity = command_capacity;
+    UpdateMazeUndoStats(&undo);
+
+    return undo;
+}
+
+// Unload undo history
+void UnloadMazeUndo(MazeUndo *undo)
+{
+    free(undo->edits);
+    free(undo->commands);
+
+    *undo = (MazeUndo){ 0 };
+}
+
+// Clear undo history (i.e. maze replaced), new maze width
+void ClearMazeUndo(MazeUndo *undo, int width)
+{
+    undo->width = width;
+    undo->edit_begin = undo->edit_end = 0;
+    undo->command_begin = undo->command_current = undo->command_end = 0;
+    undo->open = false;
+    undo->started = false;
+    undo->overflow = false;
+    UpdateMazeUndoStats(undo);
+}
+
+// Begin edit command, following edits merged into it
+// NOTE: Command is only added to history when its first edit is recorded
+void BeginMazeEdit(MazeUndo *undo)
+{
+    if (undo->open || (undo->edits == NULL)) return;
+
+    undo->open = true;
+    undo->started = false;
+    undo->overflow = false;
+}
+
+// Record cell edit into open command (ignored if values are the same)
+void RecordMazeEdit(MazeUndo *undo, int x, int y, int before, int after)
+{
+    RecordMazeEditSpan(undo, x, y, 1, before, after);
+}
+
+// Record row cells run edit into open command (same values for all cells)
+// NOTE: Run merged into previous edit if it continues it (same row and values), long runs split
+void RecordMazeEditSpan(MazeUndo *undo, int x, int y, int length, int before, int after)
+{
+    if (!undo->open || undo->overflow || (before == after) || (length <= 0)) return;
+
+    if (!undo->started)
+    {
+        // Commands that could be redone are discarded, new command added
+        undo->command_end = undo->command_current;
+        undo->edit_end = (undo->command_current > undo->command_begin)? undo->commands[(undo->command_current - 1)%undo->command_capacity].first +
+            undo->commands[(undo->command_current - 1)%undo->command_capacity].count : undo->edit_begin;
+
+        if ((undo->command_end - undo->command_begin) == (unsigned long long)undo->command_capacity) EvictMazeEditCommand(undo);
+
+        undo->commands[undo->command_end%undo->command_capacity] = (MazeEditCommand){ undo->edit_end, 0 };
+        undo->command_end++;
+        undo->command_current = undo->command_end;
+        undo->started = true;
+    }
+
+    MazeEditCommand *command = &undo->commands[(undo->command_end - 1)%undo->command_capacity];
+    unsigned int cell = (unsigned int)((size_t)y*undo->width + x);
+
+    if (command->count > 0)
+    {
+        MazeCellEdit *last = &undo->edits[(undo->edit_end - 1)%undo->edit_capacity];
+
+        if ((last->before == before) && (last->after == after) && ((last->cell + last->length) == cell) &&
+            ((last->cell/undo->width) == (unsigned int)y) && (last->length < MAZE_UNDO_RUN_MAX))
+        {
+            int merged = ((last->length + length) > MAZE_UNDO_RUN_MAX)? MAZE_UNDO_RUN_MAX - last->length : length;
+
+            last->length += (unsigned short)merged;
+            cell += merged;
+            length -= merged;
+        }
+    }
+
+    while (length > 0)
+    {
+        // Oldest commands evicted until the edit fits, open command is never evicted
+        while ((undo->edit_end - undo->edit_begin) == (unsigned long long)undo->edit_capacity)
+        {
+            if ((undo->command_end - undo->command_begin) > 1) EvictMazeEditCommand(undo);
+            else
+            {
+                // Open command bigger than history: command removed, following edits not recorded
+                undo->command_end--;
+                undo->command_current = undo->command_end;
+                undo->edit_end = undo->edit_begin;
+                undo->stats.evicted++;
+                undo->overflow = true;
+                return;
+            }
+        }
+
+        int run = (length > MAZE_UNDO_RUN_MAX)? MAZE_UNDO_RUN_MAX : length;
+
+        undo->edits[undo->edit_end%undo->edit_capacity] = (MazeCellEdit){ cell, (unsigned short)run, (unsigned char)before, (unsigned char)after };
+        undo->edit_end++;
+        command->count++;
+        cell += run;
+        length -= run;
+    }
+}
+
+// Record painted edit batch into open command (one edit per span), items storage kept in sync
+// NOTE: Batch cells already painted, items storage still not updated. Only spans painted over
+// items query items storage for previous item type, recorded per cell (runs merged when possible)
+void RecordMazeEditBatch(MazeUndo *undo, MazeItems *items, const MazeEditBatch *batch)
+{
+    int type = batch->value & 0x03;
+
+    for (int i = 0; i < batch->span_count; i++)
+    {
+        MazeEditSpan span = batch->spans[i];
+
+        if ((span.before == MAZE_CELL_ITEM) && (items != NULL))
+        {
+            for (int x = span.x; x < (span.x + span.length); x++)
+            {
+                int before = span.before;
+                MazeItemHandle item = GetMazeItemAt(items, x, span.y);
+                if (IsMazeItemValid(items, item)) before |= GetMazeItemType(items, item) << 2;
+
+                if (type != MAZE_CELL_ITEM) RemoveMazeItem(items, item);
+                RecordMazeEdit(undo, x, span.y, before, batch->value);
+            }
+        }
+        else RecordMazeEditSpan(undo, span.x, span.y, span.length, span.before, batch->value);
+
+        if ((type == MAZE_CELL_ITEM) && (items != NULL))
+        {
+            for (int x = span.x; x < (span.x + span.length); x++) AddMazeItem(items, x, span.y, batch->value >> 2);
+        }
+    }
+}
+
+// End edit command, empty commands are discarded
+void EndMazeEdit(MazeUndo *undo)
+{
+    undo->open = false;
+    undo->started = false;
+    undo->overflow = false;
+    UpdateMazeUndoStats(undo);
+}
+
+// Undo last command, returns cells edited
+// NOTE: Edits applied in reverse order, so cells edited more than once get their first value
+int UndoMazeEdit(MazeUndo *undo, MazeEditApplyFunc apply, void *data)
+{
+    if (undo->open) EndMazeEdit(undo);
+    if (!CanUndoMazeEdit(undo)) return 0;
+
+    undo->command_current--;
+    MazeEditCommand command = undo->commands[undo->command_current%undo->command_capacity];
+    int cells = 0;
+
+    for (unsigned int i = command.count; i > 0; i--)
+    {
+        MazeCellEdit edit = undo->edits[(command.first + i - 1)%undo->edit_capacity];
+        apply(data, (int)(edit.cell%undo->width), (int)(edit.cell/undo->width), edit.length, edit.before);
+        cells += edit.length;
+    }
+
+    return cells;
+}
+
+// Redo last undone command, returns cells edited
+int RedoMazeEdit(MazeUndo *undo, MazeEditApplyFunc apply, void *data)
+{
+    if (undo->open) EndMazeEdit(undo);
+    if (!CanRedoMazeEdit(undo)) return 0;
+
+    MazeEditCommand command = undo->commands[undo->command_current%undo->command_capacity];
+    undo->command_current++;
+    int cells = 0;
+
+    for (unsigned int i = 0; i < command.count; i++)
+    {
+        MazeCellEdit edit = undo->edits[(command.first + i)%undo->edit_capacity];
+        apply(data, (int)(edit.cell%undo->width), (int)(edit.cell/undo->width), edit.length, edit.after);
+        cells += edit.length;
+    }
+
+    return cells;
+}
+
+// Check if there is a command to undo
+bool CanUndoMazeEdit(const MazeUndo *undo)
+{
+    return (undo->command_current > undo->command_begin);
+}
+
+// Check if there is a command to redo
+bool CanRedoMazeEdit(const MazeUndo *undo)
+{
+    return (undo->command_current < undo->command_end);
+}
+
+// Get cell edit value (cell type and item type)
+int GetMazeEditValue(MazeGrid grid, const MazeItems *items, int x, int y)
+{
+    int cell = GetMazeCell(grid, x, y);
+    int item_type = 0;
+
+    if ((cell == MAZE_CELL_ITEM) && (items != NULL))
+    {
+        item_type = GetMazeItemType(items, GetMazeItemAt(items, x, y));
+        if (item_type < 0) item_type = 0;
+    }
+
+    return cell | (item_type << 2);
+}
+
+// Set cell edit value, returns true if cell changed
+// NOTE: Items storage kept in sync, items painted over are removed
+bool SetMazeEditValue(MazeGrid *grid, MazeItems *items, int x, int y, int value)
+{
+    int before = GetMazeEditValue(*grid, items, x, y);
+    int cell = value & 0x03;
+
+    if ((before == value) || (x < 0) || (x >= grid->width) || (y < 0) || (y >= grid->height)) return false;
+
+    if (items != NULL)
+    {
+        if (((before & 0x03) == MAZE_CELL_ITEM) && (cell != MAZE_CELL_ITEM)) RemoveMazeItem(items, GetMazeItemAt(items, x, y));
+        if (cell == MAZE_CELL_ITEM) AddMazeItem(items, x, y, value >> 2);
+    }
+
+    SetMazeCell(grid, x, y, cell);
+
+    return true;
+}
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Definition
+//----------------------------------------------------------------------------------
+
+// Evict oldest command from history
+static void EvictMazeEditCommand(MazeUndo *undo)
+{
+    undo->command_begin++;
+    if (undo->command_current < undo->command_begin) undo->command_current = undo->command_begin;
+
+    undo->edit_begin = (undo->command_begin < undo->command_end)? undo->commands[undo->command_begin%undo->command_capacity].first : undo->edit_end;
+    undo->stats.evicted++;
+}
+
+// Update history statistics
+static void UpdateMazeUndoStats(MazeUndo *undo)
+{
+    undo->stats.commands = (int)(undo->command_end - undo->command_begin);
+    undo->stats.edits = (int)(undo->edit_end - undo->edit_begin);
+    undo->stats.memory = (size_t)undo->edit_capacity*sizeof(MazeCellEdit) + (size_t)undo->command_capacity*sizeof(MazeEditCommand);
+}
+
+#endif // MAZE_UNDO_IMPLEMENTATION
@@ -0,0 +1,299 @@
+/*******************************************************************************************
+*
+*   maze_batch - Headless multi-threaded maze generator
+*
+*   Generates a batch of mazes for a range of seeds, distributed across all cores, and
+*   saves them to disk as PBM images (1 bit per cell, black = wall) or maze files (-f maze,
+*   loadable by the game: maze_game maze_37867.maze). Every maze uses its
+*   own random generator state, so output is the same than the game for the same seed
+*   and does not depend on the number of threads used
+*
+*   Very big mazes can be generated in chunks (-t chunk_size), every maze split into square
+*   chunks generated in parallel and stitched together; chunked mazes are deterministic for
+*   any number of threads but they are not the same than the game ones for the same seed
+*
+*   Generation algorithm can be selected (-a): grid (default, same than the game), backtracker,
+*   wilson or eller. Eller's mazes are streamed to disk row by row as they are generated, so
+*   arbitrarily tall mazes only require memory for one row
+*
+*   USAGE:
+*       maze_batch [-o dir] [-s seed] [-n count] [-k step] [-w width] [-h height]
+*                  [-r spacing_rows] [-c spacing_cols] [-p chance] [-j threads] [-t chunk_size]
+*                  [-f pbm|maze] [-a grid|backtracker|wilson|eller]
+*
+*   EXAMPLE: Same maze generated by the game on startup
+*       maze_batch -s 37867 -w 64 -h 64 -r 4 -c 4 -p 0.75
+*
+*   EXAMPLE: One 32768x32768 maze, generated in 512x512 chunks using all cores
+*       maze_batch -w 32768 -h 32768 -t 512
+*
+*   EXAMPLE: One 1001x1000001 maze, streamed to disk using Eller's algorithm
+*       maze_batch -w 1001 -h 1000001 -a eller -f maze
+*
+*   Copyright (c) 2024-2025 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#define MAZE_GRID_IMPLEMENTATION
+#include "maze_grid.h"
+
+#define MAZE_SYSTEM_IMPLEMENTATION
+#include "maze_system.h"
+
+#define MAZE_GEN_IMPLEMENTATION
+#include "maze_gen.h"
+
+#define MAZE_ALGO_IMPLEMENTATION
+#include "maze_algo.h"
+
+#define MAZE_ITEMS_IMPLEMENTATION
+#include "maze_items.h"
+
+#define MAZE_FILE_IMPLEMENTATION
+#include "maze_file.h"
+
+#include <stdio.h>      // Required for: printf(), fprintf(), fopen(), fwrite(), fclose()
+#include <stdlib.h>     // Required for: atoi(), atof(), calloc(), free()
+#include <string.h>     // Required for: strcmp(), memset(), memcpy()
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+
+// Batch generation settings and results
+typedef struct MazeBatch {
+    const char *output_dir;     // Output directory
+    int first_seed;             // First seed to generate
+    int seed_step;              // Seed increment between mazes
+    int count;                  // Number of mazes to generate
+    int width;                  // Maze width
+    int height;                 // Maze height
+    int spacing_rows;           // Maze points spacing, rows
+    int spacing_cols;           // Maze points spacing, columns
+    float point_chance;         // Maze point chance
+    int threads;                // Threads used (0 = all cores)
+    int chunk_size;             // Chunk size for chunked generation (0 = not chunked)
+    bool maze_format;           // Save mazes as maze files instead of PBM images
+    int algorithm;              // Generation algorithm (MazeAlgorithm)
+    MazeJobPool *pool;          // Jobs pool, used by chunked generation
+
+    int *failed;                // Generation or saving failed, per maze
+} MazeBatch;
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+static void GenMazeBatchJob(void *data, int index);                 // Generate and save one maze of the batch
+static bool SaveMazePBM(const char *fileName, int width, int height, MazeRowFunc next_row, void *data); // Save maze rows as PBM image (black = wall)
+static bool GetMazeGridRow(void *data, unsigned char *cells);       // Maze rows provider, maze grid rows
+static bool GetMazeEllerRow(void *data, unsigned char *cells);      // Maze rows provider, Eller's streaming generation
+
+//----------------------------------------------------------------------------------
+// Program main entry point
+//----------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+    MazeBatch batch = {
+        .output_dir = ".",
+        .first_seed = 37867,
+        .seed_step = 1,
+        .count = 1,
+        .width = 64,
+        .height = 64,
+        .spacing_rows = 4,
+        .spacing_cols = 4,
+        .point_chance = 0.75f,
+        .threads = 0,
+        .chunk_size = 0,
+    };
+
+    for (int i = 1; i < argc; i++)
+    {
+        if ((strcmp(argv[i], "--help") == 0) || ((i + 1) >= argc))
+        {
+            printf("USAGE: maze_batch [-o dir] [-s seed] [-n count] [-k step] [-w width] [-h height]\n");
+            printf("                  [-r spacing_rows] [-c spacing_cols] [-p chance] [-j threads] [-t chunk_size]\n");
+            printf("                  [-f pbm|maze] [-a grid|backtracker|wilson|eller]\n");
+            return (strcmp(argv[i], "--help") == 0)? 0 : 1;
+        }
+
+        if (strcmp(argv[i], "-o") == 0) batch.output_dir = argv[++i];
+        else if (strcmp(argv[i], "-s") == 0) batch.first_seed = atoi(argv[++i]);
+        else if (strcmp(argv[i], "-n") == 0) batch.count = atoi(argv[++i]);
+        else if (strcmp(argv[i], "-k") == 0) batch.seed_step = atoi(argv[++i]);
+        else if (strcmp(argv[i], "-w") == 0) batch.width = atoi(argv[++i]);
+        else if (strcmp(argv[i], "-h") == 0) batch.height = atoi(argv[++i]);
+        else if (strcmp(argv[i], "-r") == 0) batch.spacing_rows = atoi(argv[++i]);
+        else if (strcmp(argv[i], "-c") == 0) batch.spacing_cols = atoi(argv[++i]);
+        else if (strcmp(argv[i], "-p") == 0) batch.point_chance = (float)atof(argv[++i]);
+        else if (strcmp(argv[i], "-j") == 0) batch.threads = atoi(argv[++i]);
+        else if (strcmp(argv[i], "-t") == 0) batch.chunk_size = atoi(argv[++i]);
+        else if (strcmp(argv[i], "-f") == 0) batch.maze_format = (strcmp(argv[++i], "maze") == 0);
+        else if (strcmp(argv[i], "-a") == 0)
+        {
+            i++;
+            batch.algorithm = -1;
+            for (int a = 0; a < MAZE_ALGORITHM_COUNT; a++) if (strcmp(argv[i], GetMazeGenerator(a)->name) == 0) batch.algorithm = a;
+        }
+        else
+        {
+            fprintf(stderr, "ERROR: Unknown option: %s\n", argv[i]);
+            return 1;
+        }
+    }
+
+    if ((batch.count <= 0) || (batch.width < 3) || (batch.height < 3) || (batch.spacing_rows <= 0) || (batch.spacing_cols <= 0) ||
+        (GetMazeGenerator(batch.algorithm) == NULL) || ((batch.chunk_size > 0) && (batch.algorithm != MAZE_ALGORITHM_GRID)))
+    {
+        fprintf(stderr, "ERROR: Invalid batch parameters\n");
+        return 1;
+    }
+
+    batch.failed = (int *)calloc(batch.count, sizeof(int));
+
+    MazeJobPool *pool = LoadMazeJobPool(batch.threads);
+
+    printf("INFO: Generating %i mazes [%ix%i] using %s algorithm and %i threads\n", batch.count, batch.width, batch.height,
+        GetMazeGenerator(batch.algorithm)->name, GetMazeJobPoolThreads(pool));
+
+    double start_time = GetMazeTime();
+
+    if (batch.chunk_size > 0)
+    {
+        // NOTE: Mazes generated one after another, chunks of every maze distributed across threads
+        batch.pool = pool;
+        for (int i = 0; i < batch.count; i++) GenMazeBatchJob(&batch, i);
+    }
+    else RunMazeJobs(pool, GenMazeBatchJob, &batch, batch.count);
+
+    double elapsed = GetMazeTime() - start_time;
+
+    UnloadMazeJobPool(pool);
+
+    int failed_count = 0;
+    for (int i = 0; i < batch.count; i++)
+    {
+        if (batch.failed[i])
+        {
+            fprintf(stderr, "ERROR: Maze for seed %i could not be generated or saved\n", batch.first_seed + i*batch.seed_step);
+            failed_count++;
+        }
+    }
+
+    free(batch.failed);
+
+    printf("INFO: Generated %i mazes in %.3f s (%.1f mazes/s)\n", batch.count - failed_count, elapsed, (double)(batch.count - failed_count)/elapsed);
+
+    return (failed_count > 0)? 1 : 0;
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+
+// Generate and save one maze of the batch
+static void GenMazeBatchJob(void *data, int index)
+{
+    MazeBatch *batch = (MazeBatch *)data;
+    int seed = batch->first_seed + index*batch->seed_step;
+
+    char fileName[1024] = { 0 };
+    snprintf(fileName, sizeof(fileName), "%s/maze_%i.%s", batch->output_dir, seed, batch->maze_format? "maze" : "pbm");
+
+    // NOTE: Maze ends placed same way than the game, no items generated
+    const MazeGenerator *generator = GetMazeGenerator(batch->algorithm);
+    int end_x = generator->perfect? GetMazePerfectLast(batch->width) : batch->width - 2;
+    int end_y = generator->perfect? GetMazePerfectLast(batch->height) : batch->height - 2;
+    MazeFileInfo info = { (unsigned int)seed, batch->spacing_rows, batch->spacing_cols, batch->point_chance, 1, 1, end_x, end_y, batch->algorithm };
+
+    // NOTE: Every maze uses its own random state, seeded same way than the game
+    MazeRandom rng = { 0 };
+    SetMazeRandomSeed(&rng, seed);
+
+    if (batch->algorithm == MAZE_ALGORITHM_ELLER)
+    {
+        // Maze rows streamed to file as generated, full maze never in memory
+        MazeEller eller = LoadMazeEller(batch->width, batch->height, &rng);
+
+        if (eller.sets == NULL) batch->failed[index] = 1;
+        else if (batch->maze_format) batch->failed[index] = !SaveMazeFileRows(fileName, batch->width, batch->height, GetMazeEllerRow, &eller, info);
+        else batch->failed[index] = !SaveMazePBM(fileName, batch->width, batch->height, GetMazeEllerRow, &eller);
+
+        UnloadMazeEller(&eller);
+        return;
+    }
+
+    MazeGrid grid = { 0 };
+
+    if (batch->chunk_size > 0)
+    {
+        MazeGenStats stats = { 0 };
+        grid = GenMazeGridChunked(batch->width, batch->height, batch->spacing_rows, batch->spacing_cols, batch->point_chance, seed, batch->chunk_size, batch->pool, &stats);
+        printf("INFO: Maze for seed %i generated in %.3f s (%i points, %.1f MB peak)\n", seed, stats.time, stats.points, stats.peak_memory/(1024.0*1024.0));
+    }
+    else grid = generator->generate(batch->width, batch->height, batch->spacing_rows, batch->spacing_cols, batch->point_chance, &rng, NULL);
+
+    MazeGrid rows = grid;
+
+    if (grid.cells == NULL) batch->failed[index] = 1;
+    else if (batch->maze_format)
+    {
+        if (!SaveMazeFile(fileName, grid, NULL, info)) batch->failed[index] = 1;
+    }
+    else if (!SaveMazePBM(fileName, grid.width, grid.height, GetMazeGridRow, &rows)) batch->failed[index] = 1;
+
+    UnloadMazeGrid(grid);
+}
+
+// Save maze rows as PBM image (black = wall)
+static bool SaveMazePBM(const char *fileName, int width, int height, MazeRowFunc next_row, void *data)
+{
+    FILE *file = fopen(fileName, "wb");
+
+    if (file == NULL) return false;
+
+    fprintf(file, "P4\n%i %i\n", width, height);
+
+    // NOTE: PBM binary rows are packed 8 cells per byte, most significant bit first
+    int row_size = (width + 7)/8;
+    unsigned char *row = (unsigned char *)malloc(row_size);
+    unsigned char *cells = (unsigned char *)malloc(width);
+    bool success = (row != NULL) && (cells != NULL);
+
+    for (int y = 0; success && (y < height); y++)
+    {
+        success = next_row(data, cells);
+        memset(row, 0, row_size);
+
+        for (int x = 0; x < width; x++)
+        {
+            if (cells[x] == MAZE_CELL_WALL) row[x/8] |= (unsigned char)(0x80 >> (x%8));
+        }
+
+        if (success) success = (fwrite(row, 1, row_size, file) == (size_t)row_size);
+    }
+
+    free(row);
+    free(cells);
+    fclose(file);
+
+    return success;
+}
+
+// Maze rows provider, maze grid rows
+// NOTE: Provider data is a maze grid, its cells pointer advanced one row per call
+static bool GetMazeGridRow(void *data, unsigned char *cells)
+{
+    MazeGrid *grid = (MazeGrid *)data;
+
+    memcpy(cells, grid->cells, grid->width);
+    grid->cells += grid->width;
+
+    return true;
+}
+
+// Maze rows provider, Eller's streaming generation
+static bool GetMazeEllerRow(void *data, unsigned char *cells)
+{
+    return GenMazeEllerRow((MazeEller *)data, cells);
+}
@@ -0,0 +1,683 @@
+/*******************************************************************************************
+*
+*   maze_bench - Headless benchmarks for maze generation, game update and editor paths
+*
+*   Runs without window or user input, using the same window-free modules than the game:
+*       gen             - Maze generation (GenMazeGrid(), used by GenImageMaze()) across sizes,
+*                         points spacings and points chances
+*       gen_chunked     - Chunked parallel generation, using all cores
+*       path            - Reachability (flood fill) and shortest path (A*) searches
+*       update_game     - Game mode frame update with scripted input: player follows the shortest
+*                         path to the end picking items (movement, collisions, pickup, texture upload)
+*       update_editor   - Editor mode frame update with scripted strokes: cells painting, path
+*                         validation and texture upload
+*       edit_fill       - Editor flood fill tool over the whole maze floor region, whole commit timed
+*                         (fill, undo history record, items, path and flow field update, dirty area),
+*                         undo history bytes recorded by the fill reported (0 if over history limit)
+*       agents          - Agents update (half chasers, half wanderers) using all cores, plus
+*                         flow field update for a target walking the maze (flow_target)
+*
+*   Frame benchmarks also report texture upload bytes per frame (same regions the game uploads)
+*   and maze draw calls per frame, estimated from renderers batching rules (game mode tiles batches,
+*   editor mode overview quad), nothing is drawn
+*
+*   USAGE:
+*       maze_bench [-o results.json|results.csv] [-q]
+*
+*       -o      Save results to file, format selected by extension (JSON or CSV)
+*       -q      Quick run, big sizes skipped
+*
+*   Copyright (c) 2024-2025 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#define MAZE_GRID_IMPLEMENTATION
+#include "maze_grid.h"
+
+#define MAZE_SYSTEM_IMPLEMENTATION
+#include "maze_system.h"
+
+#define MAZE_GEN_IMPLEMENTATION
+#include "maze_gen.h"
+
+#define MAZE_ITEMS_IMPLEMENTATION
+#include "maze_items.h"
+
+#define MAZE_DIRTY_IMPLEMENTATION
+#include "maze_dirty.h"
+
+#define MAZE_FILE_IMPLEMENTATION
+#include "maze_file.h"
+
+#define MAZE_PATH_IMPLEMENTATION
+#include "maze_path.h"
+
+#define MAZE_PLAYER_IMPLEMENTATION
+#include "maze_player.h"
+
+#define MAZE_SIM_IMPLEMENTATION
+#include "maze_sim.h"
+
+#define MAZE_EDIT_IMPLEMENTATION
+#include "maze_edit.h"
+
+#define MAZE_FLOW_IMPLEMENTATION
+#include "maze_flow.h"
+
+#define MAZE_UNDO_IMPLEMENTATION
+#include "maze_undo.h"
+
+#define MAZE_AGENTS_IMPLEMENTATION
+#include "maze_agents.h"
+
+#include <stdio.h>      // Required for: printf(), fprintf(), fopen(), fclose()
+#include <stdlib.h>     // Required for: malloc(), free()
+#include <string.h>     // Required for: strcmp(), strrchr(), strncpy(), memcpy()
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+#define MAX_BENCH_RESULTS       256
+
+// Game configuration replicated from maze_game.c, used by frame benchmarks
+#define BENCH_SEED              37867
+#define BENCH_SCREEN_WIDTH      1280
+#define BENCH_SCREEN_HEIGHT     720
+#define BENCH_CAMERA_ZOOM       10.0f
+#define BENCH_MAZE_SCALE        10.0f
+#define BENCH_PLAYER_SPEED      2.0f
+#define BENCH_DIRTY_TILE_SIZE   16
+#define BENCH_AGENTS_SPEED      0.1f        // Agents speed, cells per tick
+#define BENCH_UNDO_MEMORY       1048576     // Editor undo history memory limit (1 MB)
+
+// Render batch size, in quads (raylib default: RL_DEFAULT_BATCH_BUFFER_ELEMENTS)
+#define BENCH_BATCH_QUADS       8192
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+
+// Benchmark result
+typedef struct BenchResult {
+    char name[32];              // Benchmark name
+    int width;                  // Maze width
+    int height;                 // Maze height
+    int spacing;                // Maze points spacing (rows and columns)
+    float point_chance;         // Maze point chance
+    int iterations;             // Iterations (generation, search) or frames (update)
+    double mean_ms;             // Time per iteration/frame
+    double min_ms;
+    double max_ms;
+    long long points;           // Generation: maze points, search: cells visited
+    long long peak_memory;      // Generation: peak memory in bytes, edit fill: undo history bytes
+    long long upload_bytes;     // Frames: texture bytes uploaded, total
+    int upload_bytes_max;       // Frames: texture bytes uploaded, worst frame
+    int draw_calls_est_max;     // Frames: maze draw calls estimated, worst frame
+} BenchResult;
+
+// Benchmark timer, accumulates iterations timing
+typedef struct BenchTimer {
+    double start;
+    double total;
+    double min;
+    double max;
+    int count;
+} BenchTimer;
+
+//----------------------------------------------------------------------------------
+// Global Variables Definition
+//----------------------------------------------------------------------------------
+static BenchResult results[MAX_BENCH_RESULTS] = { 0 };
+static int result_count = 0;
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+static void BeginBenchTimer(BenchTimer *timer);                     // Begin timing one iteration
+static void EndBenchTimer(BenchTimer *timer);                       // End timing one iteration
+static BenchResult *AddBenchResult(const char *name, int width, int height, int spacing, float point_chance, BenchTimer timer); // Add result with timing
+
+static void BenchGeneration(int size, int spacing, float point_chance);     // Benchmark maze generation
+static void BenchChunkedGeneration(int size, MazeJobPool *pool);    // Benchmark chunked maze generation
+static void BenchPathSearch(int size);                              // Benchmark reachability and shortest path
+static void BenchGameUpdate(int size);                              // Benchmark game mode frames, player following path
+static void BenchEditorUpdate(int size);                            // Benchmark editor mode frames, scripted strokes
+static void BenchEditorFill(int size);                              // Benchmark editor flood fill tool
+static void BenchAgents(int size, int count, MazeJobPool *pool);    // Benchmark agents and flow field update
+
+static int UploadDirtyRegions(MazeDirtyRegions *dirty, MazeGrid grid, unsigned char *staging); // Pack dirty regions as game does, returns bytes
+static int GetTilesDrawCalls(int width, int height, float x, float y); // Get game mode tiles draw calls for camera centered at world position
+
+static bool SaveBenchResults(const char *fileName);                 // Save results as JSON or CSV (by extension)
+
+//----------------------------------------------------------------------------------
+// Program main entry point
+//----------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+    const char *output = NULL;
+    bool quick = false;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if ((strcmp(argv[i], "-o") == 0) && ((i + 1) < argc)) output = argv[++i];
+        else if (strcmp(argv[i], "-q") == 0) quick = true;
+        else
+        {
+            printf("USAGE: maze_bench [-o results.json|results.csv] [-q]\n");
+            return (strcmp(argv[i], "--help") == 0)? 0 : 1;
+        }
+    }
+
+    const int sizes[] = { 64, 256, 1024, 4096 };
+    const int spacings[] = { 2, 4, 8 };
+    const float chances[] = { 0.25f, 0.5f, 0.75f, 1.0f };
+    const int size_count = quick? 3 : 4;
+
+    printf("%-16s %6s %6s %4s %6s %7s %10s %10s %10s\n", "BENCHMARK", "WIDTH", "HEIGHT", "SPC", "CHANCE", "ITERS", "MEAN ms", "MIN ms", "MAX ms");
+
+    for (int s = 0; s < size_count; s++)
+    {
+        for (int k = 0; k < 3; k++)
+        {
+            for (int c = 0; c < 4; c++) BenchGeneration(sizes[s], spacings[k], chances[c]);
+        }
+    }
+
+    MazeJobPool *pool = LoadMazeJobPool(0);
+    BenchChunkedGeneration(quick? 2048 : 8192, pool);
+
+    for (int s = 0; s < size_count; s++) BenchPathSearch(sizes[s]);
+    for (int s = 0; s < size_count - 1; s++) BenchGameUpdate(sizes[s]);
+    for (int s = 0; s < size_count - 1; s++) BenchEditorUpdate(sizes[s]);
+    for (int s = 0; s < 4; s++) BenchEditorFill(sizes[s]);      // Biggest size always run, fills must commit within a frame
+    for (int s = 0; s < size_count - 1; s++) BenchAgents(sizes[s], 10000, pool);
+
+    UnloadMazeJobPool(pool);
+
+    if ((output != NULL) && !SaveBenchResults(output))
+    {
+        fprintf(stderr, "ERROR: Results could not be saved: %s\n", output);
+        return 1;
+    }
+
+    return 0;
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+
+// Begin timing one iteration
+static void BeginBenchTimer(BenchTimer *timer)
+{
+    timer->start = GetMazeTime();
+}
+
+// End timing one iteration
+static void EndBenchTimer(BenchTimer *timer)
+{
+    double elapsed = GetMazeTime() - timer->start;
+
+    if ((timer->count == 0) || (elapsed < timer->min)) timer->min = elapsed;
+    if ((timer->count == 0) || (elapsed > timer->max)) timer->max = elapsed;
+    timer->total += elapsed;
+    timer->count++;
+}
+
+// Add result with timing, printed to stdout
+static BenchResult *AddBenchResult(const char *name, int width, int height, int spacing, float point_chance, BenchTimer timer)
+{
+    if (result_count >= MAX_BENCH_RESULTS) result_count = MAX_BENCH_RESULTS - 1;
+
+    BenchResult *result = &results[result_count++];
+    *result = (BenchResult){ 0 };
+
+    strncpy(result->name, name, sizeof(result->name) - 1);
+    result->width = width;
+    result->height = height;
+    result->spacing = spacing;
+    result->point_chance = point_chance;
+    result->iterations = timer.count;
+    result->mean_ms = (timer.count > 0)? timer.total*1000.0/timer.count : 0.0;
+    result->min_ms = timer.min*1000.0;
+    result->max_ms = timer.max*1000.0;
+
+    printf("%-16s %6i %6i %4i %6.2f %7i %10.4f %10.4f %10.4f\n", name, width, height, spacing, point_chance, timer.count, result->mean_ms, result->min_ms, result->max_ms);
+
+    return result;
+}
+
+// Benchmark maze generation
+// NOTE: Iterations scaled with maze size, so every case takes a similar time
+static void BenchGeneration(int size, int spacing, float point_chance)
+{
+    int iterations = (int)(4*1024*1024/((long long)size*size));
+    if (iterations < 3) iterations = 3;
+    if (iterations > 200) iterations = 200;
+
+    BenchTimer timer = { 0 };
+    MazeGenStats stats = { 0 };
+
+    for (int i = 0; i < iterations; i++)
+    {
+        MazeRandom rng = { 0 };
+        SetMazeRandomSeed(&rng, BENCH_SEED + i);
+
+        BeginBenchTimer(&timer);
+        MazeGrid grid = GenMazeGrid(size, size, spacing, spacing, point_chance, &rng, &stats);
+        EndBenchTimer(&timer);
+
+        UnloadMazeGrid(grid);
+    }
+
+    BenchResult *result = AddBenchResult("gen", size, size, spacing, point_chance, timer);
+    result->points = stats.points;
+    result->peak_memory = (long long)stats.peak_memory;
+}
+
+// Benchmark chunked maze generation
+static void BenchChunkedGeneration(int size, MazeJobPool *pool)
+{
+    BenchTimer timer = { 0 };
+    MazeGenStats stats = { 0 };
+
+    for (int i = 0; i < 3; i++)
+    {
+        BeginBenchTimer(&timer);
+        MazeGrid grid = GenMazeGridChunked(size, size, 4, 4, 0.75f, BENCH_SEED + i, 512, pool, &stats);
+        EndBenchTimer(&timer);
+
+        UnloadMazeGrid(grid);
+    }
+
+    BenchResult *result = AddBenchResult("gen_chunked", size, size, 4, 0.75f, timer);
+    result->points = stats.points;
+    result->peak_memory = (long long)stats.peak_memory;
+}
+
+// Benchmark reachability and shortest path, between opposite maze corners
+static void BenchPathSearch(int size)
+{
+    MazeRandom rng = { 0 };
+    SetMazeRandomSeed(&rng, BENCH_SEED);
+
+    MazeGrid grid = GenMazeGrid(size, size, 4, 4, 0.75f, &rng, NULL);
+    MazePath path = LoadMazePath(grid);
+    BenchTimer reach_timer = { 0 };
+    BenchTimer search_timer = { 0 };
+    int iterations = (size <= 256)? 100 : 5;
+
+    for (int i = 0; i < iterations; i++)
+    {
+        BeginBenchTimer(&reach_timer);
+        IsMazeCellReachable(&path, 1, 1, size - 2, size - 2);
+        EndBenchTimer(&reach_timer);
+
+        // NOTE: Path ends changed every iteration, so every update runs a new search
+        SetMazePathEnds(&path, 1, 1, size - 2, size - 2 - (i%2));
+        BeginBenchTimer(&search_timer);
+        UpdateMazePath(&path);
+        EndBenchTimer(&search_timer);
+    }
+
+    AddBenchResult("path_reach", size, size, 4, 0.75f, reach_timer);
+    AddBenchResult("path_search", size, size, 4, 0.75f, search_timer)->points = path.stats.visited;
+
+    UnloadMazePath(&path);
+    UnloadMazeGrid(grid);
+}
+
+// Benchmark game mode frames, player following shortest path to the end picking items
+// NOTE: Same update done by game every frame: input, movement with collisions, items pickup,
+// dirty regions upload; items placed every few path cells to exercise pickup
+static void BenchGameUpdate(int size)
+{
+    MazeRandom rng = { 0 };
+    SetMazeRandomSeed(&rng, BENCH_SEED);
+
+    MazeGrid grid = GenMazeGrid(size, size, 4, 4, 0.75f, &rng, NULL);
+    MazePath path = LoadMazePath(grid);
+    SetMazePathEnds(&path, 1, 1, size - 2, size - 2);
+    UpdateMazePath(&path);
+
+    for (int i = 4; i < (path.length - 1); i += 4) grid.cells[path.cells[i]] = MAZE_CELL_ITEM;
+    if (path.length > 0) grid.cells[path.cells[path.length - 1]] = MAZE_CELL_GOAL;
+
+    MazeItems items = LoadMazeItems(grid.width, 0);
+    AddMazeItemsFromGrid(&items, grid, MAZE_ITEM_COIN);
+    MazeDirtyRegions dirty = LoadMazeDirtyRegions(grid.width, grid.height, BENCH_DIRTY_TILE_SIZE, 0);
+    unsigned char *staging = (unsigned char *)malloc((size_t)((size + 3)/4 + 1)*BENCH_DIRTY_TILE_SIZE);
+
+    // Player placed as in game: position offset inside start cell
+    const float offset = 2.0f;
+    MazeSim sim = { 0 };
+    sim.scale = BENCH_MAZE_SCALE;
+    sim.speed = BENCH_PLAYER_SPEED;
+    sim.walkable = IsMazeGridCellWalkable;
+    sim.walkable_data = &grid;
+    sim.grid = &grid;
+    sim.items = &items;
+    sim.dirty = &dirty;
+    ResetMazeSim(&sim, path.length? (path.cells[0]%size)*BENCH_MAZE_SCALE + offset : 0.0f, path.length? (path.cells[0]/size)*BENCH_MAZE_SCALE + offset : 0.0f);
+    int target = 1;
+
+    BenchTimer timer = { 0 };
+    long long upload_total = 0;
+    int upload_max = 0;
+    int draw_calls_max = 0;
+    int max_frames = path.length*(int)(BENCH_MAZE_SCALE/BENCH_PLAYER_SPEED + 1) + 60;
+
+    for (int frame = 0; (frame < max_frames) && !sim.state.won && (target < path.length); frame++)
+    {
+        // Scripted input: move towards next path cell
+        float target_x = (path.cells[target]%size)*BENCH_MAZE_SCALE + offset;
+        float target_y = (path.cells[target]/size)*BENCH_MAZE_SCALE + offset;
+        MazePlayerInput input = { 0 };
+        input.up = (target_y < sim.state.player_y);
+        input.down = (target_y > sim.state.player_y);
+        input.left = (target_x < sim.state.player_x);
+        input.right = (target_x > sim.state.player_x);
+
+        BeginBenchTimer(&timer);
+
+        // NOTE: One simulation tick per frame, as game running at tick rate
+        StepMazeSim(&sim, input);
+
+        int upload = UploadDirtyRegions(&dirty, grid, staging);
+
+        EndBenchTimer(&timer);
+
+        if ((sim.state.player_x == target_x) && (sim.state.player_y == target_y)) target++;
+
+        int draw_calls = GetTilesDrawCalls(size, size, sim.state.player_x, sim.state.player_y);
+        upload_total += upload;
+        if (upload > upload_max) upload_max = upload;
+        if (draw_calls > draw_calls_max) draw_calls_max = draw_calls;
+    }
+
+    if (!sim.state.won) fprintf(stderr, "WARNING: Scripted player did not reach the end [%ix%i]\n", size, size);
+
+    BenchResult *result = AddBenchResult("update_game", size, size, 4, 0.75f, timer);
+    result->upload_bytes = upload_total;
+    result->upload_bytes_max = upload_max;
+    result->draw_calls_est_max = draw_calls_max;
+
+    free(staging);
+    UnloadMazeDirtyRegions(&dirty);
+    UnloadMazeItems(&items);
+    UnloadMazePath(&path);
+    UnloadMazeGrid(grid);
+}
+
+// Benchmark editor mode frames, scripted strokes
+// NOTE: Every frame paints one cell, strokes drawn as mouse drags along rows and columns,
+// alternating walls and floor; path validated and dirty regions uploaded every frame
+static void BenchEditorUpdate(int size)
+{
+    MazeRandom rng = { 0 };
+    SetMazeRandomSeed(&rng, BENCH_SEED);
+
+    MazeGrid grid = GenMazeGrid(size, size, 4, 4, 0.75f, &rng, NULL);
+    MazePath path = LoadMazePath(grid);
+    SetMazePathEnds(&path, 1, 1, size - 2, size - 2);
+    UpdateMazePath(&path);
+
+    MazeDirtyRegions dirty = LoadMazeDirtyRegions(grid.width, grid.height, BENCH_DIRTY_TILE_SIZE, 0);
+    unsigned char *staging = (unsigned char *)malloc((size_t)((size + 3)/4 + 1)*BENCH_DIRTY_TILE_SIZE);
+
+    BenchTimer timer = { 0 };
+    long long upload_total = 0;
+    int upload_max = 0;
+    const int stroke_length = 16;
+    const int frames = 2000;
+
+    SetMazeRandomSeed(&rng, BENCH_SEED + 1);
+
+    int x = 0, y = 0, dx = 0, dy = 0, paint = MAZE_CELL_WALL;
+
+    for (int frame = 0; frame < frames; frame++)
+    {
+        // Scripted mouse: new stroke every few frames, random position and direction
+        if ((frame%stroke_length) == 0)
+        {
+            x = GetMazeRandomValue(&rng, 1, size - 2);
+            y = GetMazeRandomValue(&rng, 1, size - 2);
+            int dir = GetMazeRandomValue(&rng, 0, 3);
+            dx = (dir == 0)? 1 : (dir == 1)? -1 : 0;
+            dy = (dir == 2)? 1 : (dir == 3)? -1 : 0;
+            paint = (paint == MAZE_CELL_WALL)? MAZE_CELL_FLOOR : MAZE_CELL_WALL;
+        }
+        else if ((x + dx > 0) && (x + dx < (size - 1)) && (y + dy > 0) && (y + dy < (size - 1)))
+        {
+            x += dx;
+            y += dy;
+        }
+
+        BeginBenchTimer(&timer);
+
+        if (SetMazeCell(&grid, x, y, paint))
+        {
+            MarkMazeCellDirty(&dirty, x, y);
+            UpdateMazePathCell(&path, grid, x, y);
+        }
+
+        UpdateMazePath(&path);
+        int upload = UploadDirtyRegions(&dirty, grid, staging);
+
+        EndBenchTimer(&timer);
+
+        upload_total += upload;
+        if (upload > upload_max) upload_max = upload;
+    }
+
+    BenchResult *result = AddBenchResult("update_editor", size, size, 4, 0.75f, timer);
+    result->points = path.stats.searches;
+    result->upload_bytes = upload_total;
+    result->upload_bytes_max = upload_max;
+    result->draw_calls_est_max = 1;     // Estimated: editor draws maze overview as a single quad
+
+    free(staging);
+    UnloadMazeDirtyRegions(&dirty);
+    UnloadMazePath(&path);
+    UnloadMazeGrid(grid);
+}
+
+// Benchmark editor flood fill tool, whole commit as done by the game editor
+// NOTE: Floor region around maze start filled with walls (worst case, path and flow field updated),
+// maze cells, path and flow field restored after every fill (not timed)
+static void BenchEditorFill(int size)
+{
+    MazeRandom rng = { 0 };
+    SetMazeRandomSeed(&rng, BENCH_SEED);
+
+    MazeGrid grid = GenMazeGrid(size, size, 4, 4, 0.75f, &rng, NULL);
+    SetMazeCell(&grid, 1, 1, MAZE_CELL_FLOOR);
+
+    unsigned char *cells = (unsigned char *)malloc((size_t)size*size);
+    memcpy(cells, grid.cells, (size_t)size*size);
+
+    MazeItems items = LoadMazeItems(size, 0);
+    MazeDirtyRegions dirty = LoadMazeDirtyRegions(size, size, BENCH_DIRTY_TILE_SIZE, 0);
+    MazePath path = LoadMazePath(grid);
+    MazeFlowField flow = LoadMazeFlowField(grid);
+    MazeUndo undo = LoadMazeUndo(size, BENCH_UNDO_MEMORY);
+    MazeEditBatch batch = LoadMazeEditBatch(0);
+
+    SetMazePathEnds(&path, 1, 1, size - 2, size - 2);
+    UpdateMazePath(&path);
+    SetMazeFlowTarget(&flow, 1, 1);
+
+    BenchTimer timer = { 0 };
+    int iterations = (int)(4*1024*1024/((long long)size*size));
+    if (iterations < 10) iterations = 10;
+    if (iterations > 200) iterations = 200;
+
+    int filled = 0;
+    int edits = 0;
+
+    for (int i = 0; i < iterations; i++)
+    {
+        ClearMazeEditBatch(&batch);
+        ClearMazeDirtyRegions(&dirty);
+        ClearMazeUndo(&undo, size);
+
+        BeginBenchTimer(&timer);
+
+        BeginMazeEdit(&undo);
+        filled = FloodFillMaze(&grid, &batch, 1, 1, MAZE_CELL_WALL);
+
+        // Same commit than game editor (CommitMazeEditBatch()), path and flow updated for batch bounds
+        MazeDirtyRect bounds = batch.bounds;
+        RecordMazeEditBatch(&undo, &items, &batch);
+
+        if (HasMazeEditBatchWalls(&batch))
+        {
+            UpdateMazePathArea(&path, grid, bounds.x, bounds.y, bounds.width, bounds.height);
+            UpdateMazeFlowArea(&flow, grid, bounds.x, bounds.y, bounds.width, bounds.height);
+        }
+
+        MarkMazeAreaDirty(&dirty, bounds.x, bounds.y, bounds.width, bounds.height);
+        EndMazeEdit(&undo);
+
+        EndBenchTimer(&timer);
+
+        edits = undo.stats.edits;
+
+        memcpy(grid.cells, cells, (size_t)size*size);
+        UpdateMazePathArea(&path, grid, 0, 0, size, size);
+        UpdateMazeFlowArea(&flow, grid, 0, 0, size, size);
+        UpdateMazePath(&path);
+        SetMazeFlowTarget(&flow, 1, 1);
+    }
+
+    BenchResult *result = AddBenchResult("edit_fill", size, size, 4, 0.75f, timer);
+    result->points = filled;
+    result->peak_memory = (long long)edits*sizeof(MazeCellEdit);
+
+    UnloadMazeEditBatch(&batch);
+    UnloadMazeUndo(&undo);
+    UnloadMazeFlowField(&flow);
+    UnloadMazePath(&path);
+    UnloadMazeDirtyRegions(&dirty);
+    UnloadMazeItems(&items);
+    UnloadMazeGrid(grid);
+    free(cells);
+}
+
+// Benchmark agents and flow field update, one tick per frame
+// NOTE: Flow field target is a wanderer agent walking the maze, chasers follow it
+static void BenchAgents(int size, int count, MazeJobPool *pool)
+{
+    MazeRandom rng = { 0 };
+    SetMazeRandomSeed(&rng, BENCH_SEED);
+
+    MazeGrid grid = GenMazeGrid(size, size, 4, 4, 0.75f, &rng, NULL);
+    MazeFlowField flow = LoadMazeFlowField(grid);
+    MazeAgents agents = LoadMazeAgents(count, BENCH_AGENTS_SPEED);
+    MazeAgents target = LoadMazeAgents(1, BENCH_AGENTS_SPEED);
+
+    SpawnMazeAgents(&agents, grid, count/2, MAZE_AGENT_CHASER, &rng);
+    SpawnMazeAgents(&agents, grid, count - count/2, MAZE_AGENT_WANDERER, &rng);
+    SpawnMazeAgents(&target, grid, 1, MAZE_AGENT_WANDERER, &rng);
+
+    BenchTimer agents_timer = { 0 };
+    BenchTimer flow_timer = { 0 };
+    const int frames = 600;
+
+    for (int i = 0; i < frames; i++)
+    {
+        UpdateMazeAgents(&target, grid, &flow, NULL, 1);
+
+        BeginBenchTimer(&flow_timer);
+        SetMazeFlowTarget(&flow, target.next_x[0], target.next_y[0]);
+        EndBenchTimer(&flow_timer);
+
+        BeginBenchTimer(&agents_timer);
+        UpdateMazeAgents(&agents, grid, &flow, pool, 1);
+        EndBenchTimer(&agents_timer);
+    }
+
+    AddBenchResult("agents", size, size, 4, 0.75f, agents_timer)->points = agents.count;
+    AddBenchResult("flow_target", size, size, 4, 0.75f, flow_timer)->points = flow.stats.rebuilds;
+
+    UnloadMazeAgents(&target);
+    UnloadMazeAgents(&agents);
+    UnloadMazeFlowField(&flow);
+    UnloadMazeGrid(grid);
+}
+
+// Pack dirty regions as game does (UpdateMazeTextureRegions(), overview texture), returns bytes
+// NOTE: Regions cells packed from grid at 2 bits per cell, staging fits one dirty tiles row
+static int UploadDirtyRegions(MazeDirtyRegions *dirty, MazeGrid grid, unsigned char *staging)
+{
+    int bytes = 0;
+    MazeDirtyRect rect = { 0 };
+
+    while (PopMazeDirtyRect(dirty, &rect)) bytes += PackMazeCellsRows(grid, rect.x, rect.y, rect.width, rect.height, staging);
+
+    return bytes;
+}
+
+// Get game mode tiles draw calls for camera centered at world position
+// NOTE: Same visible range than GetMazeViewRange() for a not rotated camera, all tiles
+// go into the same batch, a new draw call is required every time batch gets full
+static int GetTilesDrawCalls(int width, int height, float x, float y)
+{
+    float half_width = BENCH_SCREEN_WIDTH/2.0f/BENCH_CAMERA_ZOOM;
+    float half_height = BENCH_SCREEN_HEIGHT/2.0f/BENCH_CAMERA_ZOOM;
+
+    int min_x = GetMazeWorldCell(x - half_width, 0.0f, BENCH_MAZE_SCALE);
+    int min_y = GetMazeWorldCell(y - half_height, 0.0f, BENCH_MAZE_SCALE);
+    int max_x = GetMazeWorldCell(x + half_width, 0.0f, BENCH_MAZE_SCALE);
+    int max_y = GetMazeWorldCell(y + half_height, 0.0f, BENCH_MAZE_SCALE);
+
+    if (min_x < 0) min_x = 0;
+    if (min_y < 0) min_y = 0;
+    if (max_x > (width - 1)) max_x = width - 1;
+    if (max_y > (height - 1)) max_y = height - 1;
+    if ((min_x > max_x) || (min_y > max_y)) return 0;
+
+    int tiles = (max_x - min_x + 1)*(max_y - min_y + 1);
+
+    return (tiles + BENCH_BATCH_QUADS - 1)/BENCH_BATCH_QUADS;
+}
+
+// Save results as JSON or CSV (by extension)
+static bool SaveBenchResults(const char *fileName)
+{
+    FILE *file = fopen(fileName, "wt");
+
+    if (file == NULL) return false;
+
+    const char *ext = strrchr(fileName, '.');
+    bool csv = (ext != NULL) && (strcmp(ext, ".csv") == 0);
+
+    if (csv) fprintf(file, "name,width,height,spacing,point_chance,iterations,mean_ms,min_ms,max_ms,points,peak_memory,upload_bytes,upload_bytes_max,draw_calls_est_max\n");
+    else fprintf(file, "{\n    \"results\": [\n");
+
+    for (int i = 0; i < result_count; i++)
+    {
+        BenchResult *r = &results[i];
+
+        if (csv)
+        {
+            fprintf(file, "%s,%i,%i,%i,%.2f,%i,%.6f,%.6f,%.6f,%lli,%lli,%lli,%i,%i\n", r->name, r->width, r->height, r->spacing, r->point_chance,
+                r->iterations, r->mean_ms, r->min_ms, r->max_ms, r->points, r->peak_memory, r->upload_bytes, r->upload_bytes_max, r->draw_calls_est_max);
+        }
+        else
+        {
+            fprintf(file, "        { \"name\": \"%s\", \"width\": %i, \"height\": %i, \"spacing\": %i, \"point_chance\": %.2f, \"iterations\": %i, "
+                "\"mean_ms\": %.6f, \"min_ms\": %.6f, \"max_ms\": %.6f, \"points\": %lli, \"peak_memory\": %lli, "
+                "\"upload_bytes\": %lli, \"upload_bytes_max\": %i, \"draw_calls_est_max\": %i }%s\n", r->name, r->width, r->height, r->spacing, r->point_chance,
+                r->iterations, r->mean_ms, r->min_ms, r->max_ms, r->points, r->peak_memory, r->upload_bytes, r->upload_bytes_max, r->draw_calls_est_max,
+                (i < (result_count - 1))? "," : "");
+        }
+    }
+
+    if (!csv) fprintf(file, "    ]\n}\n");
+
+    fclose(file);
+
+    return true;
+}
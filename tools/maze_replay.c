@@ -0,0 +1,140 @@
+/*******************************************************************************************
+*
+*   maze_replay - Headless game session replay
+*
+*   Runs a game session recorded by the game ([F2] in game mode) without window or rendering,
+*   as fast as possible: recorded input is applied tick by tick to the same simulation than
+*   the game, starting from the session maze, and the final state is checked against the
+*   recorded one. Session can be replayed multiple times to measure simulation performance
+*
+*   USAGE:
+*       maze_replay [-m maze_session.maze] [-r maze_session.replay] [-n runs]
+*
+*   Copyright (c) 2024-2025 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#define MAZE_GRID_IMPLEMENTATION
+#include "maze_grid.h"
+
+#define MAZE_SYSTEM_IMPLEMENTATION
+#include "maze_system.h"
+
+#define MAZE_ITEMS_IMPLEMENTATION
+#include "maze_items.h"
+
+#define MAZE_DIRTY_IMPLEMENTATION
+#include "maze_dirty.h"
+
+#define MAZE_PLAYER_IMPLEMENTATION
+#include "maze_player.h"
+
+#define MAZE_FILE_IMPLEMENTATION
+#include "maze_file.h"
+
+#define MAZE_SIM_IMPLEMENTATION
+#include "maze_sim.h"
+
+#include <stdio.h>      // Required for: printf(), fprintf()
+#include <stdlib.h>     // Required for: malloc(), free(), atoi()
+#include <string.h>     // Required for: strcmp(), memcpy()
+
+//----------------------------------------------------------------------------------
+// Program main entry point
+//----------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+    const char *maze_file_name = "maze_session.maze";
+    const char *replay_file_name = "maze_session.replay";
+    int runs = 1;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if ((strcmp(argv[i], "--help") == 0) || ((i + 1) >= argc))
+        {
+            printf("USAGE: maze_replay [-m maze_session.maze] [-r maze_session.replay] [-n runs]\n");
+            return (strcmp(argv[i], "--help") == 0)? 0 : 1;
+        }
+
+        if (strcmp(argv[i], "-m") == 0) maze_file_name = argv[++i];
+        else if (strcmp(argv[i], "-r") == 0) replay_file_name = argv[++i];
+        else if (strcmp(argv[i], "-n") == 0) runs = atoi(argv[++i]);
+        else
+        {
+            fprintf(stderr, "ERROR: Unknown option: %s\n", argv[i]);
+            return 1;
+        }
+    }
+
+    MazeFile file = LoadMazeFile(maze_file_name);
+    MazeReplay replay = LoadMazeReplay(replay_file_name);
+
+    if (!IsMazeFileValid(file) || (replay.log.runs == NULL) || (runs <= 0))
+    {
+        fprintf(stderr, "ERROR: Session could not be loaded: %s, %s\n", maze_file_name, replay_file_name);
+        UnloadMazeFile(&file);
+        UnloadMazeReplay(&replay);
+        return 1;
+    }
+
+    MazeGrid grid = LoadMazeGridFromFile(file);
+
+    if (ComputeMazeGridHash(grid) != replay.maze_hash)
+    {
+        fprintf(stderr, "ERROR: Session maze does not match replay maze\n");
+        UnloadMazeGrid(grid);
+        UnloadMazeFile(&file);
+        UnloadMazeReplay(&replay);
+        return 1;
+    }
+
+    // NOTE: Session start cells kept, every run starts from the same maze state
+    unsigned char *start_cells = (unsigned char *)malloc((size_t)grid.width*grid.height);
+    memcpy(start_cells, grid.cells, (size_t)grid.width*grid.height);
+
+    MazeItems items = LoadMazeItems(grid.width, file.item_count);
+    MazeSim sim = { 0 };
+    sim.walkable = IsMazeGridCellWalkable;
+    sim.walkable_data = &grid;
+    sim.grid = &grid;
+    sim.items = &items;
+
+    double total_time = 0.0;
+    double min_time = 0.0;
+    int failed = 0;
+
+    for (int i = 0; i < runs; i++)
+    {
+        // Maze data reset as loaded by game: items cells default to coins, items table sets type
+        memcpy(grid.cells, start_cells, (size_t)grid.width*grid.height);
+        ClearMazeItems(&items);
+        AddMazeItemsFromGrid(&items, grid, MAZE_ITEM_COIN);
+        AddMazeItemsFromFile(&items, file);
+
+        double start_time = GetMazeTime();
+        bool match = PlayMazeReplay(&sim, replay);
+        double elapsed = GetMazeTime() - start_time;
+
+        total_time += elapsed;
+        if ((i == 0) || (elapsed < min_time)) min_time = elapsed;
+        if (!match) failed++;
+    }
+
+    double session_time = (double)replay.log.ticks/MAZE_SIM_TICK_RATE;
+
+    printf("INFO: Session: %u ticks (%.1f s), %i input runs\n", replay.log.ticks, session_time, replay.log.count);
+    printf("INFO: Recorded end: position (%.2f, %.2f), score %i, %s\n", replay.end.player_x, replay.end.player_y, replay.end.score, replay.end.won? "won" : "not won");
+    printf("INFO: Replayed end: position (%.2f, %.2f), score %i, %s\n", sim.state.player_x, sim.state.player_y, sim.state.score, sim.state.won? "won" : "not won");
+    printf("INFO: Replayed %i times: %.4f ms per run (min %.4f ms), %.0f ticks/s, %.0fx real time\n", runs, total_time*1000.0/runs, min_time*1000.0,
+        replay.log.ticks/(total_time/runs), session_time/(total_time/runs));
+
+    if (failed > 0) fprintf(stderr, "ERROR: %i of %i runs did not match recorded end state\n", failed, runs);
+
+    free(start_cells);
+    UnloadMazeItems(&items);
+    UnloadMazeGrid(grid);
+    UnloadMazeFile(&file);
+    UnloadMazeReplay(&replay);
+
+    return (failed > 0)? 1 : 0;
+}
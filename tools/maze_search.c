@@ -0,0 +1,302 @@
+/*******************************************************************************************
+*
+*   maze_search - Headless multi-threaded maze seeds search
+*
+*   Scans a range of seeds, generating and analyzing every maze (maze_analysis), and writes
+*   seeds of mazes meeting all constraints to a text file, one line per seed with its metrics.
+*   Seeds are split in blocks distributed across all cores, every block uses its own random
+*   generator state and analyzer buffers, so results are the same for any number of threads;
+*   matching seeds are written in seeds order
+*
+*   Mazes are generated same way than the game (start at 1,1, end at last cell), so found
+*   seeds can be used directly: the game walks through seeds file (maze_seeds.txt) on [R],
+*   or mazes can be saved with maze_batch -s seed. Default parameters are the ones used by
+*   [R]; generation parameters are written in seeds file header, the game ignores seeds
+*   files generated with other parameters (and only uses seeds for the same algorithm)
+*
+*   USAGE:
+*       maze_search [-o file] [-s seed] [-n count] [-k step] [-w width] [-h height]
+*                   [-r spacing_rows] [-c spacing_cols] [-p chance] [-j threads]
+*                   [-a grid|backtracker|wilson|eller] [-S] [-L min_path] [-M max_path]
+*                   [-d min_dead_ends] [-D max_dead_ends] [-l min_loops] [-m max_loops]
+*
+*   EXAMPLE: Solvable game mazes with long paths and few dead ends, first million seeds
+*       maze_search -n 1000000 -S -L 200 -D 40 -o seeds.txt
+*
+*   Copyright (c) 2024-2025 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#define MAZE_GRID_IMPLEMENTATION
+#include "maze_grid.h"
+
+#define MAZE_SYSTEM_IMPLEMENTATION
+#include "maze_system.h"
+
+#define MAZE_GEN_IMPLEMENTATION
+#include "maze_gen.h"
+
+#define MAZE_ALGO_IMPLEMENTATION
+#include "maze_algo.h"
+
+#define MAZE_ANALYSIS_IMPLEMENTATION
+#include "maze_analysis.h"
+
+#include <stdio.h>      // Required for: printf(), fprintf(), fopen(), fclose()
+#include <stdlib.h>     // Required for: atoi(), atof(), calloc(), realloc(), free()
+#include <string.h>     // Required for: strcmp()
+
+#define MAZE_SEARCH_BLOCK_SEEDS     1024    // Seeds analyzed by one job
+#define MAZE_SEARCH_ROUND_BLOCKS    256     // Jobs run before writing matching seeds
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+
+// Matching seed and its metrics
+typedef struct MazeSearchMatch {
+    int seed;
+    MazeAnalysis analysis;
+} MazeSearchMatch;
+
+// Seeds block results, filled by one job
+typedef struct MazeSearchBlock {
+    MazeSearchMatch *matches;   // Matching seeds, in seeds order
+    int count;                  // Matching seeds count
+    int capacity;               // Matching seeds allocated
+    int failed;                 // Mazes that could not be generated or analyzed
+} MazeSearchBlock;
+
+// Search settings and results
+typedef struct MazeSearch {
+    const char *output_file;    // Matching seeds file
+    long long first_seed;       // First seed to search
+    int seed_step;              // Seed increment between mazes
+    long long count;            // Number of seeds to search
+    int width;                  // Maze width
+    int height;                 // Maze height
+    int spacing_rows;           // Maze points spacing, rows
+    int spacing_cols;           // Maze points spacing, columns
+    float point_chance;         // Maze point chance
+    int threads;                // Threads used (0 = all cores)
+    int algorithm;              // Generation algorithm (MazeAlgorithm)
+    MazeConstraints constraints; // Constraints to meet
+
+    long long round_first;      // Current round first seed index
+    MazeSearchBlock *blocks;    // Current round blocks results
+} MazeSearch;
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+static void SearchMazeBlockJob(void *data, int index);              // Generate and analyze one block of seeds
+
+//----------------------------------------------------------------------------------
+// Program main entry point
+//----------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+    MazeSearch search = {
+        .output_file = "maze_seeds.txt",
+        .first_seed = 0,
+        .seed_step = 1,
+        .count = 100000,
+        .width = 64,
+        .height = 64,
+        .spacing_rows = 4,
+        .spacing_cols = 4,
+        .point_chance = 0.5f,
+        .threads = 0,
+        .constraints = GetMazeConstraintsDefault(),
+    };
+
+    for (int i = 1; i < argc; i++)
+    {
+        // Flag options, no value
+        if (strcmp(argv[i], "-S") == 0)
+        {
+            search.constraints.solvable = true;
+            continue;
+        }
+
+        if ((strcmp(argv[i], "--help") == 0) || ((i + 1) >= argc))
+        {
+            printf("USAGE: maze_search [-o file] [-s seed] [-n count] [-k step] [-w width] [-h height]\n");
+            printf("                   [-r spacing_rows] [-c spacing_cols] [-p chance] [-j threads]\n");
+            printf("                   [-a grid|backtracker|wilson|eller] [-S] [-L min_path] [-M max_path]\n");
+            printf("                   [-d min_dead_ends] [-D max_dead_ends] [-l min_loops] [-m max_loops]\n");
+            return (strcmp(argv[i], "--help") == 0)? 0 : 1;
+        }
+
+        if (strcmp(argv[i], "-o") == 0) search.output_file = argv[++i];
+        else if (strcmp(argv[i], "-s") == 0) search.first_seed = atoll(argv[++i]);
+        else if (strcmp(argv[i], "-n") == 0) search.count = atoll(argv[++i]);
+        else if (strcmp(argv[i], "-k") == 0) search.seed_step = atoi(argv[++i]);
+        else if (strcmp(argv[i], "-w") == 0) search.width = atoi(argv[++i]);
+        else if (strcmp(argv[i], "-h") == 0) search.height = atoi(argv[++i]);
+        else if (strcmp(argv[i], "-r") == 0) search.spacing_rows = atoi(argv[++i]);
+        else if (strcmp(argv[i], "-c") == 0) search.spacing_cols = atoi(argv[++i]);
+        else if (strcmp(argv[i], "-p") == 0) search.point_chance = (float)atof(argv[++i]);
+        else if (strcmp(argv[i], "-j") == 0) search.threads = atoi(argv[++i]);
+        else if (strcmp(argv[i], "-L") == 0) search.constraints.min_path = atoi(argv[++i]);
+        else if (strcmp(argv[i], "-M") == 0) search.constraints.max_path = atoi(argv[++i]);
+        else if (strcmp(argv[i], "-d") == 0) search.constraints.min_dead_ends = atoi(argv[++i]);
+        else if (strcmp(argv[i], "-D") == 0) search.constraints.max_dead_ends = atoi(argv[++i]);
+        else if (strcmp(argv[i], "-l") == 0) search.constraints.min_loops = atoi(argv[++i]);
+        else if (strcmp(argv[i], "-m") == 0) search.constraints.max_loops = atoi(argv[++i]);
+        else if (strcmp(argv[i], "-a") == 0)
+        {
+            i++;
+            search.algorithm = -1;
+            for (int a = 0; a < MAZE_ALGORITHM_COUNT; a++) if (strcmp(argv[i], GetMazeGenerator(a)->name) == 0) search.algorithm = a;
+        }
+        else
+        {
+            fprintf(stderr, "ERROR: Unknown option: %s\n", argv[i]);
+            return 1;
+        }
+    }
+
+    if ((search.count <= 0) || (search.width < 3) || (search.height < 3) || (search.spacing_rows <= 0) ||
+        (search.spacing_cols <= 0) || (GetMazeGenerator(search.algorithm) == NULL))
+    {
+        fprintf(stderr, "ERROR: Invalid search parameters\n");
+        return 1;
+    }
+
+    FILE *file = fopen(search.output_file, "wt");
+
+    if (file == NULL)
+    {
+        fprintf(stderr, "ERROR: [%s] Seeds file could not be opened\n", search.output_file);
+        return 1;
+    }
+
+    // NOTE: Generation parameters header checked by the game before using seeds
+    fprintf(file, "# maze_search: width %i height %i spacing_rows %i spacing_cols %i point_chance %.3f algorithm %s\n", search.width, search.height,
+        search.spacing_rows, search.spacing_cols, search.point_chance, GetMazeGenerator(search.algorithm)->name);
+    fprintf(file, "# seed path_length dead_ends loops junctions components branching\n");
+
+    search.blocks = (MazeSearchBlock *)calloc(MAZE_SEARCH_ROUND_BLOCKS, sizeof(MazeSearchBlock));
+
+    MazeJobPool *pool = LoadMazeJobPool(search.threads);
+
+    printf("INFO: Searching %lli seeds [%ix%i] using %s algorithm and %i threads\n", search.count, search.width, search.height,
+        GetMazeGenerator(search.algorithm)->name, GetMazeJobPoolThreads(pool));
+
+    double start_time = GetMazeTime();
+    long long found = 0;
+    long long failed = 0;
+    long long total_blocks = (search.count + MAZE_SEARCH_BLOCK_SEEDS - 1)/MAZE_SEARCH_BLOCK_SEEDS;
+
+    // Seeds searched in rounds of blocks, matching seeds written in order after every round
+    for (long long block = 0; block < total_blocks; block += MAZE_SEARCH_ROUND_BLOCKS)
+    {
+        int round_blocks = (int)(((total_blocks - block) < MAZE_SEARCH_ROUND_BLOCKS)? (total_blocks - block) : MAZE_SEARCH_ROUND_BLOCKS);
+
+        search.round_first = block*MAZE_SEARCH_BLOCK_SEEDS;
+        RunMazeJobs(pool, SearchMazeBlockJob, &search, round_blocks);
+
+        for (int b = 0; b < round_blocks; b++)
+        {
+            MazeSearchBlock *result = &search.blocks[b];
+
+            for (int m = 0; m < result->count; m++)
+            {
+                MazeAnalysis analysis = result->matches[m].analysis;
+                fprintf(file, "%i %i %i %i %i %i %.3f\n", result->matches[m].seed, analysis.path_length, analysis.dead_ends,
+                    analysis.loops, analysis.junctions, analysis.components, analysis.branching);
+            }
+
+            found += result->count;
+            failed += result->failed;
+            result->count = 0;
+            result->failed = 0;
+        }
+
+        long long searched = (block + round_blocks)*MAZE_SEARCH_BLOCK_SEEDS;
+        if (searched > search.count) searched = search.count;
+        printf("INFO: %lli/%lli seeds searched, %lli found\n", searched, search.count, found);
+    }
+
+    double elapsed = GetMazeTime() - start_time;
+
+    UnloadMazeJobPool(pool);
+    fclose(file);
+
+    for (int b = 0; b < MAZE_SEARCH_ROUND_BLOCKS; b++) free(search.blocks[b].matches);
+    free(search.blocks);
+
+    if (failed > 0) fprintf(stderr, "ERROR: %lli mazes could not be generated\n", failed);
+
+    printf("INFO: Searched %lli seeds in %.3f s (%.1f mazes/s), %lli seeds saved to %s\n", search.count, elapsed,
+        (double)search.count/elapsed, found, search.output_file);
+
+    return (failed > 0)? 1 : 0;
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+
+// Generate and analyze one block of seeds
+static void SearchMazeBlockJob(void *data, int index)
+{
+    MazeSearch *search = (MazeSearch *)data;
+    MazeSearchBlock *block = &search->blocks[index];
+    const MazeGenerator *generator = GetMazeGenerator(search->algorithm);
+
+    // NOTE: Maze ends placed same way than the game
+    int end_x = generator->perfect? GetMazePerfectLast(search->width) : search->width - 2;
+    int end_y = generator->perfect? GetMazePerfectLast(search->height) : search->height - 2;
+
+    MazeAnalyzer analyzer = LoadMazeAnalyzer(search->width, search->height);
+    long long first = search->round_first + (long long)index*MAZE_SEARCH_BLOCK_SEEDS;
+    long long last = first + MAZE_SEARCH_BLOCK_SEEDS;
+    if (last > search->count) last = search->count;
+
+    for (long long i = first; i < last; i++)
+    {
+        int seed = (int)(search->first_seed + i*search->seed_step);
+
+        // NOTE: Every maze uses its own random state, seeded same way than the game
+        MazeRandom rng = { 0 };
+        SetMazeRandomSeed(&rng, seed);
+
+        MazeGrid grid = generator->generate(search->width, search->height, search->spacing_rows, search->spacing_cols, search->point_chance, &rng, NULL);
+
+        if ((grid.cells == NULL) || (analyzer.capacity == 0))
+        {
+            block->failed++;
+            UnloadMazeGrid(grid);
+            continue;
+        }
+
+        MazeAnalysis analysis = AnalyzeMaze(&analyzer, grid, 1, 1, end_x, end_y);
+
+        if (CheckMazeConstraints(analysis, search->constraints))
+        {
+            if (block->count >= block->capacity)
+            {
+                int capacity = (block->capacity > 0)? block->capacity*2 : 64;
+                MazeSearchMatch *matches = (MazeSearchMatch *)realloc(block->matches, capacity*sizeof(MazeSearchMatch));
+
+                if (matches == NULL)
+                {
+                    block->failed++;
+                    UnloadMazeGrid(grid);
+                    continue;
+                }
+
+                block->matches = matches;
+                block->capacity = capacity;
+            }
+
+            block->matches[block->count++] = (MazeSearchMatch){ seed, analysis };
+        }
+
+        UnloadMazeGrid(grid);
+    }
+
+    UnloadMazeAnalyzer(&analyzer);
+}